@@ -242,6 +242,7 @@ namespace ConvectionCoefficients {
 	bool ConvectionGeometryMetaDataSetup( false ); // set to true once geometry meta data are setup
 	Real64 CubeRootOfOverallBuildingVolume( 0.0 ); // building meta data. cube root of the volume of all the zones
 	Real64 RoofLongAxisOutwardAzimuth( 0.0 ); // roof surfaces meta data. outward normal azimuth for longest roof edge
+	std::vector< int > TARPIntConvSurfs; // opaque surfaces using the TARP inside correlation in the current pass
 
 	// SUBROUTINE SPECIFICATIONS:
 	//PRIVATE ApplyConvectionValue ! internal to GetUserConvectionCoefficients
@@ -392,6 +393,8 @@ namespace ConvectionCoefficients {
 			MyEnvirnFlag = false;
 		}
 		if ( ! BeginEnvrnFlag ) MyEnvirnFlag = true;
+		TARPIntConvSurfs.clear();
+		TARPIntConvSurfs.reserve( TotSurfaces );
 		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
 
 			{ auto const SELECT_CASE_var( Zone( ZoneNum ).InsideConvectionAlgo );
@@ -433,7 +436,8 @@ namespace ConvectionCoefficients {
 
 					} else if ( SELECT_CASE_var1 == ASHRAETARP ) {
 						if ( ! Construct( Surface( SurfNum ).Construction ).TypeIsWindow ) {
-							CalcASHRAEDetailedIntConvCoeff( SurfNum, SurfaceTemperatures( SurfNum ), MAT( ZoneNum ) );
+							TARPIntConvSurfs.push_back( SurfNum ); // evaluated together after the surface loop
+							continue;
 						} else {
 							CalcISO15099WindowIntConvCoeff( SurfNum, SurfaceTemperatures( SurfNum ), MAT( ZoneNum ) );
 						}
@@ -460,7 +464,8 @@ namespace ConvectionCoefficients {
 
 					} else if ( SELECT_CASE_var1 == ASHRAETARP ) {
 						if ( ! Construct( Surface( SurfNum ).Construction ).TypeIsWindow ) {
-							CalcASHRAEDetailedIntConvCoeff( SurfNum, SurfaceTemperatures( SurfNum ), MAT( ZoneNum ) );
+							TARPIntConvSurfs.push_back( SurfNum ); // evaluated together after the surface loop
+							continue;
 						} else {
 							CalcISO15099WindowIntConvCoeff( SurfNum, SurfaceTemperatures( SurfNum ), MAT( ZoneNum ) );
 						}
@@ -490,6 +495,9 @@ namespace ConvectionCoefficients {
 			}
 		}
 
+		// The TARP surfaces skipped above (the bulk of most models) are evaluated as one group
+		CalcASHRAEDetailedIntConvCoeffs( SurfaceTemperatures );
+
 	}
 
 	void
@@ -3814,6 +3822,76 @@ namespace ConvectionCoefficients {
 
 	}
 
+	void
+	CalcASHRAEDetailedIntConvCoeffs(
+		Array1S< Real64 > const SurfaceTemperatures // Temperature of surfaces for evaluation of HcIn
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Rick Strand
+		//       DATE WRITTEN   August 2000
+		//       MODIFIED       na
+		//       RE-ENGINEERED  Grouped pass over all TARP surfaces (from CalcASHRAEDetailedIntConvCoeff)
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Grouped version of CalcASHRAEDetailedIntConvCoeff for all of the surfaces collected in
+		// TARPIntConvSurfs by InitInteriorConvectionCoeffs.
+
+		// METHODOLOGY EMPLOYED:
+		// Same TARP correlations as CalcASHRAEDetailedIntConvCoeff.  The surface inputs are gathered
+		// into contiguous scratch arrays first so the correlation loop carries no per-surface dispatch
+		// or indirect lookups, then the results are scattered back to HConvIn with the lower limit
+		// and any EMS override applied.
+
+		// REFERENCES:
+		// 1.  Walton, G. N. 1983. Thermal Analysis Research Program (TARP) Reference Manual,
+		//     NBSSIR 83-2655, National Bureau of Standards, "Surface Inside Heat Balances", pp 79-80.
+		// 2.  ASHRAE Handbook of Fundamentals 2001, p. 3.12, Table 5.
+
+		// Using/Aliasing
+		using DataHeatBalFanSys::MAT;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static std::vector< Real64 > DeltaTemp; // Temperature difference between the surface and the zone air
+		static std::vector< Real64 > CosTilt; // Cosine of the surface tilt
+		static std::vector< Real64 > HcIn; // Convection coefficient results
+
+		std::vector< int >::size_type const nSurf( TARPIntConvSurfs.size() );
+		if ( nSurf == 0 ) return;
+		DeltaTemp.resize( nSurf );
+		CosTilt.resize( nSurf );
+		HcIn.resize( nSurf );
+
+		for ( std::vector< int >::size_type i = 0; i < nSurf; ++i ) {
+			int const SurfNum( TARPIntConvSurfs[ i ] );
+			auto const & surface( Surface( SurfNum ) );
+			DeltaTemp[ i ] = SurfaceTemperatures( SurfNum ) - MAT( surface.Zone );
+			CosTilt[ i ] = surface.CosTilt;
+			HcIn[ i ] = HConvIn( SurfNum );
+		}
+
+		for ( std::vector< int >::size_type i = 0; i < nSurf; ++i ) {
+			Real64 const dT( DeltaTemp[ i ] );
+			Real64 const cosT( CosTilt[ i ] );
+			if ( ( dT == 0.0 ) || ( cosT == 0.0 ) ) { // Vertical Surface
+				HcIn[ i ] = CalcASHRAEVerticalWall( dT );
+			} else if ( ( ( dT < 0.0 ) && ( cosT > 0.0 ) ) || ( ( dT > 0.0 ) && ( cosT < 0.0 ) ) ) { // Enhanced Convection
+				HcIn[ i ] = CalcWaltonUnstableHorizontalOrTilt( dT, cosT );
+			} else if ( ( ( dT > 0.0 ) && ( cosT > 0.0 ) ) || ( ( dT < 0.0 ) && ( cosT < 0.0 ) ) ) { // Reduced Convection
+				HcIn[ i ] = CalcWaltonStableHorizontalOrTilt( dT, cosT );
+			}
+		}
+
+		for ( std::vector< int >::size_type i = 0; i < nSurf; ++i ) {
+			int const SurfNum( TARPIntConvSurfs[ i ] );
+			// Establish some lower limit to avoid a zero convection coefficient (and potential divide by zero problems)
+			HConvIn( SurfNum ) = max( HcIn[ i ], LowHConvLimit );
+			if ( Surface( SurfNum ).EMSOverrideIntConvCoef ) HConvIn( SurfNum ) = Surface( SurfNum ).EMSValueForIntConvCoef;
+		}
+
+	}
+
 	void
 	CalcDetailedHcInForDVModel(
 		int const SurfNum, // surface number for which coefficients are being calculated
@@ -59,6 +59,9 @@
 #ifndef ConvectionCoefficients_hh_INCLUDED
 #define ConvectionCoefficients_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 #include <ObjexxFCL/Array1S.hh>
@@ -190,6 +193,7 @@ namespace ConvectionCoefficients {
 	extern bool ConvectionGeometryMetaDataSetup; // set to true once geometry meta data are setup
 	extern Real64 CubeRootOfOverallBuildingVolume; // building meta data. cube root of the volume of all the zones
 	extern Real64 RoofLongAxisOutwardAzimuth; // roof surfaces meta data. outward normal azimuth for longest roof edge
+	extern std::vector< int > TARPIntConvSurfs; // opaque surfaces using the TARP inside correlation in the current pass
 
 	// SUBROUTINE SPECIFICATIONS:
 	//PRIVATE ApplyConvectionValue ! internal to GetUserConvectionCoefficients
@@ -599,6 +603,11 @@ namespace ConvectionCoefficients {
 		Real64 const ZoneMeanAirTemperature // Mean Air Temperature of Zone
 	);
 
+	void
+	CalcASHRAEDetailedIntConvCoeffs(
+		Array1S< Real64 > const SurfaceTemperatures // Temperature of surfaces for evaluation of HcIn
+	);
+
 	void
 	CalcDetailedHcInForDVModel(
 		int const SurfNum, // surface number for which coefficients are being calculated
@@ -79,6 +79,7 @@
 #include <DataLoopNode.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSizing.hh>
+#include <DataSystemVariables.hh>
 #include <DataWater.hh>
 #include <DataZoneEnergyDemands.hh>
 #include <DataZoneEquipment.hh>
@@ -190,6 +191,7 @@ namespace DXCoils {
 	int const MaxCapacityStages( 2 ); // Maximum number of capacity stages supported
 	int const MaxDehumidModes( 1 ); // Maximum number of enhanced dehumidification modes supported
 	int const MaxModes( MaxCapacityStages * ( MaxDehumidModes + 1 ) ); // Maximum number of performance modes
+	int const DXCoilPerfMemoSize( 4 ); // Number of full load operating points remembered per DX coil
 
 	//Water Systems
 	int const CondensateDiscarded( 1001 ); // default mode where water is "lost"
@@ -7183,7 +7185,7 @@ namespace DXCoils {
 					}
 					ShowContinueErrorTimeStamp( " Resetting curve output to zero and continuing simulation." );
 				}
-				ShowRecurringWarningErrorAtEnd( Coil.DXCoilType + " \"" + Coil.Name + "\": HPWH Heating Capacity Modifier curve (function of temperature) output is negative warning continues...", Coil.HCapFTempErrorIndex, HeatCapFTemp, HeatCapFTemp, _, "[C]", "[C]" );
+				ShowRecurringWarningErrorAtEnd( [&]() { return Coil.DXCoilType + " \"" + Coil.Name + "\": HPWH Heating Capacity Modifier curve (function of temperature) output is negative warning continues..."; }, Coil.HCapFTempErrorIndex, HeatCapFTemp, HeatCapFTemp, _, "[C]", "[C]" );
 				HeatCapFTemp = 0.0;
 			}
 		} else {
@@ -7208,7 +7210,7 @@ namespace DXCoils {
 					}
 					ShowContinueErrorTimeStamp( " Resetting curve output to zero and continuing simulation." );
 				}
-				ShowRecurringWarningErrorAtEnd( Coil.DXCoilType + " \"" + Coil.Name + "\": HPWH Heating COP Modifier curve (function of temperature) output is negative warning continues...", Coil.HCOPFTempErrorIndex, HeatCOPFTemp, HeatCOPFTemp, _, "[C]", "[C]" );
+				ShowRecurringWarningErrorAtEnd( [&]() { return Coil.DXCoilType + " \"" + Coil.Name + "\": HPWH Heating COP Modifier curve (function of temperature) output is negative warning continues..."; }, Coil.HCOPFTempErrorIndex, HeatCOPFTemp, HeatCOPFTemp, _, "[C]", "[C]" );
 				HeatCOPFTemp = 0.0;
 			}
 		} else {
@@ -7226,7 +7228,7 @@ namespace DXCoils {
 					ShowContinueError( " Negative value occurs using an air flow fraction of " + TrimSigDigits( AirFlowRateRatio, 3 ) + '.' );
 					ShowContinueErrorTimeStamp( " Resetting curve output to zero and continuing simulation." );
 				}
-				ShowRecurringWarningErrorAtEnd( Coil.DXCoilType + " \"" + Coil.Name + "\": HPWH Heating Capacity Modifier curve (function of air flow fraction) output is negative warning continues...", Coil.HCapFAirFlowErrorIndex, HeatCapFAirFlow, HeatCapFAirFlow );
+				ShowRecurringWarningErrorAtEnd( [&]() { return Coil.DXCoilType + " \"" + Coil.Name + "\": HPWH Heating Capacity Modifier curve (function of air flow fraction) output is negative warning continues..."; }, Coil.HCapFAirFlowErrorIndex, HeatCapFAirFlow, HeatCapFAirFlow );
 				HeatCapFAirFlow = 0.0;
 			}
 		} else {
@@ -7244,7 +7246,7 @@ namespace DXCoils {
 					ShowContinueError( " Negative value occurs using an air flow fraction of " + TrimSigDigits( AirFlowRateRatio, 3 ) + '.' );
 					ShowContinueErrorTimeStamp( " Resetting curve output to zero and continuing simulation." );
 				}
-				ShowRecurringWarningErrorAtEnd( Coil.DXCoilType + " \"" + Coil.Name + "\": HPWH Heating COP Modifier curve (function of air flow fraction) output is negative warning continues...", Coil.HCOPFAirFlowErrorIndex, HeatCOPFAirFlow, HeatCOPFAirFlow );
+				ShowRecurringWarningErrorAtEnd( [&]() { return Coil.DXCoilType + " \"" + Coil.Name + "\": HPWH Heating COP Modifier curve (function of air flow fraction) output is negative warning continues..."; }, Coil.HCOPFAirFlowErrorIndex, HeatCOPFAirFlow, HeatCOPFAirFlow );
 				HeatCOPFAirFlow = 0.0;
 			}
 		} else {
@@ -7262,7 +7264,7 @@ namespace DXCoils {
 					ShowContinueError( " Negative value occurs using a water flow fraction of " + TrimSigDigits( WaterFlowRateRatio, 3 ) + '.' );
 					ShowContinueErrorTimeStamp( " Resetting curve output to zero and continuing simulation." );
 				}
-				ShowRecurringWarningErrorAtEnd( Coil.DXCoilType + " \"" + Coil.Name + "\": HPWH Heating Capacity Modifier curve (function of water flow fraction) output is negative warning continues...", Coil.HCapFWaterFlowErrorIndex, HeatCapFWaterFlow, HeatCapFWaterFlow );
+				ShowRecurringWarningErrorAtEnd( [&]() { return Coil.DXCoilType + " \"" + Coil.Name + "\": HPWH Heating Capacity Modifier curve (function of water flow fraction) output is negative warning continues..."; }, Coil.HCapFWaterFlowErrorIndex, HeatCapFWaterFlow, HeatCapFWaterFlow );
 				HeatCapFWaterFlow = 0.0;
 			}
 		} else {
@@ -7280,7 +7282,7 @@ namespace DXCoils {
 					ShowContinueError( " Negative value occurs using a water flow fraction of " + TrimSigDigits( WaterFlowRateRatio, 3 ) + '.' );
 					ShowContinueErrorTimeStamp( " Resetting curve output to zero and continuing simulation." );
 				}
-				ShowRecurringWarningErrorAtEnd( Coil.DXCoilType + " \"" + Coil.Name + "\": HPWH Heating COP Modifier curve (function of water flow fraction) output is negative warning continues...", Coil.HCOPFWaterFlowErrorIndex, HeatCOPFWaterFlow, HeatCOPFWaterFlow );
+				ShowRecurringWarningErrorAtEnd( [&]() { return Coil.DXCoilType + " \"" + Coil.Name + "\": HPWH Heating COP Modifier curve (function of water flow fraction) output is negative warning continues..."; }, Coil.HCOPFWaterFlowErrorIndex, HeatCOPFWaterFlow, HeatCOPFWaterFlow );
 				HeatCOPFWaterFlow = 0.0;
 			}
 		} else {
@@ -7439,6 +7441,7 @@ namespace DXCoils {
 		using DataHeatBalance::Zone;
 		using DataHeatBalFanSys::ZoneAirHumRat;
 		using DataHeatBalFanSys::ZT;
+		using DataSystemVariables::MemoizeDXCoilPerformance;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -7530,6 +7533,10 @@ namespace DXCoils {
 		Real64 DXcoolToHeatPLRRatio; // ratio of cooling PLR to heating PLR, used for cycling fan RH control
 		Real64 HeatRTF; // heating coil part-load ratio, used for cycling fan RH control
 		Real64 HeatingCoilPLF; // heating coil PLF (function of PLR), used for cycling fan RH control
+		bool UsePerfMemo; // TRUE if full load performance may be reused (MemoizeDXCoilPerformance)
+		bool PerfFromMemo; // TRUE if full load capacity and SHR were taken from the coil's performance memo
+		bool CurveOutputReset; // TRUE if a negative capacity curve output was reset to zero
+		DXCoilPerfMemoData PerfMemo; // full load operating point of this call
 
 		// If Performance mode not present, then set to 1.  Used only by Multimode/Multispeed DX coil (otherwise mode = 1)
 		if ( present( PerfMode ) ) {
@@ -7654,9 +7661,9 @@ namespace DXCoils {
 					ShowContinueError( "... Operation at low ambient temperatures may require special performance curves." );
 				}
 				if ( DXCoil( DXCoilNum ).CondenserType( Mode ) == AirCooled ) {
-					ShowRecurringWarningErrorAtEnd( RoutineName + DXCoil( DXCoilNum ).DXCoilType + "=\"" + DXCoil( DXCoilNum ).Name + "\" - Low condenser dry-bulb temperature error continues...", DXCoil( DXCoilNum ).LowAmbErrIndex, DXCoil( DXCoilNum ).LowTempLast, DXCoil( DXCoilNum ).LowTempLast, _, "[C]", "[C]" );
+					ShowRecurringWarningErrorAtEnd( [&]() { return RoutineName + DXCoil( DXCoilNum ).DXCoilType + "=\"" + DXCoil( DXCoilNum ).Name + "\" - Low condenser dry-bulb temperature error continues..."; }, DXCoil( DXCoilNum ).LowAmbErrIndex, DXCoil( DXCoilNum ).LowTempLast, DXCoil( DXCoilNum ).LowTempLast, _, "[C]", "[C]" );
 				} else {
-					ShowRecurringWarningErrorAtEnd( RoutineName + DXCoil( DXCoilNum ).DXCoilType + "=\"" + DXCoil( DXCoilNum ).Name + "\" - Low condenser wet-bulb temperature error continues...", DXCoil( DXCoilNum ).LowAmbErrIndex, DXCoil( DXCoilNum ).LowTempLast, DXCoil( DXCoilNum ).LowTempLast, _, "[C]", "[C]" );
+					ShowRecurringWarningErrorAtEnd( [&]() { return RoutineName + DXCoil( DXCoilNum ).DXCoilType + "=\"" + DXCoil( DXCoilNum ).Name + "\" - Low condenser wet-bulb temperature error continues..."; }, DXCoil( DXCoilNum ).LowAmbErrIndex, DXCoil( DXCoilNum ).LowTempLast, DXCoil( DXCoilNum ).LowTempLast, _, "[C]", "[C]" );
 				}
 			}
 		}
@@ -7671,7 +7678,7 @@ namespace DXCoils {
 					ShowContinueError( "   2) may have a low air flow rate per watt of cooling capacity. Check inputs." );
 					ShowContinueError( "   3) is used as part of a HX assisted cooling coil which uses a high sensible effectiveness. Check inputs." );
 				}
-				ShowRecurringWarningErrorAtEnd( RoutineName + DXCoil( DXCoilNum ).DXCoilType + "=\"" + DXCoil( DXCoilNum ).Name + "\" - Full load outlet temperature indicates a possibility of frost/freeze error continues. Outlet air temperature statistics follow:", DXCoil( DXCoilNum ).LowOutletTempIndex, DXCoil( DXCoilNum ).FullLoadOutAirTempLast, DXCoil( DXCoilNum ).FullLoadOutAirTempLast );
+				ShowRecurringWarningErrorAtEnd( [&]() { return RoutineName + DXCoil( DXCoilNum ).DXCoilType + "=\"" + DXCoil( DXCoilNum ).Name + "\" - Full load outlet temperature indicates a possibility of frost/freeze error continues. Outlet air temperature statistics follow:"; }, DXCoil( DXCoilNum ).LowOutletTempIndex, DXCoil( DXCoilNum ).FullLoadOutAirTempLast, DXCoil( DXCoilNum ).FullLoadOutAirTempLast );
 			}
 		}
 
@@ -7716,7 +7723,7 @@ namespace DXCoils {
 					ShowContinueError( "Possible causes include inconsistent air flow rates in system components," );
 					ShowContinueError( "or variable air volume [VAV] system using incorrect coil type." );
 				}
-				ShowRecurringWarningErrorAtEnd( RoutineName + DXCoil( DXCoilNum ).DXCoilType + "=\"" + DXCoil( DXCoilNum ).Name + "\" - Air volume flow rate per watt of rated total cooling capacity is out of range error continues...", DXCoil( DXCoilNum ).ErrIndex1, VolFlowperRatedTotCap, VolFlowperRatedTotCap );
+				ShowRecurringWarningErrorAtEnd( [&]() { return RoutineName + DXCoil( DXCoilNum ).DXCoilType + "=\"" + DXCoil( DXCoilNum ).Name + "\" - Air volume flow rate per watt of rated total cooling capacity is out of range error continues..."; }, DXCoil( DXCoilNum ).ErrIndex1, VolFlowperRatedTotCap, VolFlowperRatedTotCap );
 			} else if ( ! WarmupFlag && DXCoil( DXCoilNum ).DXCoilType_Num == CoilDX_HeatPumpWaterHeaterPumped && DXCoil( DXCoilNum ).DXCoilType_Num == CoilDX_HeatPumpWaterHeaterWrapped && ( ( VolFlowperRatedTotCap < MinOperVolFlowPerRatedTotCap( DXCT ) ) || ( VolFlowperRatedTotCap > MaxHeatVolFlowPerRatedTotCap( DXCT ) ) ) ) {
 				if ( DXCoil( DXCoilNum ).ErrIndex1 == 0 ) {
 					ShowWarningMessage( RoutineName + DXCoil( DXCoilNum ).DXCoilType + "=\"" + DXCoil( DXCoilNum ).Name + "\" - Air volume flow rate per watt of rated total water heating capacity is out of range at " + RoundSigDigits( VolFlowperRatedTotCap, 2 ) + " m3/s/W." );
@@ -7724,7 +7731,7 @@ namespace DXCoils {
 					ShowContinueError( "Expected range for VolumeFlowPerRatedTotalCapacity=[" + RoundSigDigits( MinOperVolFlowPerRatedTotCap( DXCT ), 3 ) + "--" + RoundSigDigits( MaxHeatVolFlowPerRatedTotCap( DXCT ), 3 ) + ']' );
 					ShowContinueError( "Possible causes may be that the parent object is calling for an actual supply air flow rate that is much higher or lower than the DX coil rated supply air flow rate." );
 				}
-				ShowRecurringWarningErrorAtEnd( RoutineName + DXCoil( DXCoilNum ).DXCoilType + "=\"" + DXCoil( DXCoilNum ).Name + "\" - Air volume flow rate per watt of rated total water heating capacity is out of range error continues...", DXCoil( DXCoilNum ).ErrIndex1, VolFlowperRatedTotCap, VolFlowperRatedTotCap );
+				ShowRecurringWarningErrorAtEnd( [&]() { return RoutineName + DXCoil( DXCoilNum ).DXCoilType + "=\"" + DXCoil( DXCoilNum ).Name + "\" - Air volume flow rate per watt of rated total water heating capacity is out of range error continues..."; }, DXCoil( DXCoilNum ).ErrIndex1, VolFlowperRatedTotCap, VolFlowperRatedTotCap );
 			}
 			//    Adjust coil bypass factor for actual air flow rate. Use relation CBF = exp(-NTU) where
 			//    NTU = A0/(m*cp). Relationship models the cooling coil as a heat exchanger with Cmin/Cmax = 0.
@@ -7767,7 +7774,22 @@ namespace DXCoils {
 			//  InletAirHumRat may be modified in this ADP/BF loop, use temporary varible for calculations
 			InletAirHumRatTemp = InletAirHumRat;
 			AirMassFlowRatio = AirMassFlow / DXCoil( DXCoilNum ).RatedAirMassFlowRate( Mode );
-			while ( true ) {
+			// Reuse the full load capacity and SHR if this operating point was evaluated before
+			UsePerfMemo = MemoizeDXCoilPerformance && ! AnyEnergyManagementSystemInModel;
+			PerfFromMemo = false;
+			CurveOutputReset = false;
+			if ( UsePerfMemo ) {
+				PerfMemo = DXCoilPerfMemoData( Mode, DXCoil( DXCoilNum ).RatedTotCap( Mode ), CBF, InletAirDryBulbTemp, InletAirWetBulbC, CondInletTemp, AirMassFlowRatio, AirMassFlow, OutdoorPressure );
+				PerfFromMemo = FindDXCoilPerfMemo( DXCoilNum, PerfMemo );
+				if ( PerfFromMemo ) {
+					TotCap = PerfMemo.TotCap;
+					SHR = PerfMemo.SHR;
+					hDelta = TotCap / AirMassFlow;
+					InletAirWetBulbC = PerfMemo.DryCoilWetBulb;
+					Counter = PerfMemo.DryCoilIter;
+				}
+			}
+			while ( ! PerfFromMemo ) {
 				if ( DXCoil( DXCoilNum ).DXCoilType_Num == CoilDX_HeatPumpWaterHeaterPumped || DXCoil( DXCoilNum ).DXCoilType_Num == CoilDX_HeatPumpWaterHeaterWrapped ) {
 					// Coil:DX:HeatPumpWaterHeater does not have total cooling capacity as a function of temp or flow curve
 					TotCapTempModFac = 1.0;
@@ -7794,8 +7816,9 @@ namespace DXCoils {
 							}
 							ShowContinueErrorTimeStamp( " Resetting curve output to zero and continuing simulation." );
 						}
-						ShowRecurringWarningErrorAtEnd( RoutineName + DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\": Total Cooling Capacity Modifier curve (function of temperature) output is negative warning continues...", DXCoil( DXCoilNum ).CCapFTempErrorIndex, TotCapTempModFac, TotCapTempModFac );
+						ShowRecurringWarningErrorAtEnd( [&]() { return RoutineName + DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\": Total Cooling Capacity Modifier curve (function of temperature) output is negative warning continues..."; }, DXCoil( DXCoilNum ).CCapFTempErrorIndex, TotCapTempModFac, TotCapTempModFac );
 						TotCapTempModFac = 0.0;
+						CurveOutputReset = true;
 					}
 
 					//    Get total capacity modifying factor (function of mass flow) for off-rated conditions
@@ -7811,8 +7834,9 @@ namespace DXCoils {
 								ShowContinueError( " Negative output results from stage " + TrimSigDigits( Mode ) + " compressor operation." );
 							}
 						}
-						ShowRecurringWarningErrorAtEnd( RoutineName + DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\": Total Cooling Capacity Modifier curve (function of flow fraction) output is negative warning continues...", DXCoil( DXCoilNum ).CCapFFlowErrorIndex, TotCapFlowModFac, TotCapFlowModFac );
+						ShowRecurringWarningErrorAtEnd( [&]() { return RoutineName + DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\": Total Cooling Capacity Modifier curve (function of flow fraction) output is negative warning continues..."; }, DXCoil( DXCoilNum ).CCapFFlowErrorIndex, TotCapFlowModFac, TotCapFlowModFac );
 						TotCapFlowModFac = 0.0;
+						CurveOutputReset = true;
 					}
 				}
 				TotCap = DXCoil( DXCoilNum ).RatedTotCap( Mode ) * TotCapFlowModFac * TotCapTempModFac;
@@ -7854,6 +7878,13 @@ namespace DXCoils {
 					}
 				}
 			} // end of DO iteration loop
+			if ( UsePerfMemo && ! PerfFromMemo && ! CurveOutputReset ) {
+				PerfMemo.TotCap = TotCap;
+				PerfMemo.SHR = SHR;
+				PerfMemo.DryCoilWetBulb = InletAirWetBulbC;
+				PerfMemo.DryCoilIter = Counter;
+				SaveDXCoilPerfMemo( DXCoilNum, PerfMemo );
+			}
 
 			if ( DXCoil( DXCoilNum ).PLFFPLR( Mode ) > 0 ) {
 				PLF = CurveValue( DXCoil( DXCoilNum ).PLFFPLR( Mode ), PartLoadRatio ); // Calculate part-load factor
@@ -7876,9 +7907,9 @@ namespace DXCoils {
 					}
 				}
 				if ( DXCoil( DXCoilNum ).DXCoilType_Num == CoilDX_HeatPumpWaterHeaterPumped || DXCoil( DXCoilNum ).DXCoilType_Num == CoilDX_HeatPumpWaterHeaterWrapped ) {
-					ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).Name + ", " + DXCoil( DXCoilNum ).DXCoilType + " PLF curve < 0.7 warning continues...", DXCoil( DXCoilNum ).ErrIndex2, PLF, PLF );
+					ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).Name + ", " + DXCoil( DXCoilNum ).DXCoilType + " PLF curve < 0.7 warning continues..."; }, DXCoil( DXCoilNum ).ErrIndex2, PLF, PLF );
 				} else {
-					ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).Name + ", " + DXCoil( DXCoilNum ).DXCoilType + " PLF curve < 0.7 warning continues...", DXCoil( DXCoilNum ).ErrIndex2, PLF, PLF );
+					ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).Name + ", " + DXCoil( DXCoilNum ).DXCoilType + " PLF curve < 0.7 warning continues..."; }, DXCoil( DXCoilNum ).ErrIndex2, PLF, PLF );
 				}
 				PLF = 0.7;
 			}
@@ -7902,9 +7933,9 @@ namespace DXCoils {
 					}
 				}
 				if ( DXCoil( DXCoilNum ).DXCoilType_Num == CoilDX_HeatPumpWaterHeaterPumped || DXCoil( DXCoilNum ).DXCoilType_Num == CoilDX_HeatPumpWaterHeaterWrapped ) {
-					ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).Name + ", " + DXCoil( DXCoilNum ).DXCoilType + " runtime fraction > 1.0 warning continues...", DXCoil( DXCoilNum ).ErrIndex3, DXCoil( DXCoilNum ).CoolingCoilRuntimeFraction, DXCoil( DXCoilNum ).CoolingCoilRuntimeFraction );
+					ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).Name + ", " + DXCoil( DXCoilNum ).DXCoilType + " runtime fraction > 1.0 warning continues..."; }, DXCoil( DXCoilNum ).ErrIndex3, DXCoil( DXCoilNum ).CoolingCoilRuntimeFraction, DXCoil( DXCoilNum ).CoolingCoilRuntimeFraction );
 				} else {
-					ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).Name + ", " + DXCoil( DXCoilNum ).DXCoilType + " runtime fraction > 1.0 warning continues...", DXCoil( DXCoilNum ).ErrIndex3, DXCoil( DXCoilNum ).CoolingCoilRuntimeFraction, DXCoil( DXCoilNum ).CoolingCoilRuntimeFraction );
+					ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).Name + ", " + DXCoil( DXCoilNum ).DXCoilType + " runtime fraction > 1.0 warning continues..."; }, DXCoil( DXCoilNum ).ErrIndex3, DXCoil( DXCoilNum ).CoolingCoilRuntimeFraction, DXCoil( DXCoilNum ).CoolingCoilRuntimeFraction );
 				}
 				DXCoil( DXCoilNum ).CoolingCoilRuntimeFraction = 1.0; // Reset coil runtime fraction to 1.0
 			} else if ( DXCoil( DXCoilNum ).CoolingCoilRuntimeFraction > 1.0 ) {
@@ -8109,7 +8140,7 @@ namespace DXCoils {
 						}
 						ShowContinueErrorTimeStamp( " Resetting curve output to zero and continuing simulation." );
 					}
-					ShowRecurringWarningErrorAtEnd( RoutineName + DXCoil( DXCoilNum ).DXCoilType + "=\"" + DXCoil( DXCoilNum ).Name + "\": Energy Input Ratio Modifier curve (function of temperature) output is negative warning continues...", DXCoil( DXCoilNum ).EIRFTempErrorIndex, EIRTempModFac, EIRTempModFac );
+					ShowRecurringWarningErrorAtEnd( [&]() { return RoutineName + DXCoil( DXCoilNum ).DXCoilType + "=\"" + DXCoil( DXCoilNum ).Name + "\": Energy Input Ratio Modifier curve (function of temperature) output is negative warning continues..."; }, DXCoil( DXCoilNum ).EIRFTempErrorIndex, EIRTempModFac, EIRTempModFac );
 					EIRTempModFac = 0.0;
 				}
 
@@ -8126,7 +8157,7 @@ namespace DXCoils {
 							ShowContinueError( " Negative output results from stage " + TrimSigDigits( Mode ) + " compressor operation." );
 						}
 					}
-					ShowRecurringWarningErrorAtEnd( RoutineName + DXCoil( DXCoilNum ).DXCoilType + "=\"" + DXCoil( DXCoilNum ).Name + "\": Energy Input Ratio Modifier curve (function of flow fraction) output is negative warning continues...", DXCoil( DXCoilNum ).EIRFFlowErrorIndex, EIRFlowModFac, EIRFlowModFac );
+					ShowRecurringWarningErrorAtEnd( [&]() { return RoutineName + DXCoil( DXCoilNum ).DXCoilType + "=\"" + DXCoil( DXCoilNum ).Name + "\": Energy Input Ratio Modifier curve (function of flow fraction) output is negative warning continues..."; }, DXCoil( DXCoilNum ).EIRFFlowErrorIndex, EIRFlowModFac, EIRFlowModFac );
 					EIRFlowModFac = 0.0;
 				}
 			}
@@ -8479,7 +8510,7 @@ namespace DXCoils {
 					ShowContinueError( DXCoil( DXCoilNum ).LowAmbBuffer2 );
 					ShowContinueError( "... Operation at low inlet temperatures may require special performance curves." );
 				}
-				ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\" - Low condenser inlet temperature error continues...", DXCoil( DXCoilNum ).LowAmbErrIndex, DXCoil( DXCoilNum ).LowTempLast, DXCoil( DXCoilNum ).LowTempLast, _, "[C]", "[C]" );
+				ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\" - Low condenser inlet temperature error continues..."; }, DXCoil( DXCoilNum ).LowAmbErrIndex, DXCoil( DXCoilNum ).LowTempLast, DXCoil( DXCoilNum ).LowTempLast, _, "[C]", "[C]" );
 			}
 		}
 
@@ -8490,7 +8521,7 @@ namespace DXCoils {
 					ShowContinueError( DXCoil( DXCoilNum ).HighAmbBuffer2 );
 					ShowContinueError( "... Operation at high inlet temperatures may require special performance curves." );
 				}
-				ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\" - High condenser inlet temperature error continues...", DXCoil( DXCoilNum ).HighAmbErrIndex, DXCoil( DXCoilNum ).HighTempLast, DXCoil( DXCoilNum ).HighTempLast, _, "[C]", "[C]" );
+				ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\" - High condenser inlet temperature error continues..."; }, DXCoil( DXCoilNum ).HighAmbErrIndex, DXCoil( DXCoilNum ).HighTempLast, DXCoil( DXCoilNum ).HighTempLast, _, "[C]", "[C]" );
 			}
 		}
 
@@ -8504,7 +8535,7 @@ namespace DXCoils {
 					ShowContinueError( "   2) may have a low air flow rate per watt of cooling capacity. Check inputs." );
 					ShowContinueError( "   3) is used as part of a HX assisted cooling coil which uses a high sensible effectiveness. Check inputs." );
 				}
-				ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\" - Full load outlet temperature indicates a possibility of frost/freeze error continues. Outlet air temperature statistics follow:", DXCoil( DXCoilNum ).LowOutletTempIndex, DXCoil( DXCoilNum ).FullLoadOutAirTempLast, DXCoil( DXCoilNum ).FullLoadOutAirTempLast );
+				ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\" - Full load outlet temperature indicates a possibility of frost/freeze error continues. Outlet air temperature statistics follow:"; }, DXCoil( DXCoilNum ).LowOutletTempIndex, DXCoil( DXCoilNum ).FullLoadOutAirTempLast, DXCoil( DXCoilNum ).FullLoadOutAirTempLast );
 			}
 		}
 
@@ -8557,7 +8588,7 @@ namespace DXCoils {
 					ShowContinueError( "...Inlet Air Humidity Ratio = " + RoundSigDigits( InletAirHumRat, 8 ) + " kgWater/kgDryAir." );
 
 				}
-				ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\" - Air volume flow rate per watt of rated total cooling capacity is out of range error continues...", DXCoil( DXCoilNum ).ErrIndex1, VolFlowperRatedTotCap, VolFlowperRatedTotCap );
+				ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\" - Air volume flow rate per watt of rated total cooling capacity is out of range error continues..."; }, DXCoil( DXCoilNum ).ErrIndex1, VolFlowperRatedTotCap, VolFlowperRatedTotCap );
 			}
 			//    Adjust coil bypass factor for actual air flow rate. Use relation CBF = exp(-NTU) where
 			//    NTU = A0/(m*cp). Relationship models the cooling coil as a heat exchanger with Cmin/Cmax = 0.
@@ -8614,7 +8645,7 @@ Label50: ;
 					}
 					ShowContinueErrorTimeStamp( " Resetting curve output to zero and continuing simulation." );
 				}
-				ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\": Total Cooling Capacity Modifier curve (function of temperature) output is negative warning continues...", DXCoil( DXCoilNum ).CCapFTempErrorIndex, TotCapTempModFac, TotCapTempModFac );
+				ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\": Total Cooling Capacity Modifier curve (function of temperature) output is negative warning continues..."; }, DXCoil( DXCoilNum ).CCapFTempErrorIndex, TotCapTempModFac, TotCapTempModFac );
 				TotCapTempModFac = 0.0;
 			}
 
@@ -8633,7 +8664,7 @@ Label50: ;
 						ShowContinueError( " Negative output results from stage " + TrimSigDigits( Mode ) + " compressor operation." );
 					}
 				}
-				ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\": Total Cooling Capacity Modifier curve (function of flow fraction) output is negative warning continues...", DXCoil( DXCoilNum ).CCapFFlowErrorIndex, TotCapFlowModFac, TotCapFlowModFac );
+				ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\": Total Cooling Capacity Modifier curve (function of flow fraction) output is negative warning continues..."; }, DXCoil( DXCoilNum ).CCapFFlowErrorIndex, TotCapFlowModFac, TotCapFlowModFac );
 				TotCapFlowModFac = 0.0;
 			}
 
@@ -8688,7 +8719,7 @@ Label50: ;
 					ShowContinueErrorTimeStamp( "PLF curve values must be >= 0.7. PLF has been reset to 0.7 and simulation is continuing." );
 					ShowContinueError( "Check the IO reference manual for PLF curve guidance [Coil:Cooling:DX:SingleSpeed]." );
 				}
-				ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).Name + ", DX cooling coil PLF curve < 0.7 warning continues...", DXCoil( DXCoilNum ).ErrIndex2, PLF, PLF );
+				ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).Name + ", DX cooling coil PLF curve < 0.7 warning continues..."; }, DXCoil( DXCoilNum ).ErrIndex2, PLF, PLF );
 				PLF = 0.7;
 			}
 
@@ -8701,7 +8732,7 @@ Label50: ;
 					ShowContinueError( "Check the IO reference manual for PLF curve guidance [Coil:Cooling:DX:SingleSpeed]." );
 					ShowContinueErrorTimeStamp( "" );
 				}
-				ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).Name + ", DX cooling coil runtime fraction > 1.0 warning continues...", DXCoil( DXCoilNum ).ErrIndex3, DXCoil( DXCoilNum ).CoolingCoilRuntimeFraction, DXCoil( DXCoilNum ).CoolingCoilRuntimeFraction );
+				ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).Name + ", DX cooling coil runtime fraction > 1.0 warning continues..."; }, DXCoil( DXCoilNum ).ErrIndex3, DXCoil( DXCoilNum ).CoolingCoilRuntimeFraction, DXCoil( DXCoilNum ).CoolingCoilRuntimeFraction );
 				DXCoil( DXCoilNum ).CoolingCoilRuntimeFraction = 1.0; // Reset coil runtime fraction to 1.0
 			} else if ( DXCoil( DXCoilNum ).CoolingCoilRuntimeFraction > 1.0 ) {
 				DXCoil( DXCoilNum ).CoolingCoilRuntimeFraction = 1.0; // Reset coil runtime fraction to 1.0
@@ -9039,7 +9070,7 @@ Label50: ;
 					ShowContinueError( "Possible causes include inconsistent air flow rates in system components or" );
 					ShowContinueError( "inconsistent supply air fan operation modes in coil and unitary system objects." );
 				}
-				ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\" - Air volume flow rate per watt of rated total heating capacity is out of range error continues...", DXCoil( DXCoilNum ).ErrIndex1, VolFlowperRatedTotCap, VolFlowperRatedTotCap );
+				ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\" - Air volume flow rate per watt of rated total heating capacity is out of range error continues..."; }, DXCoil( DXCoilNum ).ErrIndex1, VolFlowperRatedTotCap, VolFlowperRatedTotCap );
 			}
 
 			// Get total capacity modifying factor (function of temperature) for off-rated conditions
@@ -9202,7 +9233,7 @@ Label50: ;
 					ShowContinueError( "Check the IO reference manual for PLF curve guidance [Coil:Heating:DX:SingleSpeed]." );
 					ShowContinueErrorTimeStamp( "" );
 				}
-				ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).Name + ", DX heating coil runtime fraction > 1.0 warning continues...", DXCoil( DXCoilNum ).ErrIndex4, DXCoil( DXCoilNum ).HeatingCoilRuntimeFraction, DXCoil( DXCoilNum ).HeatingCoilRuntimeFraction );
+				ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).Name + ", DX heating coil runtime fraction > 1.0 warning continues..."; }, DXCoil( DXCoilNum ).ErrIndex4, DXCoil( DXCoilNum ).HeatingCoilRuntimeFraction, DXCoil( DXCoilNum ).HeatingCoilRuntimeFraction );
 				DXCoil( DXCoilNum ).HeatingCoilRuntimeFraction = 1.0; // Reset coil runtime fraction to 1.0
 			} else if ( DXCoil( DXCoilNum ).HeatingCoilRuntimeFraction > 1.0 ) {
 				DXCoil( DXCoilNum ).HeatingCoilRuntimeFraction = 1.0; // Reset coil runtime fraction to 1.0
@@ -10486,6 +10517,151 @@ Label50: ;
 
 	}
 
+	bool
+	FindDXCoilPerfMemo(
+		int const DXCoilNum, // the number of the DX coil
+		DXCoilPerfMemoData & Memo // operating point to look up; results are filled in when found
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Looks up the full load total capacity and SHR of a DX cooling coil at an operating point
+		// that has already been evaluated, so the ADP/BF iteration does not have to be repeated.
+
+		// METHODOLOGY EMPLOYED:
+		// Each coil remembers its last DXCoilPerfMemoSize operating points. An entry matches when the
+		// mode (or speed), nominal capacity and air pressure are identical and the inlet dry-bulb,
+		// inlet wet-bulb and condenser inlet temperatures, flow fraction and bypass factor agree to
+		// within DXCoilMemoTolerance. The mass flow must agree to the same relative tolerance. With the
+		// default tolerance of zero only identical conditions match and results are unchanged.
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataSystemVariables::DXCoilMemoTolerance;
+
+		// Return value
+		// TRUE if Memo was found; TotCap, SHR, DryCoilWetBulb and DryCoilIter are then set
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int Entry; // loop index over the remembered operating points
+
+		auto & Coil( DXCoil( DXCoilNum ) );
+
+		if ( allocated( Coil.PerfMemo ) ) {
+			for ( Entry = 1; Entry <= DXCoilPerfMemoSize; ++Entry ) {
+				auto const & Saved( Coil.PerfMemo( Entry ) );
+				if ( Saved.Mode != Memo.Mode ) continue;
+				if ( Saved.TotCapNom != Memo.TotCapNom || Saved.Pressure != Memo.Pressure ) continue;
+				if ( std::abs( Saved.InletDryBulb - Memo.InletDryBulb ) > DXCoilMemoTolerance ) continue;
+				if ( std::abs( Saved.InletWetBulb - Memo.InletWetBulb ) > DXCoilMemoTolerance ) continue;
+				if ( std::abs( Saved.CondInletTemp - Memo.CondInletTemp ) > DXCoilMemoTolerance ) continue;
+				if ( std::abs( Saved.AirMassFlowRatio - Memo.AirMassFlowRatio ) > DXCoilMemoTolerance ) continue;
+				if ( std::abs( Saved.CBF - Memo.CBF ) > DXCoilMemoTolerance ) continue;
+				if ( std::abs( Saved.AirMassFlow - Memo.AirMassFlow ) > DXCoilMemoTolerance * Memo.AirMassFlow ) continue;
+				Memo.TotCap = Saved.TotCap;
+				Memo.SHR = Saved.SHR;
+				Memo.DryCoilIter = Saved.DryCoilIter;
+				// a wet coil evaluates its curves at the actual inlet wet-bulb
+				Memo.DryCoilWetBulb = ( Saved.DryCoilIter > 0 ) ? Saved.DryCoilWetBulb : Memo.InletWetBulb;
+				++Coil.PerfMemoHits;
+				return true;
+			}
+		}
+
+		++Coil.PerfMemoMisses;
+		return false;
+
+	}
+
+	void
+	SaveDXCoilPerfMemo(
+		int const DXCoilNum, // the number of the DX coil
+		DXCoilPerfMemoData const & Memo // operating point and its full load results
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Remembers the full load results of a DX cooling coil at an operating point for
+		// FindDXCoilPerfMemo, replacing the oldest remembered point.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		auto & Coil( DXCoil( DXCoilNum ) );
+
+		if ( ! allocated( Coil.PerfMemo ) ) {
+			Coil.PerfMemo.allocate( DXCoilPerfMemoSize );
+			Coil.PerfMemoNext = 1;
+		}
+		Coil.PerfMemo( Coil.PerfMemoNext ) = Memo;
+		Coil.PerfMemoNext = mod( Coil.PerfMemoNext, DXCoilPerfMemoSize ) + 1;
+
+	}
+
+	void
+	ReportDXCoilPerfMemo()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Writes the number of full load evaluations each DX cooling coil took from its performance
+		// memo to the eio file at the end of the run.
+
+		// METHODOLOGY EMPLOYED:
+		// na
+
+		// REFERENCES:
+		// na
+
+		// Using/Aliasing
+		using DataSystemVariables::MemoizeDXCoilPerformance;
+		using General::RoundSigDigits;
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		static gio::Fmt fmtA( "(A)" );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int DXCoilNum; // loop index over DX coils
+		int NumEvaluations; // full load evaluations of a coil
+		bool WriteHeader; // TRUE until the eio header line is written
+
+		if ( ! MemoizeDXCoilPerformance ) return;
+
+		WriteHeader = true;
+		for ( DXCoilNum = 1; DXCoilNum <= NumDXCoils; ++DXCoilNum ) {
+			NumEvaluations = DXCoil( DXCoilNum ).PerfMemoHits + DXCoil( DXCoilNum ).PerfMemoMisses;
+			if ( NumEvaluations == 0 ) continue;
+			if ( WriteHeader ) {
+				gio::write( OutputFileInits, fmtA ) << "! <DX Coil Performance Memo>, DX Coil Type, DX Coil Name, Hits, Misses, Hit Rate {%}";
+				WriteHeader = false;
+			}
+			gio::write( OutputFileInits, fmtA ) << " DX Coil Performance Memo," + DXCoil( DXCoilNum ).DXCoilType + ',' + DXCoil( DXCoilNum ).Name + ',' + RoundSigDigits( DXCoil( DXCoilNum ).PerfMemoHits ) + ',' + RoundSigDigits( DXCoil( DXCoilNum ).PerfMemoMisses ) + ',' + RoundSigDigits( 100.0 * DXCoil( DXCoilNum ).PerfMemoHits / NumEvaluations, 1 );
+		}
+
+	}
+
 	void
 	CalcMultiSpeedDXCoilCooling(
 		int const DXCoilNum, // the number of the DX heating coil to be simulated
@@ -10524,6 +10700,7 @@ Label50: ;
 		using General::RoundSigDigits;
 		using DataHeatBalFanSys::ZoneAirHumRat;
 		using DataHeatBalFanSys::ZT;
+		using DataSystemVariables::MemoizeDXCoilPerformance;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -10617,6 +10794,10 @@ Label50: ;
 		Real64 Hfg;
 		Real64 AirVolumeFlowRate; // Air volume flow rate across the heating coil
 		Real64 VolFlowperRatedTotCap; // Air volume flow rate divided by rated total heating capacity
+		bool UsePerfMemo; // TRUE if full load performance may be reused (MemoizeDXCoilPerformance)
+		DXCoilPerfMemoData PerfMemo; // full load operating point at one speed
+
+		UsePerfMemo = MemoizeDXCoilPerformance && ! AnyEnergyManagementSystemInModel;
 
 		if ( DXCoil( DXCoilNum ).CondenserInletNodeNum( DXMode ) != 0 ) {
 			OutdoorPressure = Node( DXCoil( DXCoilNum ).CondenserInletNodeNum( DXMode ) ).Press;
@@ -10727,7 +10908,7 @@ Label50: ;
 						ShowContinueError( "Possible causes include inconsistent air flow rates in system components or" );
 						ShowContinueError( "inconsistent supply air fan operation modes in coil and unitary system objects." );
 					}
-					ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\" - Air volume flow rate per watt of rated total cooling capacity is out of range at speed " + TrimSigDigits( SpeedNumLS ) + " error continues...", DXCoil( DXCoilNum ).MSErrIndex( SpeedNumLS ), VolFlowperRatedTotCap, VolFlowperRatedTotCap );
+					ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\" - Air volume flow rate per watt of rated total cooling capacity is out of range at speed " + TrimSigDigits( SpeedNumLS ) + " error continues..."; }, DXCoil( DXCoilNum ).MSErrIndex( SpeedNumLS ), VolFlowperRatedTotCap, VolFlowperRatedTotCap );
 				}
 
 				// Check for valid air volume flow per rated total cooling capacity (200 - 500 cfm/ton) at high speed
@@ -10743,7 +10924,7 @@ Label50: ;
 						ShowContinueError( "Possible causes include inconsistent air flow rates in system components or" );
 						ShowContinueError( "inconsistent supply air fan operation modes in coil and unitary system objects." );
 					}
-					ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\" - Air volume flow rate per watt of rated total cooling capacity is out of range at speed " + TrimSigDigits( SpeedNumHS ) + " error continues...", DXCoil( DXCoilNum ).MSErrIndex( SpeedNumHS ), VolFlowperRatedTotCap, VolFlowperRatedTotCap );
+					ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\" - Air volume flow rate per watt of rated total cooling capacity is out of range at speed " + TrimSigDigits( SpeedNumHS ) + " error continues..."; }, DXCoil( DXCoilNum ).MSErrIndex( SpeedNumHS ), VolFlowperRatedTotCap, VolFlowperRatedTotCap );
 				}
 
 				// Adjust high speed coil bypass factor for actual maximum air flow rate.
@@ -10752,7 +10933,18 @@ Label50: ;
 				RatedCBFLS = DXCoil( DXCoilNum ).MSRatedCBF( SpeedNumLS );
 				CBFLS = AdjustCBF( RatedCBFLS, DXCoil( DXCoilNum ).MSRatedAirMassFlowRate( SpeedNumLS ), MSHPMassFlowRateLow );
 				// get low speed total capacity and SHR at current conditions
-				CalcTotCapSHR( InletAirDryBulbTemp, InletAirHumRat, InletAirEnthalpy, InletAirWetBulbC, AirMassFlowRatioLS, MSHPMassFlowRateLow, DXCoil( DXCoilNum ).MSRatedTotCap( SpeedNumLS ), CBFLS, DXCoil( DXCoilNum ).MSCCapFTemp( SpeedNumLS ), DXCoil( DXCoilNum ).MSCCapFFlow( SpeedNumLS ), TotCapLS, SHRLS, CondInletTemp, OutdoorPressure );
+				PerfMemo = DXCoilPerfMemoData( SpeedNumLS, DXCoil( DXCoilNum ).MSRatedTotCap( SpeedNumLS ), CBFLS, InletAirDryBulbTemp, InletAirWetBulbC, CondInletTemp, AirMassFlowRatioLS, MSHPMassFlowRateLow, OutdoorPressure );
+				if ( UsePerfMemo && FindDXCoilPerfMemo( DXCoilNum, PerfMemo ) ) {
+					TotCapLS = PerfMemo.TotCap;
+					SHRLS = PerfMemo.SHR;
+				} else {
+					CalcTotCapSHR( InletAirDryBulbTemp, InletAirHumRat, InletAirEnthalpy, InletAirWetBulbC, AirMassFlowRatioLS, MSHPMassFlowRateLow, DXCoil( DXCoilNum ).MSRatedTotCap( SpeedNumLS ), CBFLS, DXCoil( DXCoilNum ).MSCCapFTemp( SpeedNumLS ), DXCoil( DXCoilNum ).MSCCapFFlow( SpeedNumLS ), TotCapLS, SHRLS, CondInletTemp, OutdoorPressure );
+					if ( UsePerfMemo ) {
+						PerfMemo.TotCap = TotCapLS;
+						PerfMemo.SHR = SHRLS;
+						SaveDXCoilPerfMemo( DXCoilNum, PerfMemo );
+					}
+				}
 				// get low speed outlet conditions
 				hDelta = TotCapLS / MSHPMassFlowRateLow;
 				// Calculate new apparatus dew point conditions
@@ -10786,7 +10978,18 @@ Label50: ;
 
 				// get high speed total capacity and SHR at current conditions
 
-				CalcTotCapSHR( InletAirDryBulbTemp, InletAirHumRat, InletAirEnthalpy, InletAirWetBulbC, AirMassFlowRatioHS, MSHPMassFlowRateHigh, DXCoil( DXCoilNum ).MSRatedTotCap( SpeedNumHS ), CBFHS, DXCoil( DXCoilNum ).MSCCapFTemp( SpeedNumHS ), DXCoil( DXCoilNum ).MSCCapFFlow( SpeedNumHS ), TotCapHS, SHRHS, CondInletTemp, OutdoorPressure );
+				PerfMemo = DXCoilPerfMemoData( SpeedNumHS, DXCoil( DXCoilNum ).MSRatedTotCap( SpeedNumHS ), CBFHS, InletAirDryBulbTemp, InletAirWetBulbC, CondInletTemp, AirMassFlowRatioHS, MSHPMassFlowRateHigh, OutdoorPressure );
+				if ( UsePerfMemo && FindDXCoilPerfMemo( DXCoilNum, PerfMemo ) ) {
+					TotCapHS = PerfMemo.TotCap;
+					SHRHS = PerfMemo.SHR;
+				} else {
+					CalcTotCapSHR( InletAirDryBulbTemp, InletAirHumRat, InletAirEnthalpy, InletAirWetBulbC, AirMassFlowRatioHS, MSHPMassFlowRateHigh, DXCoil( DXCoilNum ).MSRatedTotCap( SpeedNumHS ), CBFHS, DXCoil( DXCoilNum ).MSCCapFTemp( SpeedNumHS ), DXCoil( DXCoilNum ).MSCCapFFlow( SpeedNumHS ), TotCapHS, SHRHS, CondInletTemp, OutdoorPressure );
+					if ( UsePerfMemo ) {
+						PerfMemo.TotCap = TotCapHS;
+						PerfMemo.SHR = SHRHS;
+						SaveDXCoilPerfMemo( DXCoilNum, PerfMemo );
+					}
+				}
 				hDelta = TotCapHS / MSHPMassFlowRateHigh;
 				// Calculate new apparatus dew point conditions
 				hADP = InletAirEnthalpy - hDelta / ( 1.0 - CBFHS );
@@ -10967,7 +11170,7 @@ Label50: ;
 						ShowContinueError( "Possible causes include inconsistent air flow rates in system components or" );
 						ShowContinueError( "inconsistent supply air fan operation modes in coil and unitary system objects." );
 					}
-					ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\" - Air volume flow rate per watt of rated total cooling capacity is out of range at speed " + TrimSigDigits( SpeedNumHS ) + " error continues...", DXCoil( DXCoilNum ).MSErrIndex( SpeedNumHS ), VolFlowperRatedTotCap, VolFlowperRatedTotCap );
+					ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\" - Air volume flow rate per watt of rated total cooling capacity is out of range at speed " + TrimSigDigits( SpeedNumHS ) + " error continues..."; }, DXCoil( DXCoilNum ).MSErrIndex( SpeedNumHS ), VolFlowperRatedTotCap, VolFlowperRatedTotCap );
 				}
 
 				if ( DXCoil( DXCoilNum ).CondenserType( SpeedNum ) == EvapCooled ) {
@@ -10982,7 +11185,18 @@ Label50: ;
 				// Adjust low speed coil bypass factor for actual flow rate.
 				// CBF = AdjustCBF(DXCoil(DXCoilNum)%RatedCBF2,DXCoil(DXCoilNum)%RatedAirMassFlowRate2,AirMassFlow)
 				// get low speed total capacity and SHR at current conditions
-				CalcTotCapSHR( InletAirDryBulbTemp, InletAirHumRat, InletAirEnthalpy, InletAirWetBulbC, AirMassFlowRatioLS, MSHPMassFlowRateHigh, DXCoil( DXCoilNum ).MSRatedTotCap( SpeedNum ), CBFLS, DXCoil( DXCoilNum ).MSCCapFTemp( SpeedNum ), DXCoil( DXCoilNum ).MSCCapFFlow( SpeedNum ), TotCapLS, SHRLS, CondInletTemp, OutdoorPressure );
+				PerfMemo = DXCoilPerfMemoData( SpeedNum, DXCoil( DXCoilNum ).MSRatedTotCap( SpeedNum ), CBFLS, InletAirDryBulbTemp, InletAirWetBulbC, CondInletTemp, AirMassFlowRatioLS, MSHPMassFlowRateHigh, OutdoorPressure );
+				if ( UsePerfMemo && FindDXCoilPerfMemo( DXCoilNum, PerfMemo ) ) {
+					TotCapLS = PerfMemo.TotCap;
+					SHRLS = PerfMemo.SHR;
+				} else {
+					CalcTotCapSHR( InletAirDryBulbTemp, InletAirHumRat, InletAirEnthalpy, InletAirWetBulbC, AirMassFlowRatioLS, MSHPMassFlowRateHigh, DXCoil( DXCoilNum ).MSRatedTotCap( SpeedNum ), CBFLS, DXCoil( DXCoilNum ).MSCCapFTemp( SpeedNum ), DXCoil( DXCoilNum ).MSCCapFFlow( SpeedNum ), TotCapLS, SHRLS, CondInletTemp, OutdoorPressure );
+					if ( UsePerfMemo ) {
+						PerfMemo.TotCap = TotCapLS;
+						PerfMemo.SHR = SHRLS;
+						SaveDXCoilPerfMemo( DXCoilNum, PerfMemo );
+					}
+				}
 				//  Eventually inlet air conditions will be used in DX Coil, these lines are commented out and marked with this comment line
 				//  Node(DXCoil(DXCoilNum)%AirInNode)%Press)
 				hDelta = TotCapLS / AirMassFlow;
@@ -11011,7 +11225,7 @@ Label50: ;
 						ShowContinueError( "PLF curve value must be = 1.0 and has been reset to 1.0. Simulation is continuing." );
 						ShowContinueErrorTimeStamp( "" );
 					}
-					ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).Name + "\": DX cooling coil PLF curve value <> 1.0 warning continues...", DXCoil( DXCoilNum ).PLFErrIndex, PLF, PLF );
+					ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).Name + "\": DX cooling coil PLF curve value <> 1.0 warning continues..."; }, DXCoil( DXCoilNum ).PLFErrIndex, PLF, PLF );
 					PLF = 1.0;
 				}
 
@@ -11412,7 +11626,7 @@ Label50: ;
 						ShowContinueError( "Possible causes include inconsistent air flow rates in system components or" );
 						ShowContinueError( "inconsistent supply air fan operation modes in coil and unitary system objects." );
 					}
-					ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\" - Air volume flow rate per watt of rated total heating capacity is out of range at speed " + TrimSigDigits( SpeedNumLS ) + " error continues...", DXCoil( DXCoilNum ).MSErrIndex( SpeedNumLS ), VolFlowperRatedTotCap, VolFlowperRatedTotCap );
+					ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\" - Air volume flow rate per watt of rated total heating capacity is out of range at speed " + TrimSigDigits( SpeedNumLS ) + " error continues..."; }, DXCoil( DXCoilNum ).MSErrIndex( SpeedNumLS ), VolFlowperRatedTotCap, VolFlowperRatedTotCap );
 				}
 
 				// Check for valid air volume flow per rated total cooling capacity (200 - 600 cfm/ton) at high speed
@@ -11428,7 +11642,7 @@ Label50: ;
 						ShowContinueError( "Possible causes include inconsistent air flow rates in system components or" );
 						ShowContinueError( "inconsistent supply air fan operation modes in coil and unitary system objects." );
 					}
-					ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\" - Air volume flow rate per watt of rated total heating capacity is out of range at speed " + TrimSigDigits( SpeedNumHS ) + " error continues...", DXCoil( DXCoilNum ).MSErrIndex( SpeedNumHS ), VolFlowperRatedTotCap, VolFlowperRatedTotCap );
+					ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\" - Air volume flow rate per watt of rated total heating capacity is out of range at speed " + TrimSigDigits( SpeedNumHS ) + " error continues..."; }, DXCoil( DXCoilNum ).MSErrIndex( SpeedNumHS ), VolFlowperRatedTotCap, VolFlowperRatedTotCap );
 				}
 
 				// Get total capacity modifying factor (function of temperature) for off-rated conditions
@@ -11553,7 +11767,7 @@ Label50: ;
 						ShowContinueError( "Check the IO reference manual for PLF curve guidance [Coil:Heating:DX:SingleSpeed]." );
 						ShowContinueErrorTimeStamp( "" );
 					}
-					ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).Name + ", DX heating coil runtime fraction > 1.0 warning continues...", DXCoil( DXCoilNum ).ErrIndex4, DXCoil( DXCoilNum ).HeatingCoilRuntimeFraction, DXCoil( DXCoilNum ).HeatingCoilRuntimeFraction );
+					ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).Name + ", DX heating coil runtime fraction > 1.0 warning continues..."; }, DXCoil( DXCoilNum ).ErrIndex4, DXCoil( DXCoilNum ).HeatingCoilRuntimeFraction, DXCoil( DXCoilNum ).HeatingCoilRuntimeFraction );
 					DXCoil( DXCoilNum ).HeatingCoilRuntimeFraction = 1.0; // Reset coil runtime fraction to 1.0
 				} else if ( DXCoil( DXCoilNum ).HeatingCoilRuntimeFraction > 1.0 ) {
 					DXCoil( DXCoilNum ).HeatingCoilRuntimeFraction = 1.0; // Reset coil runtime fraction to 1.0
@@ -11639,7 +11853,7 @@ Label50: ;
 						ShowContinueError( "Possible causes include inconsistent air flow rates in system components or" );
 						ShowContinueError( "inconsistent supply air fan operation modes in coil and unitary system objects." );
 					}
-					ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\" - Air volume flow rate per watt of rated total heating capacity is out of range error continues at speed 1...", DXCoil( DXCoilNum ).ErrIndex1, VolFlowperRatedTotCap, VolFlowperRatedTotCap );
+					ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\" - Air volume flow rate per watt of rated total heating capacity is out of range error continues at speed 1..."; }, DXCoil( DXCoilNum ).ErrIndex1, VolFlowperRatedTotCap, VolFlowperRatedTotCap );
 				}
 
 				// Get total capacity modifying factor (function of temperature) for off-rated conditions
@@ -11740,7 +11954,7 @@ Label50: ;
 						ShowContinueError( "PLF curve value must be = 1.0 and has been reset to 1.0. Simulation is continuing." );
 						ShowContinueErrorTimeStamp( "" );
 					}
-					ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).Name + "\": DX heating coil PLF curve value <> 1.0 warning continues...", DXCoil( DXCoilNum ).PLFErrIndex, PLF, PLF );
+					ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).Name + "\": DX heating coil PLF curve value <> 1.0 warning continues..."; }, DXCoil( DXCoilNum ).PLFErrIndex, PLF, PLF );
 					PLF = 1.0;
 				}
 
@@ -11763,7 +11977,7 @@ Label50: ;
 						ShowContinueError( "Check the IO reference manual for PLF curve guidance [Coil:Heating:DX:SingleSpeed]." );
 						ShowContinueErrorTimeStamp( "" );
 					}
-					ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).Name + ", DX heating coil runtime fraction > 1.0 warning continues...", DXCoil( DXCoilNum ).ErrIndex4, DXCoil( DXCoilNum ).HeatingCoilRuntimeFraction, DXCoil( DXCoilNum ).HeatingCoilRuntimeFraction );
+					ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).Name + ", DX heating coil runtime fraction > 1.0 warning continues..."; }, DXCoil( DXCoilNum ).ErrIndex4, DXCoil( DXCoilNum ).HeatingCoilRuntimeFraction, DXCoil( DXCoilNum ).HeatingCoilRuntimeFraction );
 					DXCoil( DXCoilNum ).HeatingCoilRuntimeFraction = 1.0; // Reset coil runtime fraction to 1.0
 				} else if ( DXCoil( DXCoilNum ).HeatingCoilRuntimeFraction > 1.0 ) {
 					DXCoil( DXCoilNum ).HeatingCoilRuntimeFraction = 1.0; // Reset coil runtime fraction to 1.0
@@ -14723,7 +14937,7 @@ Label50: ;
 					ShowContinueError( DXCoil( DXCoilNum ).LowAmbBuffer2 );
 					ShowContinueError( "... Operation at low inlet temperatures may require special performance curves." );
 				}
-				ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\" - Low condenser inlet temperature error continues...", DXCoil( DXCoilNum ).LowAmbErrIndex, DXCoil( DXCoilNum ).LowTempLast, DXCoil( DXCoilNum ).LowTempLast, _, "[C]", "[C]" );
+				ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\" - Low condenser inlet temperature error continues..."; }, DXCoil( DXCoilNum ).LowAmbErrIndex, DXCoil( DXCoilNum ).LowTempLast, DXCoil( DXCoilNum ).LowTempLast, _, "[C]", "[C]" );
 			}
 		}
 
@@ -14734,7 +14948,7 @@ Label50: ;
 					ShowContinueError( DXCoil( DXCoilNum ).HighAmbBuffer2 );
 					ShowContinueError( "... Operation at high inlet temperatures may require special performance curves." );
 				}
-				ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\" - High condenser inlet temperature error continues...", DXCoil( DXCoilNum ).HighAmbErrIndex, DXCoil( DXCoilNum ).HighTempLast, DXCoil( DXCoilNum ).HighTempLast, _, "[C]", "[C]" );
+				ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\" - High condenser inlet temperature error continues..."; }, DXCoil( DXCoilNum ).HighAmbErrIndex, DXCoil( DXCoilNum ).HighTempLast, DXCoil( DXCoilNum ).HighTempLast, _, "[C]", "[C]" );
 			}
 		}
 
@@ -14748,7 +14962,7 @@ Label50: ;
 					ShowContinueError( "   2) may have a low air flow rate per watt of cooling capacity. Check inputs." );
 					ShowContinueError( "   3) is used as part of a HX assisted cooling coil which uses a high sensible effectiveness. Check inputs." );
 				}
-				ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\" - Full load outlet temperature indicates a possibility of frost/freeze error continues. Outlet air temperature statistics follow:", DXCoil( DXCoilNum ).LowOutletTempIndex, DXCoil( DXCoilNum ).FullLoadOutAirTempLast, DXCoil( DXCoilNum ).FullLoadOutAirTempLast );
+				ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).DXCoilType + " \"" + DXCoil( DXCoilNum ).Name + "\" - Full load outlet temperature indicates a possibility of frost/freeze error continues. Outlet air temperature statistics follow:"; }, DXCoil( DXCoilNum ).LowOutletTempIndex, DXCoil( DXCoilNum ).FullLoadOutAirTempLast, DXCoil( DXCoilNum ).FullLoadOutAirTempLast );
 			}
 		}
 
@@ -14847,7 +15061,7 @@ Label50: ;
 					ShowContinueErrorTimeStamp( "PLF curve values must be >= 0.7. PLF has been reset to 0.7 and simulation is continuing." );
 					ShowContinueError( "Check the IO reference manual for PLF curve guidance [Coil:Cooling:DX:SingleSpeed]." );
 				}
-				ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).Name + ", DX cooling coil PLF curve < 0.7 warning continues...", DXCoil( DXCoilNum ).ErrIndex2, PLF, PLF );
+				ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).Name + ", DX cooling coil PLF curve < 0.7 warning continues..."; }, DXCoil( DXCoilNum ).ErrIndex2, PLF, PLF );
 				PLF = 0.7;
 			}
 
@@ -14860,7 +15074,7 @@ Label50: ;
 					ShowContinueError( "Check the IO reference manual for PLF curve guidance [Coil:Cooling:DX:SingleSpeed]." );
 					ShowContinueErrorTimeStamp( "" );
 				}
-				ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).Name + ", DX cooling coil runtime fraction > 1.0 warning continues...", DXCoil( DXCoilNum ).ErrIndex3, DXCoil( DXCoilNum ).CoolingCoilRuntimeFraction, DXCoil( DXCoilNum ).CoolingCoilRuntimeFraction );
+				ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).Name + ", DX cooling coil runtime fraction > 1.0 warning continues..."; }, DXCoil( DXCoilNum ).ErrIndex3, DXCoil( DXCoilNum ).CoolingCoilRuntimeFraction, DXCoil( DXCoilNum ).CoolingCoilRuntimeFraction );
 				DXCoil( DXCoilNum ).CoolingCoilRuntimeFraction = 1.0; // Reset coil runtime fraction to 1.0
 			} else if ( DXCoil( DXCoilNum ).CoolingCoilRuntimeFraction > 1.0 ) {
 				DXCoil( DXCoilNum ).CoolingCoilRuntimeFraction = 1.0; // Reset coil runtime fraction to 1.0
@@ -15183,7 +15397,7 @@ Label50: ;
 					ShowContinueError( "Check the IO reference manual for PLF curve guidance [Coil:Heating:DX:SingleSpeed]." );
 					ShowContinueErrorTimeStamp( "" );
 				}
-				ShowRecurringWarningErrorAtEnd( DXCoil( DXCoilNum ).Name + ", DX heating coil runtime fraction > 1.0 warning continues...", DXCoil( DXCoilNum ).ErrIndex4, DXCoil( DXCoilNum ).HeatingCoilRuntimeFraction, DXCoil( DXCoilNum ).HeatingCoilRuntimeFraction );
+				ShowRecurringWarningErrorAtEnd( [&]() { return DXCoil( DXCoilNum ).Name + ", DX heating coil runtime fraction > 1.0 warning continues..."; }, DXCoil( DXCoilNum ).ErrIndex4, DXCoil( DXCoilNum ).HeatingCoilRuntimeFraction, DXCoil( DXCoilNum ).HeatingCoilRuntimeFraction );
 				DXCoil( DXCoilNum ).HeatingCoilRuntimeFraction = 1.0; // Reset coil runtime fraction to 1.0
 			} else if ( DXCoil( DXCoilNum ).HeatingCoilRuntimeFraction > 1.0 ) {
 				DXCoil( DXCoilNum ).HeatingCoilRuntimeFraction = 1.0; // Reset coil runtime fraction to 1.0
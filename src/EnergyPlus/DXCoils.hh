@@ -111,6 +111,7 @@ namespace DXCoils {
 	extern int const MaxCapacityStages; // Maximum number of capacity stages supported
 	extern int const MaxDehumidModes; // Maximum number of enhanced dehumidification modes supported
 	extern int const MaxModes; // Maximum number of performance modes
+	extern int const DXCoilPerfMemoSize; // Number of full load operating points remembered per DX coil
 
 	//Water Systems
 	extern int const CondensateDiscarded; // default mode where water is "lost"
@@ -184,6 +185,71 @@ namespace DXCoils {
 
 	// Types
 
+	struct DXCoilPerfMemoData
+	{
+		// Members
+		// Full load capacity and SHR of a DX cooling coil at one operating point, reused when the
+		// same point is evaluated again (see MemoizeDXCoilPerformance)
+		int Mode; // performance mode or speed number (0 = unused entry)
+		Real64 TotCapNom; // nominal total capacity for this mode or speed [W]
+		Real64 CBF; // coil bypass factor at the actual flow
+		Real64 InletDryBulb; // inlet air dry-bulb temperature [C]
+		Real64 InletWetBulb; // inlet air wet-bulb temperature [C]
+		Real64 CondInletTemp; // condenser inlet temperature [C]
+		Real64 AirMassFlowRatio; // ratio of actual to rated air mass flow
+		Real64 AirMassFlow; // air mass flow through the coil [kg/s]
+		Real64 Pressure; // air pressure [Pa]
+		Real64 TotCap; // full load total capacity [W]
+		Real64 SHR; // full load sensible heat ratio
+		Real64 DryCoilWetBulb; // inlet wet-bulb at the end of the dry coil iteration [C]
+		int DryCoilIter; // number of dry coil iterations
+
+		// Default Constructor
+		DXCoilPerfMemoData() :
+			Mode( 0 ),
+			TotCapNom( 0.0 ),
+			CBF( 0.0 ),
+			InletDryBulb( 0.0 ),
+			InletWetBulb( 0.0 ),
+			CondInletTemp( 0.0 ),
+			AirMassFlowRatio( 0.0 ),
+			AirMassFlow( 0.0 ),
+			Pressure( 0.0 ),
+			TotCap( 0.0 ),
+			SHR( 0.0 ),
+			DryCoilWetBulb( 0.0 ),
+			DryCoilIter( 0 )
+		{}
+
+		// Member Constructor
+		DXCoilPerfMemoData(
+			int const Mode, // performance mode or speed number
+			Real64 const TotCapNom, // nominal total capacity [W]
+			Real64 const CBF, // coil bypass factor
+			Real64 const InletDryBulb, // inlet air dry-bulb temperature [C]
+			Real64 const InletWetBulb, // inlet air wet-bulb temperature [C]
+			Real64 const CondInletTemp, // condenser inlet temperature [C]
+			Real64 const AirMassFlowRatio, // ratio of actual to rated air mass flow
+			Real64 const AirMassFlow, // air mass flow through the coil [kg/s]
+			Real64 const Pressure // air pressure [Pa]
+		) :
+			Mode( Mode ),
+			TotCapNom( TotCapNom ),
+			CBF( CBF ),
+			InletDryBulb( InletDryBulb ),
+			InletWetBulb( InletWetBulb ),
+			CondInletTemp( CondInletTemp ),
+			AirMassFlowRatio( AirMassFlowRatio ),
+			AirMassFlow( AirMassFlow ),
+			Pressure( Pressure ),
+			TotCap( 0.0 ),
+			SHR( 0.0 ),
+			DryCoilWetBulb( InletWetBulb ),
+			DryCoilIter( 0 )
+		{}
+
+	};
+
 	struct DXCoilData
 	{
 		// Members
@@ -522,6 +588,12 @@ namespace DXCoils {
 		Real64 ActualSH; // Actual superheating degrees [C]
 		Real64 ActualSC; // Actual subcooling degrees [C]
 
+		// Full load performance memo (MemoizeDXCoilPerformance)
+		Array1D< DXCoilPerfMemoData > PerfMemo; // remembered full load operating points
+		int PerfMemoNext; // next entry of PerfMemo to overwrite
+		int PerfMemoHits; // number of full load evaluations taken from PerfMemo
+		int PerfMemoMisses; // number of full load evaluations calculated
+
 		// Default Constructor
 		DXCoilData() :
 			DXCoilType_Num( 0 ),
@@ -757,7 +829,10 @@ namespace DXCoils {
 			SH( 0.0 ),
 			SC( 0.0 ),
 			ActualSH( 0.0 ),
-			ActualSC( 0.0 )
+			ActualSC( 0.0 ),
+			PerfMemoNext( 1 ),
+			PerfMemoHits( 0 ),
+			PerfMemoMisses( 0 )
 		{}
 
 	};
@@ -955,6 +1030,21 @@ namespace DXCoils {
 		Real64 const Pressure // air pressure [Pa]
 	);
 
+	bool
+	FindDXCoilPerfMemo(
+		int const DXCoilNum, // the number of the DX coil
+		DXCoilPerfMemoData & Memo // operating point to look up; results are filled in when found
+	);
+
+	void
+	SaveDXCoilPerfMemo(
+		int const DXCoilNum, // the number of the DX coil
+		DXCoilPerfMemoData const & Memo // operating point and its full load results
+	);
+
+	void
+	ReportDXCoilPerfMemo();
+
 	void
 	CalcMultiSpeedDXCoilCooling(
 		int const DXCoilNum, // the number of the DX heating coil to be simulated
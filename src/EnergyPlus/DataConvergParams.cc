@@ -141,6 +141,8 @@ namespace DataConvergParams {
 	Real64 MinTimeStepTol( 1.0e-4 ); // = min allowable for ABS(1.-TimeStepSys/(MinTimeStepSys))
 	Real64 MaxZoneTempDiff( 0.3 ); // 0.3 C = (1% OF 300 C) = max allowable difference between
 	//   zone air temp at Time=T and Time=T-1
+	Real64 ZoneTempErrorTol( 0.0 ); // max estimated zone air temp truncation error per zone timestep [C]
+	//   (0 = shorten the system timestep with MaxZoneTempDiff only, otherwise used in place of MaxZoneTempDiff)
 	Real64 MinSysTimeRemaining( ( 1.0 / 3600.0 ) ); // = 1 second
 	int MaxIter( 20 ); // maximum number of iterations allowed
 
@@ -159,6 +161,7 @@ namespace DataConvergParams {
 		MinTimeStepSys = ( 1.0 / 60.0 ) ; // =1 minute
 		MinTimeStepTol = 1.0e-4 ; // = min allowable for ABS(1.-TimeStepSys/(MinTimeStepSys))
 		MaxZoneTempDiff = 0.3 ; // 0.3 C = (1% OF 300 C) = max allowable difference between
+		ZoneTempErrorTol = 0.0 ; // max estimated zone air temp truncation error per zone timestep [C]
 		MinSysTimeRemaining = ( 1.0 / 3600.0 ) ; // = 1 second
 		MaxIter = 20 ; // maximum number of iterations allowed
 		MaxPlantSubIterations = 8 ; // Iteration Max for Plant Simulation sub iterations
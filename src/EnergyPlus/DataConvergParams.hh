@@ -138,6 +138,8 @@ namespace DataConvergParams {
 	extern Real64 MinTimeStepTol; // = min allowable for ABS(1.-TimeStepSys/(MinTimeStepSys))
 	extern Real64 MaxZoneTempDiff; // 0.3 C = (1% OF 300 C) = max allowable difference between
 	//   zone air temp at Time=T and Time=T-1
+	extern Real64 ZoneTempErrorTol; // max estimated zone air temp truncation error per zone timestep [C]
+	//   (0 = shorten the system timestep with MaxZoneTempDiff only, otherwise used in place of MaxZoneTempDiff)
 	extern Real64 MinSysTimeRemaining; // = 1 second
 	extern int MaxIter; // maximum number of iterations allowed
 
@@ -59,6 +59,9 @@
 #ifndef DataErrorTracking_hh_INCLUDED
 #define DataErrorTracking_hh_INCLUDED
 
+// C++ Headers
+#include <vector>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
 
@@ -147,6 +150,7 @@ namespace DataErrorTracking {
 		bool ReportMax; // Flag to report max value
 		bool ReportMin; // Flag to report min value
 		bool ReportSum; // Flag to report sum value
+		std::vector< int > SearchMatches; // MessageSearch entries found in Message, counted again on each repeat
 
 		// Default Constructor
 		RecurringErrorData() :
@@ -131,25 +131,27 @@ namespace DataLoopNode {
 	struct NodeData
 	{
 		// Members
+		// The state most components read and write every iteration is grouped first so that
+		// it is contiguous in memory; the remaining fields are touched far less often.
+		Real64 Temp; // {C}
+		Real64 MassFlowRate; // {kg/s}
+		Real64 MassFlowRateMinAvail; // {kg/s}
+		Real64 MassFlowRateMaxAvail; // {kg/s}
+		Real64 Enthalpy; // {J/kg}
+		Real64 HumRat; // {}
+		Real64 Press; // {Pa}
+		Real64 Quality; // {0.0-1.0 vapor fraction/percent}
 		int FluidType; // must be one of the valid parameters
 		int FluidIndex; // For Fluid Properties
-		Real64 Temp; // {C}
 		Real64 TempMin; // {C}
 		Real64 TempMax; // {C}
 		Real64 TempSetPoint; // {C}
 		Real64 TempLastTimestep; // [C}   DSU
 		Real64 MassFlowRateRequest; // {kg/s}  DSU
-		Real64 MassFlowRate; // {kg/s}
 		Real64 MassFlowRateMin; // {kg/s}
 		Real64 MassFlowRateMax; // {kg/s}
-		Real64 MassFlowRateMinAvail; // {kg/s}
-		Real64 MassFlowRateMaxAvail; // {kg/s}
 		Real64 MassFlowRateSetPoint; // {kg/s}
-		Real64 Quality; // {0.0-1.0 vapor fraction/percent}
-		Real64 Press; // {Pa}
-		Real64 Enthalpy; // {J/kg}
 		Real64 EnthalpyLastTimestep; // {J/kg}  DSU for steam?
-		Real64 HumRat; // {}
 		Real64 HumRatMin; // {}
 		Real64 HumRatMax; // {}
 		Real64 HumRatSetPoint; // {}
@@ -172,25 +174,25 @@ namespace DataLoopNode {
 
 		// Default Constructor
 		NodeData() :
+			Temp( 0.0 ),
+			MassFlowRate( 0.0 ),
+			MassFlowRateMinAvail( 0.0 ),
+			MassFlowRateMaxAvail( 0.0 ),
+			Enthalpy( 0.0 ),
+			HumRat( 0.0 ),
+			Press( 0.0 ),
+			Quality( 0.0 ),
 			FluidType( 0 ),
 			FluidIndex( 0 ),
-			Temp( 0.0 ),
 			TempMin( 0.0 ),
 			TempMax( 0.0 ),
 			TempSetPoint( SensedNodeFlagValue ),
 			TempLastTimestep( 0.0 ),
 			MassFlowRateRequest( 0.0 ),
-			MassFlowRate( 0.0 ),
 			MassFlowRateMin( 0.0 ),
 			MassFlowRateMax( SensedNodeFlagValue ),
-			MassFlowRateMinAvail( 0.0 ),
-			MassFlowRateMaxAvail( 0.0 ),
 			MassFlowRateSetPoint( 0.0 ),
-			Quality( 0.0 ),
-			Press( 0.0 ),
-			Enthalpy( 0.0 ),
 			EnthalpyLastTimestep( 0.0 ),
-			HumRat( 0.0 ),
 			HumRatMin( SensedNodeFlagValue ),
 			HumRatMax( SensedNodeFlagValue ),
 			HumRatSetPoint( SensedNodeFlagValue ),
@@ -249,25 +251,25 @@ namespace DataLoopNode {
 			Real64 const GenContamSetPoint, // {ppm}
 			bool const SPMNodeWetBulbRepReq // Set to true when node has SPM which follows wetbulb
 		) :
+			Temp( Temp ),
+			MassFlowRate( MassFlowRate ),
+			MassFlowRateMinAvail( MassFlowRateMinAvail ),
+			MassFlowRateMaxAvail( MassFlowRateMaxAvail ),
+			Enthalpy( Enthalpy ),
+			HumRat( HumRat ),
+			Press( Press ),
+			Quality( Quality ),
 			FluidType( FluidType ),
 			FluidIndex( FluidIndex ),
-			Temp( Temp ),
 			TempMin( TempMin ),
 			TempMax( TempMax ),
 			TempSetPoint( TempSetPoint ),
 			TempLastTimestep( TempLastTimestep ),
 			MassFlowRateRequest( MassFlowRateRequest ),
-			MassFlowRate( MassFlowRate ),
 			MassFlowRateMin( MassFlowRateMin ),
 			MassFlowRateMax( MassFlowRateMax ),
-			MassFlowRateMinAvail( MassFlowRateMinAvail ),
-			MassFlowRateMaxAvail( MassFlowRateMaxAvail ),
 			MassFlowRateSetPoint( MassFlowRateSetPoint ),
-			Quality( Quality ),
-			Press( Press ),
-			Enthalpy( Enthalpy ),
 			EnthalpyLastTimestep( EnthalpyLastTimestep ),
-			HumRat( HumRat ),
 			HumRatMin( HumRatMin ),
 			HumRatMax( HumRatMax ),
 			HumRatSetPoint( HumRatSetPoint ),
@@ -664,6 +664,8 @@ namespace DataPlant {
 		int PressureCurveType; // Either none, pressure curve, or generic curve
 		int PressureCurveIndex; // Curve: index for pressure drop calculations
 		Real64 PressureEffectiveK;
+		bool IdleInUnlockedPass; // true if the branch carried no flow at the end of the flow unlocked pass
+		Real64 IdleInletTemp; // branch inlet temperature at the end of the flow unlocked pass [C]
 
 		// Default Constructor
 		BranchData() :
@@ -688,7 +690,9 @@ namespace DataPlant {
 			PressureDrop( 0.0 ),
 			PressureCurveType( 0 ),
 			PressureCurveIndex( 0 ),
-			PressureEffectiveK( 0.0 )
+			PressureEffectiveK( 0.0 ),
+			IdleInUnlockedPass( false ),
+			IdleInletTemp( 0.0 )
 		{}
 
 		// Max abs of Comp array MyLoad values //Autodesk:Tuned For replacement of any( abs( Comp.MyLoad() > SmallLoad ) usage
@@ -475,6 +475,15 @@ namespace DataSurfaces {
 	Array1D< Real64 > WinGapConvHtFlowRepEnergy; // Energy of WinGapConvHtFlowRep [J]
 	Array1D< Real64 > WinHeatTransferRepEnergy; // Energy of WinHeatTransfer [J]
 
+	// Surface fields used by every per-timestep surface loop, split out of SurfaceData into
+	// contiguous arrays indexed by surface number (see SetupSurfaceHotArrays)
+	Array1D_bool SurfHeatTransSurf; // True if the surface is a heat transfer surface
+	Array1D_int SurfZone; // Zone the surface is part of (0 for shading surfaces)
+	Array1D_int SurfClass; // Surface class (SurfaceClass_Wall, SurfaceClass_Window, ...)
+	Array1D_int SurfExtBoundCond; // Outside boundary condition (see Surface%ExtBoundCond)
+	Array1D_int SurfHeatTransferAlgorithm; // Conduction model (HeatTransferModel_CTF, ...)
+	Array1D< Real64 > SurfArea; // Surface area (glazed area for windows) [m2]
+
 	// SUBROUTINE SPECIFICATIONS FOR MODULE DataSurfaces:
 
 	// Object Data
@@ -881,6 +890,12 @@ namespace DataSurfaces {
 		WinShadingAbsorbedSolarEnergy.deallocate();
 		WinGapConvHtFlowRepEnergy.deallocate();
 		WinHeatTransferRepEnergy.deallocate();
+		SurfHeatTransSurf.deallocate();
+		SurfZone.deallocate();
+		SurfClass.deallocate();
+		SurfExtBoundCond.deallocate();
+		SurfHeatTransferAlgorithm.deallocate();
+		SurfArea.deallocate();
 		Surface.deallocate();
 		SurfaceWindow.deallocate();
 		FrameDivider.deallocate();
@@ -896,6 +911,31 @@ namespace DataSurfaces {
 		FenLayAbsSSG.deallocate();
 	}
 
+	void
+	SetupSurfaceHotArrays()
+	{
+		// Copies the surface fields read by the per-timestep heat balance loops into contiguous
+		// arrays so those loops do not stride over the full SurfaceData records.  Must be called
+		// after geometry input and daylighting device setup, which are the last places these
+		// fields are modified.
+
+		SurfHeatTransSurf.dimension( TotSurfaces, false );
+		SurfZone.dimension( TotSurfaces, 0 );
+		SurfClass.dimension( TotSurfaces, 0 );
+		SurfExtBoundCond.dimension( TotSurfaces, 0 );
+		SurfHeatTransferAlgorithm.dimension( TotSurfaces, 0 );
+		SurfArea.dimension( TotSurfaces, 0.0 );
+		for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			auto const & surface( Surface( SurfNum ) );
+			SurfHeatTransSurf( SurfNum ) = surface.HeatTransSurf;
+			SurfZone( SurfNum ) = surface.Zone;
+			SurfClass( SurfNum ) = surface.Class;
+			SurfExtBoundCond( SurfNum ) = surface.ExtBoundCond;
+			SurfHeatTransferAlgorithm( SurfNum ) = surface.HeatTransferAlgorithm;
+			SurfArea( SurfNum ) = surface.Area;
+		}
+	}
+
 	void
 	SetSurfaceOutBulbTempAt()
 	{
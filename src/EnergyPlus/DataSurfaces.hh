@@ -476,6 +476,15 @@ namespace DataSurfaces {
 	extern Array1D< Real64 > WinGapConvHtFlowRepEnergy; // Energy of WinGapConvHtFlowRep [J]
 	extern Array1D< Real64 > WinHeatTransferRepEnergy; // Energy of WinHeatTransfer [J]
 
+	// Surface fields used by every per-timestep surface loop, split out of SurfaceData into
+	// contiguous arrays indexed by surface number (see SetupSurfaceHotArrays)
+	extern Array1D_bool SurfHeatTransSurf; // True if the surface is a heat transfer surface
+	extern Array1D_int SurfZone; // Zone the surface is part of (0 for shading surfaces)
+	extern Array1D_int SurfClass; // Surface class (SurfaceClass_Wall, SurfaceClass_Window, ...)
+	extern Array1D_int SurfExtBoundCond; // Outside boundary condition (see Surface%ExtBoundCond)
+	extern Array1D_int SurfHeatTransferAlgorithm; // Conduction model (HeatTransferModel_CTF, ...)
+	extern Array1D< Real64 > SurfArea; // Surface area (glazed area for windows) [m2]
+
 	// SUBROUTINE SPECIFICATIONS FOR MODULE DataSurfaces:
 
 	// Types
@@ -1831,6 +1840,9 @@ namespace DataSurfaces {
 	void
 	clear_state();
 
+	void
+	SetupSurfaceHotArrays();
+
 	void
 	SetSurfaceOutBulbTempAt();
 
@@ -137,6 +137,16 @@ namespace DataSystemVariables {
 	std::string const cInputPath2( "input_path" ); // RunEplus.bat setting.  Full path
 	std::string const cProgramPath( "program_path" );
 	std::string const cTimingFlag( "TimingFlag" );
+	std::string const cWarmStartControllers( "WarmStartControllers" ); // To start water coil controllers from their previous solution
+	std::string const cSkipQuiescentHVAC( "SkipQuiescentHVAC" ); // To skip the HVAC simulation while the system is idle
+	std::string const cSkipConvergedAirLoops( "SkipConvergedAirLoops" ); // To skip air loop groups that have converged
+	std::string const cSkipIdlePlantBranches( "SkipIdlePlantBranches" ); // To skip idle parallel plant branches once flow is locked
+	std::string const cMemoizeDXCoilPerformance( "MemoizeDXCoilPerformance" ); // To reuse DX coil full load performance at repeated conditions
+	std::string const cDXCoilMemoTolerance( "DXCoilMemoTolerance" ); // Matching tolerance for reused DX coil performance
+	std::string const cTabulateFanPowerCurves( "TabulateFanPowerCurves" ); // To interpolate Fan:SystemModel power curves from a table
+	std::string const cCondFDLayerDirectSolve( "CondFDLayerDirectSolve" ); // To solve CondFD layer interior nodes together
+	std::string const cHAMTDirectSolve( "HAMTDirectSolve" ); // To solve HAMT surface cells together
+	std::string const cSampleIllumMapsHourly( "SampleIllumMapsHourly" ); // To calculate illuminance maps once per hour
 	std::string const TrackAirLoopEnvVar( "TRACK_AIRLOOP" ); // To generate a file with runtime statistics
 	// for each controller on each air loop
 	std::string const TraceAirLoopEnvVar( "TRACE_AIRLOOP" ); // To generate a trace file with the converged
@@ -159,6 +169,16 @@ namespace DataSystemVariables {
 	bool FullAnnualRun( false ); // TRUE if full annual simulation is to be run.
 	bool DeveloperFlag( false ); // TRUE if developer flag is turned on. (turns on more displays to console)
 	bool TimingFlag( false ); // TRUE if timing flag is turned on. (turns on more timing displays to console)
+	bool WarmStartControllers( false ); // TRUE if controllers start from the active solution saved at the last call to SimAirLoop
+	bool SkipQuiescentHVAC( false ); // TRUE if system timesteps with an idle HVAC system carry the previous HVAC state
+	bool SkipConvergedAirLoops( false ); // TRUE if independent air loop groups are not resimulated once converged
+	bool SkipIdlePlantBranches( false ); // TRUE if idle parallel plant branches are not resimulated once flow is locked
+	bool MemoizeDXCoilPerformance( false ); // TRUE if DX coils reuse full load capacity and SHR at repeated inlet conditions
+	Real64 DXCoilMemoTolerance( 0.0 ); // Matching tolerance for reused DX coil performance (C and flow fraction); 0 = exact
+	bool TabulateFanPowerCurves( false ); // TRUE if Fan:SystemModel power fraction curves are interpolated from a precomputed table
+	bool CondFDLayerDirectSolve( false ); // TRUE if CondFD solves the interior nodes of each layer with a tridiagonal solve in each iteration
+	bool HAMTDirectSolve( false ); // TRUE if HAMT solves the temperatures and humidities of a surface's cells with tridiagonal solves in each iteration
+	bool SampleIllumMapsHourly( false ); // TRUE if illuminance maps are calculated at the mid-hour time step only and that sample is reported for the hour
 	bool SutherlandHodgman( true ); // TRUE if SutherlandHodgman algorithm for polygon clipping is to be used.
 	bool DetailedSkyDiffuseAlgorithm( false ); // use detailed diffuse shading algorithm for sky (shading transmittance varies)
 	bool DetailedSolarTimestepIntegration( false ); // when true, use detailed timestep integration for all solar,shading, etc.
@@ -106,6 +106,16 @@ namespace DataSystemVariables {
 	extern std::string const cInputPath2; // RunEplus.bat setting.  Full path
 	extern std::string const cProgramPath;
 	extern std::string const cTimingFlag;
+	extern std::string const cWarmStartControllers; // To start water coil controllers from their previous solution
+	extern std::string const cSkipQuiescentHVAC; // To skip the HVAC simulation while the system is idle
+	extern std::string const cSkipConvergedAirLoops; // To skip air loop groups that have converged
+	extern std::string const cSkipIdlePlantBranches; // To skip idle parallel plant branches once flow is locked
+	extern std::string const cMemoizeDXCoilPerformance; // To reuse DX coil full load performance at repeated conditions
+	extern std::string const cDXCoilMemoTolerance; // Matching tolerance for reused DX coil performance
+	extern std::string const cTabulateFanPowerCurves; // To interpolate Fan:SystemModel power curves from a table
+	extern std::string const cCondFDLayerDirectSolve; // To solve CondFD layer interior nodes together
+	extern std::string const cHAMTDirectSolve; // To solve HAMT surface cells together
+	extern std::string const cSampleIllumMapsHourly; // To calculate illuminance maps once per hour
 	extern std::string const TrackAirLoopEnvVar; // To generate a file with runtime statistics
 	// for each controller on each air loop
 	extern std::string const TraceAirLoopEnvVar; // To generate a trace file with the converged
@@ -128,6 +138,16 @@ namespace DataSystemVariables {
 	extern bool FullAnnualRun; // TRUE if full annual simulation is to be run.
 	extern bool DeveloperFlag; // TRUE if developer flag is turned on. (turns on more displays to console)
 	extern bool TimingFlag; // TRUE if timing flag is turned on. (turns on more timing displays to console)
+	extern bool WarmStartControllers; // TRUE if controllers start from the active solution saved at the last call to SimAirLoop
+	extern bool SkipQuiescentHVAC; // TRUE if system timesteps with an idle HVAC system carry the previous HVAC state
+	extern bool SkipConvergedAirLoops; // TRUE if independent air loop groups are not resimulated once converged
+	extern bool SkipIdlePlantBranches; // TRUE if idle parallel plant branches are not resimulated once flow is locked
+	extern bool MemoizeDXCoilPerformance; // TRUE if DX coils reuse full load capacity and SHR at repeated inlet conditions
+	extern Real64 DXCoilMemoTolerance; // Matching tolerance for reused DX coil performance (C and flow fraction); 0 = exact
+	extern bool TabulateFanPowerCurves; // TRUE if Fan:SystemModel power fraction curves are interpolated from a precomputed table
+	extern bool CondFDLayerDirectSolve; // TRUE if CondFD solves the interior nodes of each layer with a tridiagonal solve in each iteration
+	extern bool HAMTDirectSolve; // TRUE if HAMT solves the temperatures and humidities of a surface's cells with tridiagonal solves in each iteration
+	extern bool SampleIllumMapsHourly; // TRUE if illuminance maps are calculated at the mid-hour time step only and that sample is reported for the hour
 	extern bool SutherlandHodgman; // TRUE if SutherlandHodgman algorithm for polygon clipping is to be used.
 	extern bool DetailedSkyDiffuseAlgorithm; // use detailed diffuse shading algorithm for sky (shading transmittance varies)
 	extern bool DetailedSolarTimestepIntegration; // when true, use detailed timestep integration for all solar,shading, etc.
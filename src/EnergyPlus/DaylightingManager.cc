@@ -3037,7 +3037,7 @@ namespace DaylightingManager {
 
 					// Check octree surface candidates until a hit is found, if any
 					Vector3< Real64 > const URay_inv( SurfaceOctreeCube::safe_inverse( URay ) );
-					surfaceOctree.hasSurfaceRayIntersectsCube( GroundHitPt, URay, URay_inv, surfaceHit );
+					obstructionOctree.hasSurfaceRayIntersectsCube( GroundHitPt, URay, URay_inv, surfaceHit );
 
 				}
 
@@ -5468,7 +5468,7 @@ namespace DaylightingManager {
 
 			// Lambda function for the octree to test for surface hit and update transmittance if hit
 			auto solarTransmittance = [=,&R1,&RN,&hit,&ObTrans]( SurfaceData const & surface ) -> bool {
-				if ( ! surface.ShadowSurfPossibleObstruction ) return false; //Do Consider separate octree without filtered surfaces
+				if ( ! surface.ShadowSurfPossibleObstruction ) return false;
 				auto const sClass( surface.Class );
 				if ( ( sClass == SurfaceClass_Wall || sClass == SurfaceClass_Roof || sClass == SurfaceClass_Floor ) && ( &surface != window_base_p ) ) {
 					PierceSurface( surface, R1, RN, HP, hit );
@@ -5495,7 +5495,7 @@ namespace DaylightingManager {
 
 			// Check octree surface candidates for hits: short circuits if zero transmittance reached
 			Vector3< Real64 > const RN_inv( SurfaceOctreeCube::safe_inverse( RN ) );
-			surfaceOctree.processSomeSurfaceRayIntersectsCube( R1, RN, RN_inv, solarTransmittance );
+			obstructionOctree.processSomeSurfaceRayIntersectsCube( R1, RN, RN_inv, solarTransmittance );
 
 		}
 
@@ -6561,6 +6561,7 @@ namespace DaylightingManager {
 
 		// Using/Aliasing
 		using ScheduleManager::GetCurrentScheduleValue;
+		using DataSystemVariables::SampleIllumMapsHourly;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -6678,7 +6679,12 @@ namespace DaylightingManager {
 			for ( ILM = 1; ILM <= ZoneDaylight( ZoneNum ).MapCount; ++ILM ) {
 				MapNum = ZoneDaylight( ZoneNum ).ZoneToMap( ILM );
 				for ( IL = 1; IL <= IllumMapCalc( MapNum ).TotalMapRefPoints; ++IL ) {
-					IllumMapCalc( MapNum ).DaylIllumAtMapPtHr( IL ) += IllumMapCalc( MapNum ).DaylIllumAtMapPt( IL ) / double( NumOfTimeStepInHour );
+					if ( SampleIllumMapsHourly && NumOfTimeStepInHour > 1 ) {
+						// The map was only calculated at the mid-hour time step; report that sample for the hour
+						if ( TimeStep == NumOfTimeStepInHour ) IllumMapCalc( MapNum ).DaylIllumAtMapPtHr( IL ) = IllumMapCalc( MapNum ).DaylIllumAtMapPt( IL );
+					} else {
+						IllumMapCalc( MapNum ).DaylIllumAtMapPtHr( IL ) += IllumMapCalc( MapNum ).DaylIllumAtMapPt( IL ) / double( NumOfTimeStepInHour );
+					}
 					if ( IllumMapCalc( MapNum ).DaylIllumAtMapPtHr( IL ) > 0.0 ) {
 						mapResultsToReport = true;
 						mapResultsReported = true;
@@ -8534,9 +8540,10 @@ namespace DaylightingManager {
 		} else { // Surface octree search
 
 			SurfaceData const * nearestHitSurface( nullptr );
+			Real64 NearestHitDistanceLimit( std::numeric_limits< Real64 >::max() ); // Octree cubes entered beyond this distance cannot hold a nearer hit
 
 			// Lambda function for the octree to test for surface hit
-			auto surfaceHit = [=,&RecPt,&RayVec,&hit,&NearestHitDistance_sq,&nearestHitSurface,&NearestHitPt]( SurfaceData const & surface ) {
+			auto surfaceHit = [=,&RecPt,&RayVec,&hit,&NearestHitDistance_sq,&NearestHitDistanceLimit,&nearestHitSurface,&NearestHitPt]( SurfaceData const & surface ) {
 				if ( surface.ShadowSurfPossibleObstruction ) {
 					// Determine if this ray hits the surface and, if so, get the distance from the receiving point to the hit
 					PierceSurface( surface, RecPt, RayVec, HitPt, hit ); // Check if ray pierces surface
@@ -8551,6 +8558,7 @@ namespace DaylightingManager {
 							// Reset nearestHitSurface and NearestHitDistance_sq if this hit point is closer than previous closest
 							if ( HitDistance_sq < NearestHitDistance_sq ) {
 								NearestHitDistance_sq = HitDistance_sq;
+								NearestHitDistanceLimit = std::sqrt( HitDistance_sq ) + 1.0e-6; // Allowance keeps cubes holding equally near hits
 								nearestHitSurface = &surface;
 								NearestHitPt = HitPt;
 							}
@@ -8559,17 +8567,12 @@ namespace DaylightingManager {
 				}
 			};
 
-			// Process octree surface candidates
+			// Process octree surface candidates nearest first, skipping cubes beyond the nearest hit so far
 			Vector3< Real64 > const RayVec_inv( SurfaceOctreeCube::safe_inverse( RayVec ) );
-			surfaceOctree.processSurfaceRayIntersectsCube( RecPt, RayVec, RayVec_inv, surfaceHit );
-			if ( nearestHitSurface != nullptr ) { // Find surface number: This is inefficient: Improve when surfaces know their own number
-				for ( int i = 1; i <= TotSurfaces; ++i ) {
-					if ( &Surface( i ) == nearestHitSurface ) {
-						NearestHitSurfNum = i;
-						break;
-					}
-				}
-				assert( NearestHitSurfNum != 0 );
+			obstructionOctree.processSurfaceRayIntersectsCubeNearest( RecPt, RayVec, RayVec_inv, NearestHitDistanceLimit, surfaceHit );
+			if ( nearestHitSurface != nullptr ) { // Surface number from its position in the contiguous Surface array
+				NearestHitSurfNum = static_cast< int >( nearestHitSurface - &Surface( 1 ) ) + 1;
+				assert( &Surface( NearestHitSurfNum ) == nearestHitSurface );
 			}
 
 		}
@@ -8668,6 +8671,29 @@ namespace DaylightingManager {
 
 	}
 
+	bool
+	IllumMapCalcThisTimeStep()
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Return true if the illuminance maps are calculated in the current zone time step.  With
+		// SampleIllumMapsHourly only the middle time step of the hour is calculated (the first of two,
+		// the second of three or four, the third of five or six, ...).
+
+		// Using/Aliasing
+		using DataSystemVariables::SampleIllumMapsHourly;
+
+		if ( ! SampleIllumMapsHourly || NumOfTimeStepInHour == 1 ) return true;
+		return TimeStep == ( NumOfTimeStepInHour + 1 ) / 2;
+
+	}
+
 	void
 	DayltgInteriorMapIllum( int & ZoneNum ) // Zone number
 	{
@@ -8776,6 +8802,10 @@ namespace DaylightingManager {
 		}
 
 		if ( WarmupFlag ) return;
+
+		// When sampling hourly, only the mid-hour time step is calculated (see DayltgElecLightingControl)
+		if ( ! IllumMapCalcThisTimeStep() ) return;
+
 		//              Initialize reference point illuminance and window background luminance
 
 		for ( ILM = 1; ILM <= ZoneDaylight( ZoneNum ).MapCount; ++ILM ) {
@@ -8803,6 +8833,17 @@ namespace DaylightingManager {
 				ISky2 = 4;
 			}
 
+			// Adding 0.001 in the following prevents zero HorIllSky in early morning or late evening when sun
+			// is up in the present time step but GILSK(ISky,HourOfDay) and GILSK(ISky,NextHour) are both zero.
+			for ( ISky = 1; ISky <= 4; ++ISky ) {
+				HorIllSky( ISky ) = WeightNow * GILSK( HourOfDay, ISky ) + WeightPreviousHour * GILSK( PreviousHour, ISky ) + 0.001;
+			}
+
+			// HISKF is current time step horizontal illuminance from sky, calculated in DayltgLuminousEfficacy,
+			// which is called in WeatherManager. HISUNF is current time step horizontal illuminance from sun,
+			// also calculated in DayltgLuminousEfficacy.
+			HorIllSkyFac = HISKF / ( ( 1.0 - SkyWeight ) * HorIllSky( ISky2 ) + SkyWeight * HorIllSky( ISky1 ) );
+
 			//              First loop over windows in this space.
 			//              Find contribution of each window to the daylight illum
 			//              and to the glare numerator at each reference point.
@@ -8830,23 +8871,24 @@ namespace DaylightingManager {
 				for ( ILB = 1; ILB <= NREFPT; ++ILB ) {
 
 					//          Daylight factors for current sun position
-					for ( ISky = 1; ISky <= 4; ++ISky ) {
+					//          (only the two sky types being averaged are needed)
+					for ( ISky = ISky1; ISky <= ISky2; ++ISky ) {
 						//                                ===Bare window===
 						DFSKHR( 1, ISky ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylIllFacSky( HourOfDay, 1, ISky, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylIllFacSky( PreviousHour, 1, ISky, ILB, loop ) );
 
-						if ( ISky == 1 ) {
+						if ( ISky == ISky1 ) {
 							DFSUHR( 1 ) = VTRatio * ( WeightNow * ( IllumMapCalc( MapNum ).DaylIllFacSun( HourOfDay, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylIllFacSunDisk( HourOfDay, 1, ILB, loop ) ) + WeightPreviousHour * ( IllumMapCalc( MapNum ).DaylIllFacSun( PreviousHour, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylIllFacSunDisk( PreviousHour, 1, ILB, loop ) ) );
 						}
 
 						BFSKHR( 1, ISky ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylBackFacSky( HourOfDay, 1, ISky, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylBackFacSky( PreviousHour, 1, ISky, ILB, loop ) );
 
-						if ( ISky == 1 ) {
+						if ( ISky == ISky1 ) {
 							BFSUHR( 1 ) = VTRatio * ( WeightNow * ( IllumMapCalc( MapNum ).DaylBackFacSun( HourOfDay, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylBackFacSunDisk( HourOfDay, 1, ILB, loop ) ) + WeightPreviousHour * ( IllumMapCalc( MapNum ).DaylBackFacSun( PreviousHour, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylBackFacSunDisk( PreviousHour, 1, ILB, loop ) ) );
 						}
 
 						SFSKHR( 1, ISky ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylSourceFacSky( HourOfDay, 1, ISky, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylSourceFacSky( PreviousHour, 1, ISky, ILB, loop ) );
 
-						if ( ISky == 1 ) {
+						if ( ISky == ISky1 ) {
 							SFSUHR( 1 ) = VTRatio * ( WeightNow * ( IllumMapCalc( MapNum ).DaylSourceFacSun( HourOfDay, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylSourceFacSunDisk( HourOfDay, 1, ILB, loop ) ) + WeightPreviousHour * ( IllumMapCalc( MapNum ).DaylSourceFacSun( PreviousHour, 1, ILB, loop ) + IllumMapCalc( MapNum ).DaylSourceFacSunDisk( PreviousHour, 1, ILB, loop ) ) );
 						}
 
@@ -8857,7 +8899,7 @@ namespace DaylightingManager {
 								// Shade, screen, blind with fixed slats, or diffusing glass
 								DFSKHR( 2, ISky ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylIllFacSky( HourOfDay, 2, ISky, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylIllFacSky( PreviousHour, 2, ISky, ILB, loop ) );
 
-								if ( ISky == 1 ) {
+								if ( ISky == ISky1 ) {
 									DFSUHR( 2 ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylIllFacSun( HourOfDay, 2, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylIllFacSun( PreviousHour, 2, ILB, loop ) );
 
 									if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) {
@@ -8867,7 +8909,7 @@ namespace DaylightingManager {
 
 								BFSKHR( 2, ISky ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylBackFacSky( HourOfDay, 2, ISky, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylBackFacSky( PreviousHour, 2, ISky, ILB, loop ) );
 
-								if ( ISky == 1 ) {
+								if ( ISky == ISky1 ) {
 									BFSUHR( 2 ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylBackFacSun( HourOfDay, 2, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylBackFacSun( PreviousHour, 2, ILB, loop ) );
 									if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) {
 										BFSUHR( 2 ) += VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylBackFacSunDisk( HourOfDay, 2, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylBackFacSunDisk( PreviousHour, 2, ILB, loop ) );
@@ -8876,7 +8918,7 @@ namespace DaylightingManager {
 
 								SFSKHR( 2, ISky ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylSourceFacSky( HourOfDay, 2, ISky, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylSourceFacSky( PreviousHour, 2, ISky, ILB, loop ) );
 
-								if ( ISky == 1 ) {
+								if ( ISky == ISky1 ) {
 									SFSUHR( 2 ) = VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylSourceFacSun( HourOfDay, 2, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylSourceFacSun( PreviousHour, 2, ILB, loop ) );
 									if ( ! SurfaceWindow( IWin ).SlatsBlockBeam ) {
 										SFSUHR( 2 ) += VTRatio * ( WeightNow * IllumMapCalc( MapNum ).DaylSourceFacSunDisk( HourOfDay, 2, ILB, loop ) + WeightPreviousHour * IllumMapCalc( MapNum ).DaylSourceFacSunDisk( PreviousHour, 2, ILB, loop ) );
@@ -8889,7 +8931,7 @@ namespace DaylightingManager {
 
 								DFSKHR( 2, ISky ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSky( HourOfDay, {2,MaxSlatAngs + 1}, ISky, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSky( PreviousHour, {2,MaxSlatAngs + 1}, ISky, ILB, loop ) ) );
 
-								if ( ISky == 1 ) {
+								if ( ISky == ISky1 ) {
 									DFSUHR( 2 ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSun( HourOfDay, {2,MaxSlatAngs + 1}, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylIllFacSun( PreviousHour, {2,MaxSlatAngs + 1}, ILB, loop ) ) );
 
 									// We add the contribution from the solar disk if slats do not block beam solar
@@ -8904,7 +8946,7 @@ namespace DaylightingManager {
 
 								BFSKHR( 2, ISky ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSky( HourOfDay, {2,MaxSlatAngs + 1}, ISky, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSky( PreviousHour, {2,MaxSlatAngs + 1}, ISky, ILB, loop ) ) );
 
-								if ( ISky == 1 ) {
+								if ( ISky == ISky1 ) {
 									BFSUHR( 2 ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSun( HourOfDay, {2,MaxSlatAngs + 1}, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylBackFacSun( PreviousHour, {2,MaxSlatAngs + 1}, ILB, loop ) ) );
 
 									// TH CR 8010, DaylBackFacSunDisk needs to be interpolated
@@ -8915,7 +8957,7 @@ namespace DaylightingManager {
 
 								SFSKHR( 2, ISky ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSky( HourOfDay, {2,MaxSlatAngs + 1}, ISky, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSky( PreviousHour, {2,MaxSlatAngs + 1}, ISky, ILB, loop ) ) );
 
-								if ( ISky == 1 ) {
+								if ( ISky == ISky1 ) {
 									SFSUHR( 2 ) = VTRatio * ( WeightNow * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSun( HourOfDay, {2,MaxSlatAngs + 1}, ILB, loop ) ) + WeightPreviousHour * InterpSlatAng( SlatAng, VarSlats, IllumMapCalc( MapNum ).DaylSourceFacSun( PreviousHour, {2,MaxSlatAngs + 1}, ILB, loop ) ) );
 
 									// TH CR 8010, DaylSourceFacSunDisk needs to be interpolated
@@ -8933,17 +8975,6 @@ namespace DaylightingManager {
 					//              Get illuminance at ref point from bare and shaded window by
 					//              multiplying daylight factors by exterior horizontal illuminance
 
-					// Adding 0.001 in the following prevents zero HorIllSky in early morning or late evening when sun
-					// is up in the present time step but GILSK(ISky,HourOfDay) and GILSK(ISky,NextHour) are both zero.
-					for ( ISky = 1; ISky <= 4; ++ISky ) {
-						HorIllSky( ISky ) = WeightNow * GILSK( HourOfDay, ISky ) + WeightPreviousHour * GILSK( PreviousHour, ISky ) + 0.001;
-					}
-
-					// HISKF is current time step horizontal illuminance from sky, calculated in DayltgLuminousEfficacy,
-					// which is called in WeatherManager. HISUNF is current time step horizontal illuminance from sun,
-					// also calculated in DayltgLuminousEfficacy.
-					HorIllSkyFac = HISKF / ( ( 1.0 - SkyWeight ) * HorIllSky( ISky2 ) + SkyWeight * HorIllSky( ISky1 ) );
-
 					for ( IS = 1; IS <= 2; ++IS ) {
 						if ( IS == 2 && SurfaceWindow( IWin ).ShadingFlag <= 0 && ! SurfaceWindow( IWin ).SolarDiffusing ) break;
 
@@ -550,6 +550,9 @@ namespace DaylightingManager {
 		Real64 & LumAtReflHitPtFrSun // Luminance at ReflHitPt from beam solar reflection for unit
 	);
 
+	bool
+	IllumMapCalcThisTimeStep();
+
 	void
 	DayltgInteriorMapIllum( int & ZoneNum ); // Zone number
 
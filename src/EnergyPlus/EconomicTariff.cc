@@ -300,6 +300,11 @@ namespace EconomicTariff {
 	int topOfStack( 0 );
 	int sizeStack( 0 );
 
+	// distinct meters referenced by the tariffs and their values for the current timestep
+	Array1D_int gatherMeterIndx;
+	Array1D< Real64 > gatherMeterValue;
+	int numGatherMeter( 0 );
+
 	//MODULE VARIABLE DECLARATIONS:
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE
@@ -381,6 +386,7 @@ namespace EconomicTariff {
 				GetInputEconomicsVariable( ErrorsFound );
 				GetInputEconomicsComputation( ErrorsFound );
 				CreateDefaultComputation();
+				SetupGatherMeters();
 			}
 			GetInput = false;
 			if ( ErrorsFound ) ShowFatalError( "UpdateUtilityBills: Preceding errors cause termination." );
@@ -3037,6 +3043,55 @@ namespace EconomicTariff {
 	//======================================================================================================================
 	//======================================================================================================================
 
+	void
+	SetupGatherMeters()
+	{
+		// SUBROUTINE INFORMATION:
+		//    AUTHOR         na
+		//    DATE WRITTEN   na
+		//    MODIFIED       na
+		//    RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		//   Builds the list of distinct meters referenced by the
+		//   tariffs so that each meter is only read once per
+		//   timestep when gathering, no matter how many tariffs
+		//   use it.
+
+		// METHODOLOGY EMPLOYED:
+		//   Tariffs point into a contiguous buffer of meter values
+		//   that is filled at the top of GatherForEconomics.
+
+		// REFERENCES:
+		// na
+
+		// USE STATEMENTS:
+		// na
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int iTariff;
+		int jMeter;
+
+		numGatherMeter = 0;
+		gatherMeterIndx.dimension( numTariff, 0 );
+		for ( iTariff = 1; iTariff <= numTariff; ++iTariff ) {
+			tariff( iTariff ).gatherMeterPt = 0;
+			if ( tariff( iTariff ).reportMeterIndx == 0 ) continue;
+			for ( jMeter = 1; jMeter <= numGatherMeter; ++jMeter ) {
+				if ( gatherMeterIndx( jMeter ) == tariff( iTariff ).reportMeterIndx ) {
+					tariff( iTariff ).gatherMeterPt = jMeter;
+					break;
+				}
+			}
+			if ( tariff( iTariff ).gatherMeterPt == 0 ) {
+				++numGatherMeter;
+				gatherMeterIndx( numGatherMeter ) = tariff( iTariff ).reportMeterIndx;
+				tariff( iTariff ).gatherMeterPt = numGatherMeter;
+			}
+		}
+		gatherMeterValue.dimension( numGatherMeter, 0.0 );
+	}
+
 	void
 	GatherForEconomics()
 	{
@@ -3094,11 +3149,15 @@ namespace EconomicTariff {
 		Real64 curRTPcost; // cost for energy for current time
 
 		if ( numTariff >= 1 ) {
+			// read each distinct meter once for all of the tariffs that reference it
+			for ( int jMeter = 1; jMeter <= numGatherMeter; ++jMeter ) {
+				gatherMeterValue( jMeter ) = GetCurrentMeterValue( gatherMeterIndx( jMeter ) );
+			}
 			for ( iTariff = 1; iTariff <= numTariff; ++iTariff ) {
 				isGood = false;
 				//if the meter is defined get the value
-				if ( tariff( iTariff ).reportMeterIndx != 0 ) {
-					curInstantValue = GetCurrentMeterValue( tariff( iTariff ).reportMeterIndx );
+				if ( tariff( iTariff ).gatherMeterPt != 0 ) {
+					curInstantValue = gatherMeterValue( tariff( iTariff ).gatherMeterPt );
 				} else {
 					curInstantValue = 0.0;
 				}
@@ -3687,10 +3746,8 @@ namespace EconomicTariff {
 		// na
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Array1D< Real64 > curMonthlyArray( MaxNumMonths );
 		static int sizeIncrement( 50 );
 
-		curMonthlyArray = monthlyArray;
 		if ( ! allocated( stack ) ) {
 			stack.allocate( sizeIncrement );
 			sizeStack = sizeIncrement;
@@ -3731,11 +3788,12 @@ namespace EconomicTariff {
 				if ( econVar( variablePointer ).specific == catServiceCharges ) addMonthlyCharge( variablePointer );
 				//get the results of performing the evaulation - should have been
 				//put into the econVar values
-				curMonthlyArray = econVar( variablePointer ).values;
+				stack( topOfStack ).values = econVar( variablePointer ).values;
+				return;
 			}
 		}
 		//now assign
-		stack( topOfStack ).values = curMonthlyArray;
+		stack( topOfStack ).values = monthlyArray;
 	}
 
 	void
@@ -268,6 +268,11 @@ namespace EconomicTariff {
 	extern int topOfStack;
 	extern int sizeStack;
 
+	// distinct meters referenced by the tariffs and their values for the current timestep
+	extern Array1D_int gatherMeterIndx;
+	extern Array1D< Real64 > gatherMeterValue;
+	extern int numGatherMeter;
+
 	//MODULE VARIABLE DECLARATIONS:
 
 	// SUBROUTINE SPECIFICATIONS FOR MODULE
@@ -325,6 +330,7 @@ namespace EconomicTariff {
 		std::string tariffName; // name of the tariff
 		std::string reportMeter; // name of the report meter
 		int reportMeterIndx; // index of the report meter
+		int gatherMeterPt; // index into gatherMeterIndx and gatherMeterValue, 0 if no meter
 		int kindElectricMtr; // kind of electric meter - see enumerated list above, 0 is not electric
 		int resourceNum; // based on list of DataGlobalConstants
 		int convChoice; // enumerated choice index of the conversion factor
@@ -430,6 +436,7 @@ namespace EconomicTariff {
 		// Default Constructor
 		TariffType() :
 			reportMeterIndx( 0 ),
+			gatherMeterPt( 0 ),
 			kindElectricMtr( 0 ),
 			resourceNum( 0 ),
 			convChoice( 0 ),
@@ -808,6 +815,9 @@ namespace EconomicTariff {
 	//======================================================================================================================
 	//======================================================================================================================
 
+	void
+	SetupGatherMeters();
+
 	void
 	GatherForEconomics();
 
@@ -388,6 +388,40 @@ EnergyPlusPgm( std::string const & filepath )
 	get_environment_variable( cTimingFlag, cEnvValue );
 	if ( ! cEnvValue.empty() ) TimingFlag = env_var_on( cEnvValue ); // Yes or True
 
+	get_environment_variable( cWarmStartControllers, cEnvValue );
+	if ( ! cEnvValue.empty() ) WarmStartControllers = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cSkipQuiescentHVAC, cEnvValue );
+	if ( ! cEnvValue.empty() ) SkipQuiescentHVAC = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cSkipConvergedAirLoops, cEnvValue );
+	if ( ! cEnvValue.empty() ) SkipConvergedAirLoops = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cSkipIdlePlantBranches, cEnvValue );
+	if ( ! cEnvValue.empty() ) SkipIdlePlantBranches = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cMemoizeDXCoilPerformance, cEnvValue );
+	if ( ! cEnvValue.empty() ) MemoizeDXCoilPerformance = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cDXCoilMemoTolerance, cEnvValue );
+	if ( ! cEnvValue.empty() ) {
+		bool ErrFlag( false );
+		Real64 const MemoTolerance( InputProcessor::ProcessNumber( cEnvValue, ErrFlag ) );
+		if ( ! ErrFlag && MemoTolerance >= 0.0 ) DXCoilMemoTolerance = MemoTolerance;
+	}
+
+	get_environment_variable( cTabulateFanPowerCurves, cEnvValue );
+	if ( ! cEnvValue.empty() ) TabulateFanPowerCurves = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cCondFDLayerDirectSolve, cEnvValue );
+	if ( ! cEnvValue.empty() ) CondFDLayerDirectSolve = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cHAMTDirectSolve, cEnvValue );
+	if ( ! cEnvValue.empty() ) HAMTDirectSolve = env_var_on( cEnvValue ); // Yes or True
+
+	get_environment_variable( cSampleIllumMapsHourly, cEnvValue );
+	if ( ! cEnvValue.empty() ) SampleIllumMapsHourly = env_var_on( cEnvValue ); // Yes or True
+
 	// Initialize env flags for air loop simulation debugging
 	get_environment_variable( TrackAirLoopEnvVar, cEnvValue );
 	if ( ! cEnvValue.empty() ) TrackAirLoopEnvFlag = env_var_on( cEnvValue ); // Yes or True
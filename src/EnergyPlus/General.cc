@@ -147,7 +147,7 @@ namespace General {
 		//       AUTHOR         Michael Wetter
 		//       DATE WRITTEN   March 1999
 		//       MODIFIED       Fred Buhl November 2000, R. Raustad October 2006 - made subroutine RECURSIVE
-		//       RE-ENGINEERED  na
+		//       RE-ENGINEERED  Iteration moved to the templated SolveRoot in General.hh
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// Find the value of x between x0 and x1 such that f(x,Par)
@@ -155,111 +155,15 @@ namespace General {
 
 		// METHODOLOGY EMPLOYED:
 		// Uses the Regula Falsi (false position) method (similar to secant method)
+		// Flag: = -2: f(x0) and f(x1) have the same sign
+		//       = -1: no convergence
+		//       >  0: number of iterations performed
 
 		// REFERENCES:
 		// See Press et al., Numerical Recipes in Fortran, Cambridge University Press,
 		// 2nd edition, 1992. Page 347 ff.
 
-		// USE STATEMENTS:
-		// na
-
-		// Argument array dimensioning
-
-		// Locals
-		// SUBROUTINE ARGUMENT DEFINITIONS:
-		// = -2: f(x0) and f(x1) have the same sign
-		// = -1: no convergence
-		// >  0: number of iterations performed
-		// optional
-		// SUBROUTINE PARAMETER DEFINITIONS:
-		Real64 const SMALL( 1.e-10 );
-
-		// INTERFACE BLOCK SPECIFICATIONS
-
-		// DERIVED TYPE DEFINITIONS
-		// na
-
-		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 X0; // present 1st bound
-		Real64 X1; // present 2nd bound
-		Real64 XTemp; // new estimate
-		Real64 Y0; // f at X0
-		Real64 Y1; // f at X1
-		Real64 YTemp; // f at XTemp
-		Real64 DY; // DY = Y0 - Y1
-		bool Conv; // flag, true if convergence is achieved
-		bool StopMaxIte; // stop due to exceeding of maximum # of iterations
-		bool Cont; // flag, if true, continue searching
-		int NIte; // number of interations
-
-		X0 = X_0;
-		X1 = X_1;
-		Conv = false;
-		StopMaxIte = false;
-		Cont = true;
-		NIte = 0;
-
-		Y0 = f( X0, Par );
-		Y1 = f( X1, Par );
-		// check initial values
-		if ( Y0 * Y1 > 0 ) {
-			Flag = -2;
-			XRes = X0;
-			return;
-		}
-
-		while ( Cont ) {
-
-			DY = Y0 - Y1;
-			if ( std::abs( DY ) < SMALL ) DY = SMALL;
-			// new estimation
-			XTemp = ( Y0 * X1 - Y1 * X0 ) / DY;
-			YTemp = f( XTemp, Par );
-
-			++NIte;
-
-			// check convergence
-			if ( std::abs( YTemp ) < Eps ) Conv = true;
-
-			if ( NIte > MaxIte ) StopMaxIte = true;
-
-			if ( ( ! Conv ) && ( ! StopMaxIte ) ) {
-				Cont = true;
-			} else {
-				Cont = false;
-			}
-
-			if ( Cont ) {
-
-				// reassign values (only if further iteration required)
-				if ( Y0 < 0.0 ) {
-					if ( YTemp < 0.0 ) {
-						X0 = XTemp;
-						Y0 = YTemp;
-					} else {
-						X1 = XTemp;
-						Y1 = YTemp;
-					}
-				} else {
-					if ( YTemp < 0.0 ) {
-						X1 = XTemp;
-						Y1 = YTemp;
-					} else {
-						X0 = XTemp;
-						Y0 = YTemp;
-					}
-				} // ( Y0 < 0 )
-
-			} // (Cont)
-
-		} // Cont
-
-		if ( Conv ) {
-			Flag = NIte;
-		} else {
-			Flag = -1;
-		}
-		XRes = XTemp;
+		SolveRoot( Eps, MaxIte, Flag, XRes, [&]( Real64 const X ) { return f( X, Par ); }, X_0, X_1 );
 
 	}
 
@@ -279,7 +183,7 @@ namespace General {
 		//       AUTHOR         Michael Wetter
 		//       DATE WRITTEN   March 1999
 		//       MODIFIED       Fred Buhl November 2000, R. Raustad October 2006 - made subroutine RECURSIVE
-		//       RE-ENGINEERED  na
+		//       RE-ENGINEERED  Iteration moved to the templated SolveRoot in General.hh
 
 		// PURPOSE OF THIS SUBROUTINE:
 		// Find the value of x between x0 and x1 such that f(x)
@@ -292,106 +196,7 @@ namespace General {
 		// See Press et al., Numerical Recipes in Fortran, Cambridge University Press,
 		// 2nd edition, 1992. Page 347 ff.
 
-		// USE STATEMENTS:
-		// na
-
-		// Argument array dimensioning
-
-		// Locals
-		// SUBROUTINE ARGUMENT DEFINITIONS:
-		// = -2: f(x0) and f(x1) have the same sign
-		// = -1: no convergence
-		// >  0: number of iterations performed
-		// optional
-		// SUBROUTINE PARAMETER DEFINITIONS:
-		Real64 const SMALL( 1.e-10 );
-
-		// INTERFACE BLOCK SPECIFICATIONS
-
-		// DERIVED TYPE DEFINITIONS
-		// na
-
-		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-		Real64 X0; // present 1st bound
-		Real64 X1; // present 2nd bound
-		Real64 XTemp; // new estimate
-		Real64 Y0; // f at X0
-		Real64 Y1; // f at X1
-		Real64 YTemp; // f at XTemp
-		Real64 DY; // DY = Y0 - Y1
-		bool Conv; // flag, true if convergence is achieved
-		bool StopMaxIte; // stop due to exceeding of maximum # of iterations
-		bool Cont; // flag, if true, continue searching
-		int NIte; // number of interations
-
-		X0 = X_0;
-		X1 = X_1;
-		Conv = false;
-		StopMaxIte = false;
-		Cont = true;
-		NIte = 0;
-
-		Y0 = f( X0 );
-		Y1 = f( X1 );
-		// check initial values
-		if ( Y0 * Y1 > 0 ) {
-			Flag = -2;
-			XRes = X0;
-			return;
-		}
-
-		while ( Cont ) {
-
-			DY = Y0 - Y1;
-			if ( std::abs( DY ) < SMALL ) DY = SMALL;
-			// new estimation
-			XTemp = ( Y0 * X1 - Y1 * X0 ) / DY;
-			YTemp = f( XTemp );
-
-			++NIte;
-
-			// check convergence
-			if ( std::abs( YTemp ) < Eps ) Conv = true;
-
-			if ( NIte > MaxIte ) StopMaxIte = true;
-
-			if ( ( ! Conv ) && ( ! StopMaxIte ) ) {
-				Cont = true;
-			} else {
-				Cont = false;
-			}
-
-			if ( Cont ) {
-
-				// reassign values (only if further iteration required)
-				if ( Y0 < 0.0 ) {
-					if ( YTemp < 0.0 ) {
-						X0 = XTemp;
-						Y0 = YTemp;
-					} else {
-						X1 = XTemp;
-						Y1 = YTemp;
-					}
-				} else {
-					if ( YTemp < 0.0 ) {
-						X1 = XTemp;
-						Y1 = YTemp;
-					} else {
-						X0 = XTemp;
-						Y0 = YTemp;
-					}
-				} // ( Y0 < 0 )
-
-			} // (Cont)
-
-		} // Cont
-
-		if ( Conv ) {
-			Flag = NIte;
-		} else {
-			Flag = -1;
-		}
-		XRes = XTemp;
+		SolveRoot( Eps, MaxIte, Flag, XRes, f, X_0, X_1 );
 
 	}
 
@@ -1526,6 +1331,49 @@ namespace General {
 		}
 	}
 
+	void
+	SolveTridiagonal(
+		int const N, // number of equations
+		Array1< Real64 > const & A, // sub-diagonal, A( 1 ) is not used
+		Array1< Real64 > const & B, // diagonal
+		Array1< Real64 > const & C, // super-diagonal, C( N ) is not used
+		Array1< Real64 > & D, // right hand side on entry, solution on exit
+		Array1< Real64 > & W // scratch array of at least N elements
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Solve the tridiagonal system A(i)*X(i-1) + B(i)*X(i) + C(i)*X(i+1) = D(i), i = 1..N.
+
+		// METHODOLOGY EMPLOYED:
+		// Thomas algorithm (forward elimination, back substitution) without pivoting, which is stable
+		// for the diagonally dominant systems produced by implicit heat balances.  The coefficient
+		// arrays are left unchanged and the caller supplies the scratch array so that repeated
+		// solves do not allocate.
+
+		// REFERENCES:
+		// Press et al., Numerical Recipes in Fortran, 2nd edition, 1992. Page 42 ff.
+
+		if ( N < 1 ) return;
+
+		Real64 Denom( B( 1 ) );
+		D( 1 ) /= Denom;
+		for ( int i = 2; i <= N; ++i ) {
+			W( i ) = C( i - 1 ) / Denom;
+			Denom = B( i ) - A( i ) * W( i );
+			D( i ) = ( D( i ) - A( i ) * D( i - 1 ) ) / Denom;
+		}
+		for ( int i = N - 1; i >= 1; --i ) {
+			D( i ) -= W( i + 1 ) * D( i + 1 );
+		}
+	}
+
 	void
 	ProcessDateString(
 		std::string const & String,
@@ -60,7 +60,10 @@
 #define General_hh_INCLUDED
 
 // C++ Headers
+#include <algorithm>
+#include <cmath>
 #include <functional>
+#include <limits>
 #include <type_traits>
 
 // ObjexxFCL Headers
@@ -83,7 +86,13 @@ namespace General {
 	// parts of the simulation.
 
 	// MODULE PARAMETER DEFINITIONS
-	// na
+	// Bracket update rules available to SolveRoot
+	enum class RootFinderMethod : int {
+		RegulaFalsi,
+		Illinois,
+		Brent,
+		ITP
+	};
 
 	// DERIVED TYPE DEFINITIONS
 	// na
@@ -122,6 +131,232 @@ namespace General {
 		Real64 const X_1 // 2nd bound of interval that contains the solution
 	);
 
+	template< typename Residual >
+	inline
+	void
+	SolveRoot(
+		Real64 const Eps, // required absolute accuracy
+		int const MaxIte, // maximum number of allowed iterations
+		int & Flag, // integer storing exit status
+		Real64 & XRes, // value of x that solves f(x) = 0
+		Residual && f, // residual functor, typically a lambda bound to a typed parameter struct
+		Real64 const X_0, // 1st bound of interval that contains the solution
+		Real64 const X_1, // 2nd bound of interval that contains the solution
+		RootFinderMethod const Method = RootFinderMethod::RegulaFalsi // bracketing update rule
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         Michael Wetter
+		//       DATE WRITTEN   March 1999
+		//       MODIFIED       Fred Buhl November 2000, R. Raustad October 2006 - made subroutine RECURSIVE
+		//                      Templated on the residual and extended with Illinois, Brent and ITP updates
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Find the value of x between x0 and x1 such that f(x) is equal to zero.
+		// Header-only so the residual is inlined at the call site; callers bind their
+		// parameters in a lambda instead of packing an Array1D Par and going through std::function.
+
+		// METHODOLOGY EMPLOYED:
+		// All methods keep a sign-changing bracket and share the exit status of SolveRegulaFalsi:
+		// = -2: f(x0) and f(x1) have the same sign
+		// = -1: no convergence
+		// >  0: number of iterations performed
+		// RegulaFalsi reproduces SolveRegulaFalsi exactly. Illinois halves the retained end point
+		// value after two updates on the same side. Brent combines inverse quadratic interpolation,
+		// secant and bisection steps. ITP is the interpolate-truncate-project method, which keeps
+		// the worst case of bisection while converging superlinearly on smooth residuals.
+
+		// REFERENCES:
+		// See Press et al., Numerical Recipes in Fortran, Cambridge University Press,
+		// 2nd edition, 1992. Page 347 ff. (regula falsi), 352 ff. (Brent).
+		// Dowell, M. and Jarratt, P., BIT 11, 1971 (Illinois).
+		// Oliveira, I.F.D. and Takahashi, R.H.C., ACM TOMS 47(1), 2020 (ITP).
+
+		// SUBROUTINE PARAMETER DEFINITIONS:
+		Real64 const SMALL( 1.e-10 );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		Real64 X0( X_0 ); // present 1st bound
+		Real64 X1( X_1 ); // present 2nd bound
+		Real64 XTemp( X_0 ); // new estimate
+		Real64 Y0; // f at X0
+		Real64 Y1; // f at X1
+		Real64 YTemp; // f at XTemp
+		Real64 DY; // DY = Y0 - Y1
+		int NIte( 0 ); // number of interations
+		int Side( 0 ); // Illinois: end point kept on the last update (-1 = X0, +1 = X1)
+
+		Y0 = f( X0 );
+		Y1 = f( X1 );
+		// check initial values
+		if ( Y0 * Y1 > 0 ) {
+			Flag = -2;
+			XRes = X0;
+			return;
+		}
+
+		if ( Method == RootFinderMethod::Brent ) {
+			// B is the best estimate, A the previous one and C the contrapoint of B
+			Real64 A( X0 ), B( X1 ), C( X1 );
+			Real64 FA( Y0 ), FB( Y1 ), FC( Y1 );
+			Real64 D( 0.0 ), E( 0.0 );
+			while ( true ) {
+				if ( ( FB > 0.0 && FC > 0.0 ) || ( FB < 0.0 && FC < 0.0 ) ) {
+					C = A;
+					FC = FA;
+					D = B - A;
+					E = D;
+				}
+				if ( std::abs( FC ) < std::abs( FB ) ) {
+					A = B;
+					B = C;
+					C = A;
+					FA = FB;
+					FB = FC;
+					FC = FA;
+				}
+				Real64 const Tol1( 2.0 * std::numeric_limits< Real64 >::epsilon() * std::abs( B ) + 0.5 * SMALL );
+				Real64 const XM( 0.5 * ( C - B ) );
+				if ( std::abs( E ) >= Tol1 && std::abs( FA ) > std::abs( FB ) ) {
+					Real64 P, Q;
+					Real64 const S( FB / FA );
+					if ( A == C ) {
+						P = 2.0 * XM * S;
+						Q = 1.0 - S;
+					} else {
+						Real64 const QA( FA / FC );
+						Real64 const R( FB / FC );
+						P = S * ( 2.0 * XM * QA * ( QA - R ) - ( B - A ) * ( R - 1.0 ) );
+						Q = ( QA - 1.0 ) * ( R - 1.0 ) * ( S - 1.0 );
+					}
+					if ( P > 0.0 ) {
+						Q = -Q;
+					} else {
+						P = -P;
+					}
+					if ( 2.0 * P < std::min( 3.0 * XM * Q - std::abs( Tol1 * Q ), std::abs( E * Q ) ) ) {
+						E = D;
+						D = P / Q;
+					} else {
+						D = XM;
+						E = D;
+					}
+				} else {
+					D = XM;
+					E = D;
+				}
+				A = B;
+				FA = FB;
+				if ( std::abs( D ) > Tol1 ) {
+					B += D;
+				} else {
+					B += ( XM >= 0.0 ? Tol1 : -Tol1 );
+				}
+				FB = f( B );
+				++NIte;
+				XTemp = B;
+				if ( std::abs( FB ) < Eps ) {
+					Flag = NIte;
+					XRes = XTemp;
+					return;
+				}
+				if ( NIte > MaxIte ) break;
+			}
+			Flag = -1;
+			XRes = XTemp;
+			return;
+		}
+
+		if ( Method == RootFinderMethod::ITP ) {
+			// normalize the bracket so that XLo < XHi and Sgn * f(XLo) <= 0 <= Sgn * f(XHi);
+			// YLo and YHi hold the sign-adjusted residuals from here on
+			Real64 XLo( std::min( X0, X1 ) ), XHi( std::max( X0, X1 ) );
+			Real64 YLo( X0 <= X1 ? Y0 : Y1 ), YHi( X0 <= X1 ? Y1 : Y0 );
+			Real64 const Sgn( ( YLo > 0.0 || YHi < 0.0 ) ? -1.0 : 1.0 );
+			YLo *= Sgn;
+			YHi *= Sgn;
+			Real64 const Kappa1( 0.2 / std::max( XHi - XLo, SMALL ) );
+			Real64 const EpsX( 0.5 * SMALL * std::max( 1.0, XHi - XLo ) );
+			int const NMax( int( std::ceil( std::log2( std::max( ( XHi - XLo ) / ( 2.0 * EpsX ), 1.0 ) ) ) ) + 1 );
+			while ( true ) {
+				Real64 const XHalf( 0.5 * ( XLo + XHi ) );
+				Real64 const Width( XHi - XLo );
+				// interpolation (regula falsi point, bisection if the residuals are too close to divide)
+				DY = YHi - YLo;
+				Real64 const XF( ( DY < SMALL ) ? XHalf : std::min( std::max( ( YHi * XLo - YLo * XHi ) / DY, XLo ), XHi ) );
+				// truncation
+				Real64 const Delta( Kappa1 * Width * Width );
+				Real64 const SigmaDir( XHalf >= XF ? 1.0 : -1.0 );
+				Real64 const XT( ( Delta <= std::abs( XHalf - XF ) ) ? XF + SigmaDir * Delta : XHalf );
+				// projection
+				Real64 const R( std::max( 0.0, EpsX * std::pow( 2.0, NMax - NIte ) - 0.5 * Width ) );
+				XTemp = ( std::abs( XT - XHalf ) <= R ) ? XT : XHalf - SigmaDir * R;
+				XTemp = std::min( std::max( XTemp, XLo ), XHi );
+				YTemp = f( XTemp );
+				++NIte;
+				if ( std::abs( YTemp ) < Eps ) {
+					Flag = NIte;
+					XRes = XTemp;
+					return;
+				}
+				if ( NIte > MaxIte ) break;
+				if ( Sgn * YTemp < 0.0 ) {
+					XLo = XTemp;
+					YLo = Sgn * YTemp;
+				} else {
+					XHi = XTemp;
+					YHi = Sgn * YTemp;
+				}
+			}
+			Flag = -1;
+			XRes = XTemp;
+			return;
+		}
+
+		while ( true ) {
+
+			DY = Y0 - Y1;
+			if ( std::abs( DY ) < SMALL ) DY = SMALL;
+			// new estimation
+			XTemp = ( Y0 * X1 - Y1 * X0 ) / DY;
+			YTemp = f( XTemp );
+
+			++NIte;
+
+			// check convergence
+			if ( std::abs( YTemp ) < Eps ) {
+				Flag = NIte;
+				XRes = XTemp;
+				return;
+			}
+			if ( NIte > MaxIte ) break;
+
+			// reassign values (only if further iteration required)
+			if ( ( Y0 < 0.0 ) == ( YTemp < 0.0 ) ) {
+				X0 = XTemp;
+				Y0 = YTemp;
+				if ( Method == RootFinderMethod::Illinois ) {
+					if ( Side == 1 ) Y1 *= 0.5;
+					Side = 1;
+				}
+			} else {
+				X1 = XTemp;
+				Y1 = YTemp;
+				if ( Method == RootFinderMethod::Illinois ) {
+					if ( Side == -1 ) Y0 *= 0.5;
+					Side = -1;
+				}
+			}
+
+		}
+
+		Flag = -1;
+		XRes = XTemp;
+
+	}
+
 	Real64
 	InterpSw(
 		Real64 const SwitchFac, // Switching factor: 0.0 if glazing is unswitched, = 1.0 if fully switched
@@ -242,6 +477,16 @@ namespace General {
 		Array1A< Real64 > SmoothedData // output data after smoothing
 	);
 
+	void
+	SolveTridiagonal(
+		int const N, // number of equations
+		Array1< Real64 > const & A, // sub-diagonal, A( 1 ) is not used
+		Array1< Real64 > const & B, // diagonal
+		Array1< Real64 > const & C, // super-diagonal, C( N ) is not used
+		Array1< Real64 > & D, // right hand side on entry, solution on exit
+		Array1< Real64 > & W // scratch array of at least N elements
+	);
+
 	void
 	ProcessDateString(
 		std::string const & String,
@@ -1509,8 +1509,20 @@ namespace HVACControllers {
 				// we can compute the actual setpoint for the dual humidity ratio / temperature strategy.
 				{ auto const SELECT_CASE_var( ControllerProps( ControlNum ).ControlVar );
 				if ( ( SELECT_CASE_var == iTemperature ) || ( SELECT_CASE_var == iHumidityRatio ) || ( SELECT_CASE_var == iFlow ) ) {
-					// Always start with min point by default for the other control strategies
-					ControllerProps( ControlNum ).NextActuatedValue = RootFinders( ControlNum ).MinPoint.X;
+					// With the WarmStartControllers environment variable set, start from the active solution
+					// tracked at the last call to SimAirLoop() if it is still within range. When the operating
+					// point has not moved this converges on the first evaluation. The iterates that follow differ
+					// from a cold start, so results can change slightly, in particular when the controller
+					// moves into or out of the min-active mode.
+					SolutionTrackerType const & PreviousSolution( ControllerProps( ControlNum ).SolutionTrackers( FirstHVACIteration ? 1 : 2 ) );
+					if ( DataSystemVariables::WarmStartControllers && ControllerProps( ControlNum ).ReusePreviousSolutionFlag && PreviousSolution.DefinedFlag && ( PreviousSolution.Mode == iModeActive ) && CheckRootFinderCandidate( RootFinders( ControlNum ), PreviousSolution.ActuatedValue ) ) {
+						ControllerProps( ControlNum ).NextActuatedValue = PreviousSolution.ActuatedValue;
+						// The previous solution can only be used once per HVAC iteration
+						ControllerProps( ControlNum ).ReusePreviousSolutionFlag = false;
+					} else {
+						// Otherwise start with min point by default for the other control strategies
+						ControllerProps( ControlNum ).NextActuatedValue = RootFinders( ControlNum ).MinPoint.X;
+					}
 
 				} else if ( SELECT_CASE_var == iTemperatureAndHumidityRatio ) {
 					if ( ! ControllerProps( ControlNum ).IsSetPointDefinedFlag ) {
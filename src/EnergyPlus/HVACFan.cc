@@ -56,6 +56,9 @@
 // computer software, distribute, and sublicense such enhancements or derivative works thereof,
 // in binary and source code form.
 
+// C++ Headers
+#include <unordered_map>
+
 // EnergyPlus Headers
 #include <HVACFan.hh>
 #include <EnergyPlus.hh>
@@ -73,6 +76,7 @@
 #include <General.hh>
 #include <EMSManager.hh>
 #include <ObjexxFCL/Optional.hh>
+#include <ObjexxFCL/gio.hh>
 #include <DataAirLoop.hh>
 #include <DataEnvironment.hh>
 #include <ReportSizingManager.hh>
@@ -81,6 +85,7 @@
 #include <Psychrometrics.hh>
 #include <DataContaminantBalance.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataSystemVariables.hh>
 #include <BranchNodeConnections.hh>
 
 namespace EnergyPlus {
@@ -89,25 +94,45 @@ namespace HVACFan {
 
 	std::vector < std::unique_ptr <FanSystem> > fanObjs;
 
+	namespace {
+		// Registry of fanObjs positions by fan name, filled in as parents construct fan objects.
+		// Not in the header; only getFanObjectVectorIndex uses it. Cleared by clear_state().
+		std::unordered_map< std::string, int > fanObjIndexByName; // zero-based index into fanObjs, -1 for a duplicate name
+		std::size_t numFanObjsRegistered( 0 ); // number of leading fanObjs entries already in fanObjIndexByName
+
+		// Power curve tables, used when the TabulateFanPowerCurves environment variable is set
+		int const powerCurveTableMinIntervals( 64 ); // starting number of uniform flow fraction intervals
+		int const powerCurveTableMaxIntervals( 4096 ); // give up on the table beyond this many intervals
+		Real64 const powerCurveTableTolerance( 1.0e-4 ); // allowed interpolation error in power fraction
+		bool powerCurveTableHeaderWritten( false ); // true once the eio header line has been written
+	}
+
+	void
+	clear_state()
+	{
+		fanObjs.clear();
+		fanObjIndexByName.clear();
+		numFanObjsRegistered = 0;
+		powerCurveTableHeaderWritten = false;
+	}
+
 	int
 	getFanObjectVectorIndex(  // lookup vector index for fan object name in object array EnergyPlus::HVACFan::fanObjs
 		std::string const objectName  // IDF name in input
 	)
 	{
-		int index = -1;
-		bool found = false;
-		for ( std::size_t loop = 0; loop < fanObjs.size(); ++loop ) {
-			if ( objectName == fanObjs[ loop ]->name() ) {
-				if ( ! found ) {
-					index = loop;
-					found = true;
-				} else { // found duplicate
-					//TODO throw warning?  
-					index = -1;
-				}
+		// register fan objects constructed since the last lookup, so each name is hashed once
+		// instead of rescanning all of fanObjs for every parent
+		for ( ; numFanObjsRegistered < fanObjs.size(); ++numFanObjsRegistered ) {
+			auto const registered = fanObjIndexByName.emplace( fanObjs[ numFanObjsRegistered ]->name(), int( numFanObjsRegistered ) );
+			if ( ! registered.second ) { // found duplicate
+				//TODO throw warning?
+				registered.first->second = -1;
 			}
 		}
-		return index;
+		auto const found = fanObjIndexByName.find( objectName );
+		if ( found == fanObjIndexByName.end() ) return -1;
+		return found->second;
 	}
 
 	bool
@@ -353,7 +378,9 @@ namespace HVACFan {
 		massFlowRateMaxAvail_( 0.0 ),
 		massFlowRateMinAvail_( 0.0 ),
 		rhoAirStdInit_( 0.0 ),
-		oneTimePowerCurveCheck_( true ) 
+		oneTimePowerCurveCheck_( true ),
+		powerCurveTableFlag_( true ),
+		powerFractionTableMaxError_( 0.0 )
 	{
 
 		std::string const routineName = "HVACFan constructor ";
@@ -646,7 +673,7 @@ namespace HVACFan {
 			case SpeedControlMethod::continuous : {
 				localFanTotEff = fanTotalEff_;
 				Real64 localFlowFractionForPower = max( minPowerFlowFrac_, localFlowFraction );
-				Real64 localPowerFraction = CurveManager::CurveValue( powerModFuncFlowFractionCurveIndex_, localFlowFractionForPower );
+				Real64 localPowerFraction = calcPowerFraction( localFlowFractionForPower );
 				fanPower_ = localPowerFraction * maxAirMassFlowRate_ * localPressureRise / ( localFanTotEff * rhoAirStdInit_ );
 				Real64 fanShaftPower = motorEff_ * fanPower_;
 				Real64 powerLossToAir = fanShaftPower + ( fanPower_ - fanShaftPower )* motorInAirFrac_;
@@ -663,13 +690,13 @@ namespace HVACFan {
 					Real64 powerFractionAtLowMin = 0.0;
 					Real64 fanPoweratLowMinimum = 0.0;
 					if ( localFlowFractionForPower < minFlowFracLimitFanHeat ) {
-						powerFractionAtLowMin = CurveManager::CurveValue( powerModFuncFlowFractionCurveIndex_, minFlowFracLimitFanHeat );
+						powerFractionAtLowMin = calcPowerFraction( minFlowFracLimitFanHeat );
 
 						fanPoweratLowMinimum = powerFractionAtLowMin * maxAirMassFlowRate_ * localPressureRise / ( localFanTotEff * rhoAirStdInit_ );
 						fanPower_ = localFlowFractionForPower * fanPoweratLowMinimum / minFlowFracLimitFanHeat;
 					} else if ( localFlowFraction < minFlowFracLimitFanHeat ) {
 
-						powerFractionAtLowMin = CurveManager::CurveValue( powerModFuncFlowFractionCurveIndex_, minFlowFracLimitFanHeat );
+						powerFractionAtLowMin = calcPowerFraction( minFlowFracLimitFanHeat );
 						fanPoweratLowMinimum = powerFractionAtLowMin * maxAirMassFlowRate_ * localPressureRise / ( localFanTotEff * rhoAirStdInit_ );
 						fanPower_ = localFlowFraction * fanPoweratLowMinimum / minFlowFracLimitFanHeat;
 					}
@@ -826,6 +853,74 @@ namespace HVACFan {
 		}
 	}
 
+	Real64
+	FanSystem::calcPowerFraction(
+		Real64 const flowFraction // fan flow fraction of design maximum flow
+	)
+	{
+		if ( powerCurveTableFlag_ ) {
+			powerCurveTableFlag_ = false;
+			if ( DataSystemVariables::TabulateFanPowerCurves && ! DataGlobals::AnyEnergyManagementSystemInModel && powerModFuncFlowFractionCurveIndex_ > 0 ) {
+				tabulatePowerCurve();
+			}
+		}
+
+		if ( powerFractionTable_.empty() || flowFraction < 0.0 || flowFraction > 1.0 ) {
+			return CurveManager::CurveValue( powerModFuncFlowFractionCurveIndex_, flowFraction );
+		}
+
+		std::size_t const numIntervals = powerFractionTable_.size() - 1;
+		Real64 const position = flowFraction * numIntervals;
+		std::size_t const lower = min( std::size_t( position ), numIntervals - 1 );
+		Real64 const weight = position - lower;
+		Real64 const powerFraction = powerFractionTable_[ lower ] + weight * ( powerFractionTable_[ lower + 1 ] - powerFractionTable_[ lower ] );
+
+		// keep the curve report variables the same as CurveValue would leave them
+		auto & powerCurve( CurveManager::PerfCurve( powerModFuncFlowFractionCurveIndex_ ) );
+		powerCurve.CurveOutput = powerFraction;
+		powerCurve.CurveInput1 = flowFraction;
+		return powerFraction;
+	}
+
+	void
+	FanSystem::tabulatePowerCurve()
+	{
+		// Sample the power fraction curve at uniform flow fractions over 0..1 so that calcPowerFraction can
+		// interpolate instead of evaluating the curve.  The interpolation error is checked at the midpoint of
+		// every interval; the table is refined until it is within powerCurveTableTolerance, and dropped in
+		// favor of the curve if it never gets there.  The error found is reported to the eio file.
+
+		static gio::Fmt fmtA( "(A)" );
+
+		int numIntervals = powerCurveTableMinIntervals;
+		while ( true ) {
+			powerFractionTable_.resize( numIntervals + 1 );
+			for ( int loop = 0; loop <= numIntervals; ++loop ) {
+				powerFractionTable_[ loop ] = CurveManager::CurveValue( powerModFuncFlowFractionCurveIndex_, Real64( loop ) / numIntervals );
+			}
+			powerFractionTableMaxError_ = 0.0;
+			for ( int loop = 0; loop < numIntervals; ++loop ) {
+				Real64 const curvePowerFraction = CurveManager::CurveValue( powerModFuncFlowFractionCurveIndex_, ( loop + 0.5 ) / numIntervals );
+				Real64 const tablePowerFraction = 0.5 * ( powerFractionTable_[ loop ] + powerFractionTable_[ loop + 1 ] );
+				powerFractionTableMaxError_ = max( powerFractionTableMaxError_, std::abs( curvePowerFraction - tablePowerFraction ) );
+			}
+			if ( powerFractionTableMaxError_ <= powerCurveTableTolerance || numIntervals >= powerCurveTableMaxIntervals ) break;
+			numIntervals *= 2;
+		}
+
+		std::string status = "Tabulated";
+		if ( powerFractionTableMaxError_ > powerCurveTableTolerance ) {
+			powerFractionTable_.clear();
+			status = "Curve";
+		}
+
+		if ( ! powerCurveTableHeaderWritten ) {
+			gio::write( DataGlobals::OutputFileInits, fmtA ) << "! <Fan:SystemModel Power Curve Table>, Fan Name, Power Curve Name, Table Points, Maximum Interpolation Error, Method Used";
+			powerCurveTableHeaderWritten = true;
+		}
+		gio::write( DataGlobals::OutputFileInits, fmtA ) << " Fan:SystemModel Power Curve Table," + name_ + ',' + CurveManager::GetCurveName( powerModFuncFlowFractionCurveIndex_ ) + ',' + General::RoundSigDigits( numIntervals + 1 ) + ',' + General::RoundSigDigits( powerFractionTableMaxError_, 8 ) + ',' + status;
+	}
+
 } //HVACFan namespace
 
 } // EnergyPlus namespace
@@ -75,6 +75,11 @@ namespace EnergyPlus {
 
 namespace HVACFan {
 
+	// Clears the fan objects and their name registry.
+	// Needed for unit tests, should not be normally called.
+	void
+	clear_state();
+
 	int
 	getFanObjectVectorIndex( std::string const objectName );
 
@@ -135,6 +140,9 @@ public: // Methods
 	bool
 	getIfContinuousSpeedControl() const;
 
+	Real64
+	calcPowerFraction( Real64 const flowFraction ); // fraction of design power at a flow fraction, from the table when one has been built
+
 private: //methods
 
 	void
@@ -143,6 +151,9 @@ private: //methods
 	void
 	set_size();
 
+	void
+	tabulatePowerCurve();
+
 	void
 	calcSimpleSystemFan(
 		Optional< Real64 const > flowFraction,
@@ -248,6 +259,9 @@ private: // data
 	Real64 massFlowRateMinAvail_;
 	Real64 rhoAirStdInit_;
 	bool oneTimePowerCurveCheck_; // one time flag used for error message
+	bool powerCurveTableFlag_; // true until the power curve has been considered for tabulation
+	std::vector< Real64 > powerFractionTable_; // power fraction at uniform flow fractions over 0..1, empty when the curve is evaluated directly
+	Real64 powerFractionTableMaxError_; // largest interpolation error found at the table interval midpoints
 
 }; //class FanSystem 
 
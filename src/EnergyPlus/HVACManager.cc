@@ -57,8 +57,10 @@
 // in binary and source code form.
 
 // C++ Headers
+#include <algorithm>
 #include <cmath>
 #include <string>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -87,6 +89,7 @@
 #include <DataRoomAirModel.hh>
 #include <DataSurfaces.hh>
 #include <DataSystemVariables.hh>
+#include <DataZoneEnergyDemands.hh>
 #include <DataZoneEquipment.hh>
 #include <DemandManager.hh>
 #include <DisplayRoutines.hh>
@@ -95,6 +98,7 @@
 #include <General.hh>
 #include <HVACStandAloneERV.hh>
 #include <IceThermalStorage.hh>
+#include <InputProcessor.hh>
 #include <InternalHeatGains.hh>
 #include <NodeInputManager.hh>
 #include <NonZoneEquipmentManager.hh>
@@ -196,11 +200,14 @@ namespace HVACManager {
 	// Data
 	//MODULE PARAMETER DEFINITIONS:
 	static std::string const BlankString;
+	Real64 const QuiescentOutDryBulbTol( 0.5 ); // Max change in outdoor dry-bulb [C] before an idle system is resimulated
+	Real64 const QuiescentOutHumRatTol( 0.0005 ); // Max change in outdoor humidity ratio [kg/kg] before an idle system is resimulated
 
 	//MODULE VARIABLE DECLARATIONS:
 
 	int HVACManageIteration( 0 ); // counts iterations to enforce maximum iteration limit
 	int RepIterAir( 0 );
+	int RepNumSysTimeSteps( 0 ); // 1 on every system timestep, summed to report the number of system timesteps
 
 	//Array1D_bool CrossMixingReportFlag; // TRUE when Cross Mixing is active based on controls
 	//Array1D_bool MixingReportFlag; // TRUE when Mixing is active based on controls
@@ -215,6 +222,17 @@ namespace HVACManager {
 		bool SimHVACIterSetup( false );
 		bool TriggerGetAFN( true );
 		bool ReportAirHeatBalanceFirstTimeFlag( true );
+		// Quiescent system timestep skipping, see QuiescentHVACStep()
+		bool QuiescentHVACCheckModel( true ); // TRUE until the model has been checked for components with free-running state
+		bool QuiescentHVACModelOK( false ); // TRUE if no component changes state while the HVAC network is idle
+		bool QuiescentHVAC( false ); // TRUE if the last full SimHVAC call left the HVAC network idle
+		int QuiescentHourOfDay( 0 ); // hour of day of the last full SimHVAC call that left the network idle
+		Real64 QuiescentOutDryBulbTemp( 0.0 ); // outdoor dry-bulb at that call
+		Real64 QuiescentOutHumRat( 0.0 ); // outdoor humidity ratio at that call
+		Real64 QuiescentTimeStepSys( 0.0 ); // system timestep [hr] the carried summed outputs currently cover
+		Array1D< Real64 > QuiescentScheduleValues; // schedule values at that call
+		std::vector< Real64 * > QuiescentSummedVars; // summed system timestep report variables, rescaled while skipping
+		int QuiescentNumOfRVariable( -1 ); // NumOfRVariable when QuiescentSummedVars was built
 	}
 	//SUBROUTINE SPECIFICATIONS FOR MODULE PrimaryPlantLoops
 	// and zone equipment simulations
@@ -227,9 +245,20 @@ namespace HVACManager {
 	{
 		HVACManageIteration = 0;
 		RepIterAir = 0;
+		RepNumSysTimeSteps = 0;
 		SimHVACIterSetup = false;
 		TriggerGetAFN = true;
 		ReportAirHeatBalanceFirstTimeFlag = true;
+		QuiescentHVACCheckModel = true;
+		QuiescentHVACModelOK = false;
+		QuiescentHVAC = false;
+		QuiescentHourOfDay = 0;
+		QuiescentOutDryBulbTemp = 0.0;
+		QuiescentOutHumRat = 0.0;
+		QuiescentTimeStepSys = 0.0;
+		QuiescentScheduleValues.deallocate();
+		QuiescentSummedVars.clear();
+		QuiescentNumOfRVariable = -1;
 	}
 
 
@@ -257,7 +286,6 @@ namespace HVACManager {
 
 		// Using/Aliasing
 		using DataConvergParams::MinTimeStepSys; // =0.0166667     != 1 minute | 0.3 C = (1% OF 300 C) =max allowable diff between ZoneAirTemp at Time=T & T-1
-		using DataConvergParams::MaxZoneTempDiff;
 
 		using ZoneTempPredictorCorrector::ManageZoneAirUpdates;
 		using ZoneTempPredictorCorrector::DetectOscillatingZoneTemp;
@@ -337,6 +365,7 @@ namespace HVACManager {
 
 		static int ZTempTrendsNumSysSteps( 0 );
 		static int SysTimestepLoop( 0 );
+		bool DownStepSys; // true if the zone timestep is resimulated with shorter system timesteps
 		bool DummyLogical;
 
 		// Formats
@@ -418,7 +447,15 @@ namespace HVACManager {
 
 		if ( Contaminant.SimulateContaminants ) ManageZoneContaminanUpdates( iPredictStep, ShortenTimeStepSys, UseZoneTimeStepHistory, PriorTimeStep );
 
-		SimHVAC();
+		if ( QuiescentHVACStep() ) {
+			// Nothing in the HVAC network can respond this timestep: keep the node and component
+			// states (and so the reported values) of the last full simulation
+			HVACManageIteration = 0;
+			CarryQuiescentHVACOutputs();
+		} else {
+			SimHVAC();
+			UpdateQuiescentHVACState();
+		}
 
 		if ( AnyIdealCondEntSetPointInModel && MetersHaveBeenInitialized && ! WarmupFlag ) {
 			RunOptCondEntTemp = true;
@@ -439,10 +476,13 @@ namespace HVACManager {
 		ManageZoneAirUpdates( iCorrectStep, ZoneTempChange, ShortenTimeStepSys, UseZoneTimeStepHistory, PriorTimeStep );
 		if ( Contaminant.SimulateContaminants ) ManageZoneContaminanUpdates( iCorrectStep, ShortenTimeStepSys, UseZoneTimeStepHistory, PriorTimeStep );
 
-		if ( ZoneTempChange > MaxZoneTempDiff && ! KickOffSimulation ) {
+		// model how many system timesteps we want in zone timestep
+		ZTempTrendsNumSysSteps = 1;
+		if ( ! KickOffSimulation ) ZTempTrendsNumSysSteps = NumSysStepsForZoneTempChange( ZoneTempChange );
+		DownStepSys = ( ZTempTrendsNumSysSteps > 1 );
+
+		if ( DownStepSys ) {
 			//determine value of adaptive system time step
-			// model how many system timesteps we want in zone timestep
-			ZTempTrendsNumSysSteps = int( ZoneTempChange / MaxZoneTempDiff + 1.0 ); // add 1 for truncation
 			NumOfSysTimeSteps = min( ZTempTrendsNumSysSteps, LimitNumSysSteps );
 			//then determine timestep length for even distribution, protect div by zero
 			if ( NumOfSysTimeSteps > 0 ) TimeStepSys = TimeStepZone / NumOfSysTimeSteps;
@@ -472,6 +512,7 @@ namespace HVACManager {
 
 				if ( Contaminant.SimulateContaminants ) ManageZoneContaminanUpdates( iPredictStep, ShortenTimeStepSys, UseZoneTimeStepHistory, PriorTimeStep );
 				SimHVAC();
+				UpdateQuiescentHVACState();
 
 				if ( AnyIdealCondEntSetPointInModel && MetersHaveBeenInitialized && ! WarmupFlag ) {
 					RunOptCondEntTemp = true;
@@ -494,6 +535,7 @@ namespace HVACManager {
 			}
 
 			FracTimeStepZone = TimeStepSys / TimeStepZone;
+			RepNumSysTimeSteps = 1;
 
 			for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
 				ZTAV( ZoneNum ) += ZT( ZoneNum ) * FracTimeStepZone;
@@ -628,6 +670,52 @@ namespace HVACManager {
 
 	}
 
+	int
+	NumSysStepsForZoneTempChange( Real64 const ZoneTempChange ) // largest zone air temperature change over the zone timestep [C]
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Number of system timesteps wanted in the current zone timestep (before LimitNumSysSteps is applied).
+
+		// METHODOLOGY EMPLOYED:
+		// Without an error tolerance the zone timestep is split so that no zone air temperature changes
+		// by more than MaxZoneTempDiff per system timestep. With ZoneTempErrorTol set, the count comes from
+		// the estimated truncation error of the zone air temperature history instead, so smooth changes
+		// larger than MaxZoneTempDiff can take a single system timestep. A looser limit of
+		// ErrorControlTempDiffFactor * MaxZoneTempDiff is kept for sudden changes, such as system startup,
+		// that the history does not yet show.
+
+		// Using/Aliasing
+		using DataConvergParams::MaxZoneTempDiff;
+		using DataConvergParams::ZoneTempErrorTol;
+		using ZoneTempPredictorCorrector::MaxZoneTempTruncationError;
+		using ZoneTempPredictorCorrector::NumSysStepsForTruncationError;
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		Real64 const ErrorControlTempDiffFactor( 4.0 ); // multiple of MaxZoneTempDiff allowed per system timestep with error control
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		Real64 TempDiffLimit; // allowed zone air temperature change per system timestep [C]
+		int NumSysSteps( 1 );
+
+		if ( ZoneTempErrorTol > 0.0 ) {
+			NumSysSteps = NumSysStepsForTruncationError( MaxZoneTempTruncationError(), ZoneTempErrorTol );
+			TempDiffLimit = ErrorControlTempDiffFactor * MaxZoneTempDiff;
+		} else {
+			TempDiffLimit = MaxZoneTempDiff;
+		}
+		if ( ZoneTempChange > TempDiffLimit ) NumSysSteps = max( NumSysSteps, int( ZoneTempChange / TempDiffLimit + 1.0 ) ); // add 1 for truncation
+
+		return NumSysSteps;
+
+	}
+
 	void
 	SimHVAC()
 	{
@@ -770,6 +858,7 @@ namespace HVACManager {
 		if ( ! SimHVACIterSetup ) {
 			SetupOutputVariable( "HVAC System Solver Iteration Count []", HVACManageIteration, "HVAC", "Sum", "SimHVAC" );
 			SetupOutputVariable( "Air System Solver Iteration Count []", RepIterAir, "HVAC", "Sum", "SimHVAC" );
+			SetupOutputVariable( "HVAC System Timestep Count []", RepNumSysTimeSteps, "HVAC", "Sum", "SimHVAC" );
 			ManageSetPoints(); //need to call this before getting plant loop data so setpoint checks can complete okay
 			GetPlantLoopData();
 			GetPlantInput();
@@ -1498,6 +1587,218 @@ namespace HVACManager {
 
 	}
 
+	bool
+	QuiescentHVACStep()
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Returns TRUE if SimHVAC can be skipped for this system timestep because the HVAC
+		// outputs cannot differ from those of the last full simulation.
+
+		// METHODOLOGY EMPLOYED:
+		// Only active when the SkipQuiescentHVAC environment variable is set. The system is quiescent when
+		// - the last full SimHVAC call left no mass flow on any node and no non-air or system-dependent
+		//   zone loads (see UpdateQuiescentHVACState),
+		// - every schedule still has the value it had at that call, so availability, setpoint and
+		//   operation schedules cannot have turned anything on,
+		// - the zone predictor finds no sensible or moisture load in any zone (all zones float within
+		//   their thermostat deadband or are uncontrolled),
+		// - outdoor conditions are within QuiescentOutDryBulbTol/QuiescentOutHumRatTol of that call and
+		//   the hour of day is the same, which bounds the drift of outdoor-driven standby terms
+		//   (crankcase and basin heaters) and forces at least one full simulation every hour.
+		// Models with EMS, AirflowNetwork, hybrid ventilation, demand managers, electric load centers or
+		// components whose state keeps evolving without flow (tanks, thermal storage, ground heat exchangers,
+		// pipes, radiant slabs, refrigeration) never skip. Hybrid ventilation can open windows or change
+		// the system availability without any change in zone load.
+
+		// Using/Aliasing
+		using DataSystemVariables::SkipQuiescentHVAC;
+		using DataHeatBalFanSys::NonAirSystemResponse;
+		using DataZoneEnergyDemands::ZoneSysEnergyDemand;
+		using DataZoneEnergyDemands::ZoneSysMoistureDemand;
+		using DataGlobals::DoingSizing;
+		using InputProcessor::GetNumObjectsFound;
+		using ScheduleManager::NumSchedules;
+		using ScheduleManager::Schedule;
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		// Components with a state that evolves while the HVAC network has no flow, and controls
+		// that can change the HVAC operation without a zone load
+		static Array1D_string const FreeRunningObjects( {
+			"WaterHeater:Mixed",
+			"WaterHeater:Stratified",
+			"WaterHeater:HeatPump:PumpedCondenser",
+			"WaterHeater:HeatPump:WrappedCondenser",
+			"WaterUse:Equipment",
+			"ThermalStorage:Ice:Simple",
+			"ThermalStorage:Ice:Detailed",
+			"ThermalStorage:ChilledWater:Mixed",
+			"ThermalStorage:ChilledWater:Stratified",
+			"GroundHeatExchanger:Vertical",
+			"GroundHeatExchanger:Slinky",
+			"GroundHeatExchanger:Pond",
+			"GroundHeatExchanger:Surface",
+			"GroundHeatExchanger:HorizontalTrench",
+			"PipingSystem:Underground:Domain",
+			"Pipe:Indoor",
+			"Pipe:Outdoor",
+			"Pipe:Underground",
+			"ZoneHVAC:LowTemperatureRadiant:VariableFlow",
+			"ZoneHVAC:LowTemperatureRadiant:ConstantFlow",
+			"ZoneHVAC:LowTemperatureRadiant:Electric",
+			"ZoneHVAC:VentilatedSlab",
+			"SolarCollector:IntegralCollectorStorage",
+			"SolarCollector:FlatPlate:PhotovoltaicThermal",
+			"Refrigeration:CompressorRack",
+			"Refrigeration:System",
+			"Refrigeration:TranscriticalSystem",
+			"Refrigeration:AirChiller",
+			"AvailabilityManager:HybridVentilation",
+			"DemandManagerAssignmentList",
+			"ElectricLoadCenter:Distribution"
+		} );
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int ObjNum;
+		int ScheduleNum;
+		int ZoneNum;
+
+		if ( ! SkipQuiescentHVAC ) return false;
+
+		if ( QuiescentHVACCheckModel ) {
+			QuiescentHVACModelOK = ! AnyEnergyManagementSystemInModel && ! AnyIdealCondEntSetPointInModel && ( SimulateAirflowNetwork <= AirflowNetworkControlSimple );
+			for ( ObjNum = 1; ObjNum <= isize( FreeRunningObjects ); ++ObjNum ) {
+				if ( GetNumObjectsFound( FreeRunningObjects( ObjNum ) ) > 0 ) QuiescentHVACModelOK = false;
+			}
+			QuiescentHVACCheckModel = false;
+		}
+		if ( ! QuiescentHVACModelOK || ! QuiescentHVAC ) return false;
+		if ( BeginEnvrnFlag || KickOffSimulation || DoingSizing || ZoneSizingCalc || SysSizingCalc ) return false;
+		if ( HourOfDay != QuiescentHourOfDay ) return false;
+		if ( std::abs( OutDryBulbTemp - QuiescentOutDryBulbTemp ) > QuiescentOutDryBulbTol ) return false;
+		if ( std::abs( OutHumRat - QuiescentOutHumRat ) > QuiescentOutHumRatTol ) return false;
+
+		for ( ScheduleNum = 1; ScheduleNum <= NumSchedules; ++ScheduleNum ) {
+			if ( Schedule( ScheduleNum ).CurrentValue != QuiescentScheduleValues( ScheduleNum ) ) return false;
+		}
+
+		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			if ( ZoneSysEnergyDemand( ZoneNum ).TotalOutputRequired != 0.0 ) return false;
+			if ( ZoneSysMoistureDemand( ZoneNum ).TotalOutputRequired != 0.0 ) return false;
+			if ( NonAirSystemResponse( ZoneNum ) != 0.0 ) return false;
+		}
+
+		return true;
+
+	}
+
+	void
+	UpdateQuiescentHVACState()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// After a full SimHVAC call, record whether the HVAC network was left idle and, if so, the
+		// inputs it was simulated with. Used by QuiescentHVACStep() on the next system timestep.
+
+		// Using/Aliasing
+		using DataSystemVariables::SkipQuiescentHVAC;
+		using DataHeatBalFanSys::NonAirSystemResponse;
+		using DataHeatBalFanSys::SysDepZoneLoads;
+		using ScheduleManager::NumSchedules;
+		using ScheduleManager::Schedule;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int NodeNum;
+		int ScheduleNum;
+		int ZoneNum;
+
+		if ( ! SkipQuiescentHVAC ) return;
+
+		QuiescentHVAC = false;
+		if ( ! facilityElectricServiceObj->elecLoadCenterObjs.empty() ) return;
+		for ( NodeNum = 1; NodeNum <= NumOfNodes; ++NodeNum ) {
+			if ( Node( NodeNum ).MassFlowRate != 0.0 ) return;
+		}
+		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			if ( NonAirSystemResponse( ZoneNum ) != 0.0 || SysDepZoneLoads( ZoneNum ) != 0.0 ) return;
+		}
+
+		QuiescentHVAC = true;
+		QuiescentHourOfDay = HourOfDay;
+		QuiescentOutDryBulbTemp = OutDryBulbTemp;
+		QuiescentOutHumRat = OutHumRat;
+		QuiescentTimeStepSys = TimeStepSys;
+		if ( ! allocated( QuiescentScheduleValues ) ) QuiescentScheduleValues.allocate( NumSchedules );
+		for ( ScheduleNum = 1; ScheduleNum <= NumSchedules; ++ScheduleNum ) {
+			QuiescentScheduleValues( ScheduleNum ) = Schedule( ScheduleNum ).CurrentValue;
+		}
+
+	}
+
+	void
+	CarryQuiescentHVACOutputs()
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Keep the outputs carried from the last full SimHVAC call consistent with the current system
+		// timestep when SimHVAC is skipped.
+
+		// METHODOLOGY EMPLOYED:
+		// Summed system timestep report variables (energies, volumes and masses) hold the amount over
+		// the timestep they were calculated for. While the system is quiescent the rates behind them are
+		// constant, so when the system timestep changes each one is rescaled by the ratio of the current
+		// to the previous timestep. Averaged variables (rates and states) are carried unchanged.
+
+		// Using/Aliasing
+		using OutputProcessor::NumOfRVariable;
+		using OutputProcessor::RVariableTypes;
+		using OutputProcessor::HVACVar;
+		using OutputProcessor::SummedVar;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		int Loop;
+		Real64 TimeStepRatio; // current to carried system timestep
+
+		if ( TimeStepSys == QuiescentTimeStepSys || QuiescentTimeStepSys <= 0.0 ) return;
+
+		if ( QuiescentNumOfRVariable != NumOfRVariable ) {
+			// the same variable can be registered under more than one report name, so rescale each once
+			QuiescentSummedVars.clear();
+			for ( Loop = 1; Loop <= NumOfRVariable; ++Loop ) {
+				if ( RVariableTypes( Loop ).IndexType != HVACVar || RVariableTypes( Loop ).StoreType != SummedVar ) continue;
+				QuiescentSummedVars.push_back( &RVariableTypes( Loop ).VarPtr().Which() );
+			}
+			std::sort( QuiescentSummedVars.begin(), QuiescentSummedVars.end() );
+			QuiescentSummedVars.erase( std::unique( QuiescentSummedVars.begin(), QuiescentSummedVars.end() ), QuiescentSummedVars.end() );
+			QuiescentNumOfRVariable = NumOfRVariable;
+		}
+
+		TimeStepRatio = TimeStepSys / QuiescentTimeStepSys;
+		for ( Real64 * const SummedVarPtr : QuiescentSummedVars ) {
+			*SummedVarPtr *= TimeStepRatio;
+		}
+		QuiescentTimeStepSys = TimeStepSys;
+
+	}
+
 	void
 	SimSelectedEquipment(
 		bool & SimAirLoops, // True when the air loops need to be (re)simulated
@@ -77,6 +77,7 @@ namespace HVACManager {
 
 	extern int HVACManageIteration; // counts iterations to enforce maximum iteration limit
 	extern int RepIterAir;
+	extern int RepNumSysTimeSteps; // 1 on every system timestep, summed to report the number of system timesteps
 
 	//SUBROUTINE SPECIFICATIONS FOR MODULE PrimaryPlantLoops
 	// and zone equipment simulations
@@ -88,9 +89,21 @@ namespace HVACManager {
 	void
 	ManageHVAC();
 
+	int
+	NumSysStepsForZoneTempChange( Real64 const ZoneTempChange ); // largest zone air temperature change over the zone timestep [C]
+
 	void
 	SimHVAC();
 
+	bool
+	QuiescentHVACStep();
+
+	void
+	UpdateQuiescentHVACState();
+
+	void
+	CarryQuiescentHVACOutputs();
+
 	void
 	SimSelectedEquipment(
 		bool & SimAirLoops, // True when the air loops need to be (re)simulated
@@ -78,6 +78,7 @@
 #include <DataMoistureBalance.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <General.hh>
 #include <HeatBalanceMovableInsulation.hh>
 #include <InputProcessor.hh>
@@ -1148,6 +1149,7 @@ namespace HeatBalFiniteDiffManager {
 		// Using/Aliasing
 //		using General::RoundSigDigits;
 		using DataHeatBalance::CondFDRelaxFactor;
+		using DataSystemVariables::CondFDLayerDirectSolve;
 //		using DataGlobals::KickOffSimulation;
 
 		// Locals
@@ -1217,9 +1219,15 @@ namespace HeatBalFiniteDiffManager {
 					// For the Layer Interior nodes.  Arrive here after exterior surface node or interface node
 
 					if ( TotNodes != 1 ) {
-						for ( int ctr = 2, ctr_end = ConstructFD( ConstrNum ).NodeNumPoint( Lay ); ctr <= ctr_end; ++ctr ) {
-							++i;
-							InteriorNodeEqns( Delt, i, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew );
+						int const ctr_end( ConstructFD( ConstrNum ).NodeNumPoint( Lay ) );
+						if ( CondFDLayerDirectSolve && ( ctr_end > 2 ) ) { // solve the layer's interior nodes together
+							InteriorLayerEqns( Delt, i + 1, i + ctr_end - 1, Lay, Surf, TD, TDT, EnthOld, EnthNew );
+							i += ctr_end - 1;
+						} else {
+							for ( int ctr = 2; ctr <= ctr_end; ++ctr ) {
+								++i;
+								InteriorNodeEqns( Delt, i, Lay, Surf, T, TT, Rhov, RhoT, RH, TD, TDT, EnthOld, EnthNew );
+							}
 						}
 					}
 
@@ -1838,13 +1846,77 @@ namespace HeatBalFiniteDiffManager {
 
 		int const MatLay( Construct( ConstrNum ).LayerPoint( Lay ) );
 		auto const & mat( Material( MatLay ) );
-		auto const & matFD( MaterialFD( MatLay ) );
 
 		auto const TD_i( TD( i ) );
 
 		auto const TDT_m( TDT( i - 1 ) );
 		auto TDT_i( TDT( i ) );
 		auto const TDT_p( TDT( i + 1 ) );
+
+		Real64 ktA1; // Variable Outer Thermal conductivity in temperature equation
+		Real64 ktA2; // Thermal Inner conductivity in temperature equation
+		Real64 Cp; // Cp used // Will be changed if PCM
+		InteriorNodeProperties( MatLay, i, TD, TDT, EnthOld, EnthNew, ktA1, ktA2, Cp );
+
+		Real64 const RhoS( mat.Density );
+		Real64 const DelX( ConstructFD( ConstrNum ).DelX( Lay ) );
+		Real64 const Cp_DelX_RhoS_Delt( Cp * DelX * RhoS / Delt );
+		if ( CondFDSchemeType == CrankNicholsonSecondOrder ) { // Adams-Moulton second order
+			Real64 const inv2DelX( 1.0 / ( 2.0 * DelX ) );
+			TDT_i = ( ( Cp_DelX_RhoS_Delt * TD_i ) + ( ( ktA1 * ( TD( i + 1 ) - TD_i + TDT_p ) + ktA2 * ( TD( i - 1 ) - TD_i + TDT_m ) ) * inv2DelX ) ) / ( ( ( ktA1 + ktA2 ) * inv2DelX ) + Cp_DelX_RhoS_Delt );
+		} else if ( CondFDSchemeType == FullyImplicitFirstOrder ) { // Adams-Moulton First order
+			Real64 const invDelX( 1.0 / DelX );
+			TDT_i = ( ( Cp_DelX_RhoS_Delt * TD_i ) + ( ( ktA2 * TDT_m ) + ( ktA1 * TDT_p ) ) * invDelX ) / ( ( ( ktA1 + ktA2 ) * invDelX ) + Cp_DelX_RhoS_Delt );
+		} else {
+			assert( false ); // Illegal CondFDSchemeType
+		}
+
+		// Limit clipping
+		if ( TDT_i < MinSurfaceTempLimit ) {
+			TDT_i = MinSurfaceTempLimit;
+		} else if ( TDT_i > MaxSurfaceTempLimit ) {
+			TDT_i = MaxSurfaceTempLimit;
+		}
+
+		TDT( i ) = TDT_i;
+		SurfaceFD( Surf ).CpDelXRhoS1( i ) = SurfaceFD( Surf ).CpDelXRhoS2( i ) = ( Cp * DelX * RhoS ) / 2.0; // Save this for computing node flux values, half nodes are the same here
+	}
+
+	void
+	InteriorNodeProperties(
+		int const MatLay, // Material of the layer
+		int const i, // Node Index
+		Array1< Real64 > const & TD, // OLD NODE TEMPERATURES OF EACH HEAT TRANSFER SURF IN CONDFD.
+		Array1< Real64 > const & TDT, // NEW NODE TEMPERATURES OF EACH HEAT TRANSFER SURF IN CONDFD.
+		Array1< Real64 > & EnthOld, // Old Nodal enthalpy
+		Array1< Real64 > & EnthNew, // New Nodal enthalpy
+		Real64 & ktA1, // Thermal conductivity between the node and the next node
+		Real64 & ktA2, // Thermal conductivity between the node and the previous node
+		Real64 & Cp // Specific heat, effective specific heat for phase change materials
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Evaluate the temperature dependent conductivities and specific heat of an interior layer node
+		// at the current iteration's node temperatures.
+
+		// METHODOLOGY EMPLOYED:
+		// Split out of InteriorNodeEqns so that InteriorLayerEqns uses the same properties.
+
+		auto const & mat( Material( MatLay ) );
+		auto const & matFD( MaterialFD( MatLay ) );
+
+		auto const TD_i( TD( i ) );
+
+		auto const TDT_m( TDT( i - 1 ) );
+		auto const TDT_i( TDT( i ) );
+		auto const TDT_p( TDT( i + 1 ) );
 		auto const TDT_mi( ( TDT_m + TDT_i ) / 2.0 );
 		auto const TDT_ip( ( TDT_i + TDT_p ) / 2.0 );
 
@@ -1852,8 +1924,6 @@ namespace HeatBalFiniteDiffManager {
 		auto const & matFD_TempCond( matFD.TempCond );
 		assert( matFD_TempCond.u2() >= 3 );
 		auto const lTC( matFD_TempCond.index( 2, 1 ) );
-		Real64 ktA1; // Variable Outer Thermal conductivity in temperature equation
-		Real64 ktA2; // Thermal Inner conductivity in temperature equation
 		if ( matFD_TempCond[ lTC ] + matFD_TempCond[ lTC+1 ] + matFD_TempCond[ lTC+2 ] >= 0.0 ) { // Multiple Linear Segment Function
 			ktA1 = terpld( matFD.TempCond, TDT_ip, 1, 2 ); // 1: Temperature, 2: Thermal conductivity
 			ktA2 = terpld( matFD.TempCond, TDT_mi, 1, 2 ); // 1: Temperature, 2: Thermal conductivity
@@ -1867,7 +1937,7 @@ namespace HeatBalFiniteDiffManager {
 		}
 
 		Real64 const Cpo( mat.SpecHeat ); // Const Cp from input
-		Real64 Cp( Cpo ); // Cp used // Will be changed if PCM
+		Cp = Cpo;
 		auto const & matFD_TempEnth( matFD.TempEnth );
 		assert( matFD_TempEnth.u2() >= 3 );
 		auto const lTE( matFD_TempEnth.index( 2, 1 ) );
@@ -1878,29 +1948,102 @@ namespace HeatBalFiniteDiffManager {
 				Cp = max( Cpo, ( EnthNew( i ) - EnthOld( i ) ) / ( TDT_i - TD_i ) );
 			}
 		} // Phase Change case
+	}
 
-		Real64 const RhoS( mat.Density );
+	void
+	InteriorLayerEqns(
+		int const Delt, // Time Increment
+		int const iFirst, // First interior node of the layer
+		int const iLast, // Last interior node of the layer
+		int const Lay, // Layer Number for Construction
+		int const Surf, // Surface number
+		Array1< Real64 > const & TD, // OLD NODE TEMPERATURES OF EACH HEAT TRANSFER SURF IN CONDFD.
+		Array1< Real64 > & TDT, // NEW NODE TEMPERATURES OF EACH HEAT TRANSFER SURF IN CONDFD.
+		Array1< Real64 > & EnthOld, // Old Nodal enthalpy
+		Array1< Real64 > & EnthNew // New Nodal enthalpy
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Solve the InteriorNodeEqns of all the interior nodes of a layer together, used in place of
+		// one InteriorNodeEqns sweep when CondFDLayerDirectSolve is set.
+
+		// METHODOLOGY EMPLOYED:
+		// The conductivities and specific heats are evaluated at the current iteration's temperatures, which
+		// makes the layer's node equations linear and tridiagonal.  The nodes bounding the layer (surface or
+		// interface nodes) are held at their current values and the system is solved directly.  The outer
+		// Gauss-Seidel iteration in CalcHeatBalFiniteDiff updates the properties (and the phase change
+		// enthalpies) and the boundary nodes, so heat diffuses across a whole layer in one iteration rather
+		// than one node per iteration.
+
+		// Using/Aliasing
+		using General::SolveTridiagonal;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static Array1D< Real64 > A; // Coefficient of the previous node temperature
+		static Array1D< Real64 > B; // Coefficient of the node temperature
+		static Array1D< Real64 > C; // Coefficient of the next node temperature
+		static Array1D< Real64 > D; // Right hand side, then new node temperatures
+		static Array1D< Real64 > W; // Scratch array for the tridiagonal solution
+
+		int const ConstrNum( Surface( Surf ).Construction );
+		int const MatLay( Construct( ConstrNum ).LayerPoint( Lay ) );
+		Real64 const RhoS( Material( MatLay ).Density );
 		Real64 const DelX( ConstructFD( ConstrNum ).DelX( Lay ) );
-		Real64 const Cp_DelX_RhoS_Delt( Cp * DelX * RhoS / Delt );
-		if ( CondFDSchemeType == CrankNicholsonSecondOrder ) { // Adams-Moulton second order
-			Real64 const inv2DelX( 1.0 / ( 2.0 * DelX ) );
-			TDT_i = ( ( Cp_DelX_RhoS_Delt * TD_i ) + ( ( ktA1 * ( TD( i + 1 ) - TD_i + TDT_p ) + ktA2 * ( TD( i - 1 ) - TD_i + TDT_m ) ) * inv2DelX ) ) / ( ( ( ktA1 + ktA2 ) * inv2DelX ) + Cp_DelX_RhoS_Delt );
-		} else if ( CondFDSchemeType == FullyImplicitFirstOrder ) { // Adams-Moulton First order
-			Real64 const invDelX( 1.0 / DelX );
-			TDT_i = ( ( Cp_DelX_RhoS_Delt * TD_i ) + ( ( ktA2 * TDT_m ) + ( ktA1 * TDT_p ) ) * invDelX ) / ( ( ( ktA1 + ktA2 ) * invDelX ) + Cp_DelX_RhoS_Delt );
-		} else {
-			assert( false ); // Illegal CondFDSchemeType
+		auto & surfaceFD( SurfaceFD( Surf ) );
+
+		int const N( iLast - iFirst + 1 );
+		if ( A.isize() < N ) {
+			A.allocate( N );
+			B.allocate( N );
+			C.allocate( N );
+			D.allocate( N );
+			W.allocate( N );
 		}
 
-		// Limit clipping
-		if ( TDT_i < MinSurfaceTempLimit ) {
-			TDT_i = MinSurfaceTempLimit;
-		} else if ( TDT_i > MaxSurfaceTempLimit ) {
-			TDT_i = MaxSurfaceTempLimit;
+		for ( int n = 1; n <= N; ++n ) {
+			int const i( iFirst + n - 1 );
+			Real64 ktA1; // Variable Outer Thermal conductivity in temperature equation
+			Real64 ktA2; // Thermal Inner conductivity in temperature equation
+			Real64 Cp; // Cp used // Will be changed if PCM
+			InteriorNodeProperties( MatLay, i, TD, TDT, EnthOld, EnthNew, ktA1, ktA2, Cp );
+
+			Real64 const Cp_DelX_RhoS_Delt( Cp * DelX * RhoS / Delt );
+			if ( CondFDSchemeType == CrankNicholsonSecondOrder ) { // Adams-Moulton second order
+				Real64 const inv2DelX( 1.0 / ( 2.0 * DelX ) );
+				A( n ) = -ktA2 * inv2DelX;
+				B( n ) = ( ( ktA1 + ktA2 ) * inv2DelX ) + Cp_DelX_RhoS_Delt;
+				C( n ) = -ktA1 * inv2DelX;
+				D( n ) = ( Cp_DelX_RhoS_Delt * TD( i ) ) + ( ( ktA1 * ( TD( i + 1 ) - TD( i ) ) + ktA2 * ( TD( i - 1 ) - TD( i ) ) ) * inv2DelX );
+			} else if ( CondFDSchemeType == FullyImplicitFirstOrder ) { // Adams-Moulton First order
+				Real64 const invDelX( 1.0 / DelX );
+				A( n ) = -ktA2 * invDelX;
+				B( n ) = ( ( ktA1 + ktA2 ) * invDelX ) + Cp_DelX_RhoS_Delt;
+				C( n ) = -ktA1 * invDelX;
+				D( n ) = Cp_DelX_RhoS_Delt * TD( i );
+			} else {
+				assert( false ); // Illegal CondFDSchemeType
+			}
+
+			surfaceFD.CpDelXRhoS1( i ) = surfaceFD.CpDelXRhoS2( i ) = ( Cp * DelX * RhoS ) / 2.0; // Save this for computing node flux values, half nodes are the same here
 		}
 
-		TDT( i ) = TDT_i;
-		SurfaceFD( Surf ).CpDelXRhoS1( i ) = SurfaceFD( Surf ).CpDelXRhoS2( i ) = ( Cp * DelX * RhoS ) / 2.0; // Save this for computing node flux values, half nodes are the same here
+		// The nodes bounding the layer are known
+		D( 1 ) -= A( 1 ) * TDT( iFirst - 1 );
+		D( N ) -= C( N ) * TDT( iLast + 1 );
+
+		SolveTridiagonal( N, A, B, C, D, W );
+
+		for ( int n = 1; n <= N; ++n ) {
+			// Limit clipping
+			TDT( iFirst + n - 1 ) = min( max( D( n ), MinSurfaceTempLimit ), MaxSurfaceTempLimit );
+		}
 	}
 
 	void
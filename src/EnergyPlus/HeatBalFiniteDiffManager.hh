@@ -330,6 +330,32 @@ namespace HeatBalFiniteDiffManager {
 		Array1< Real64 > & EnthNew // New Nodal enthalpy
 	);
 
+	void
+	InteriorNodeProperties(
+		int const MatLay, // Material of the layer
+		int const i, // Node Index
+		Array1< Real64 > const & TD, // OLD NODE TEMPERATURES OF EACH HEAT TRANSFER SURF IN CONDFD.
+		Array1< Real64 > const & TDT, // NEW NODE TEMPERATURES OF EACH HEAT TRANSFER SURF IN CONDFD.
+		Array1< Real64 > & EnthOld, // Old Nodal enthalpy
+		Array1< Real64 > & EnthNew, // New Nodal enthalpy
+		Real64 & ktA1, // Thermal conductivity between the node and the next node
+		Real64 & ktA2, // Thermal conductivity between the node and the previous node
+		Real64 & Cp // Specific heat, effective specific heat for phase change materials
+	);
+
+	void
+	InteriorLayerEqns(
+		int const Delt, // Time Increment
+		int const iFirst, // First interior node of the layer
+		int const iLast, // Last interior node of the layer
+		int const Lay, // Layer Number for Construction
+		int const Surf, // Surface number
+		Array1< Real64 > const & TD, // OLD NODE TEMPERATURES OF EACH HEAT TRANSFER SURF IN CONDFD.
+		Array1< Real64 > & TDT, // NEW NODE TEMPERATURES OF EACH HEAT TRANSFER SURF IN CONDFD.
+		Array1< Real64 > & EnthOld, // Old Nodal enthalpy
+		Array1< Real64 > & EnthNew // New Nodal enthalpy
+	);
+
 	void
 	IntInterfaceNodeEqns(
 		int const Delt, // Time Increment
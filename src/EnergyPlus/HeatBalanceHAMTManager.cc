@@ -57,6 +57,7 @@
 // in binary and source code form.
 
 // C++ Headers
+#include <cassert>
 #include <cmath>
 #include <string>
 
@@ -74,6 +75,7 @@
 #include <DataHeatBalSurface.hh>
 #include <DataMoistureBalance.hh>
 #include <DataSurfaces.hh>
+#include <DataSystemVariables.hh>
 #include <DisplayRoutines.hh>
 #include <General.hh>
 #include <InputProcessor.hh>
@@ -183,6 +185,7 @@ namespace HeatBalanceHAMTManager {
 	Array1D_bool extvtcflag; // External Surface vapor transfer coefficient flag
 	Array1D_bool intvtcflag; // Internal Surface Vapor Transfer Coefficient flag
 	Array1D_bool MyEnvrnFlag; // Flag to reset surface properties.
+	Array1D_bool cellchain; // TRUE if each cell from Extcell to Intcell is only adjacent to its neighbours in that range
 
 	Real64 deltat( 0.0 ); // time step in seconds
 
@@ -353,12 +356,14 @@ namespace HeatBalanceHAMTManager {
 		extvtcflag.allocate( TotSurfaces );
 		intvtcflag.allocate( TotSurfaces );
 		MyEnvrnFlag.allocate( TotSurfaces );
+		cellchain.allocate( TotSurfaces );
 
 		extvtc = -1.0;
 		intvtc = -1.0;
 		extvtcflag = false;
 		intvtcflag = false;
 		MyEnvrnFlag = true;
+		cellchain = false;
 
 		latswitch = true;
 		rainswitch = true;
@@ -688,6 +693,7 @@ namespace HeatBalanceHAMTManager {
 		using General::TrimSigDigits;
 		using General::ScanForReports;
 		using General::RoundSigDigits;
+		using DataSystemVariables::HAMTDirectSolve;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -933,9 +939,10 @@ namespace HeatBalanceHAMTManager {
 
 		}
 
-		// Find adjacent cells.
+		// Find adjacent cells. Only cells of the same surface can be adjacent, and they are numbered together.
 		for ( cid1 = 1; cid1 <= TotCellsMax; ++cid1 ) {
-			for ( cid2 = 1; cid2 <= TotCellsMax; ++cid2 ) {
+			sid = cells( cid1 ).sid;
+			for ( cid2 = firstcell( sid ); cid2 <= lastcell( sid ); ++cid2 ) {
 				if ( ( cid1 != cid2 ) && ( cells( cid1 ).sid == cells( cid2 ).sid ) ) {
 					high1 = cells( cid1 ).origin( 1 ) + cells( cid1 ).length( 1 ) / 2.0;
 					low2 = cells( cid2 ).origin( 1 ) - cells( cid2 ).length( 1 ) / 2.0;
@@ -984,6 +991,11 @@ namespace HeatBalanceHAMTManager {
 			surftemp( sid ) = 0.0;
 			surfexttemp( sid ) = 0.0;
 			surfvp( sid ) = 0.0;
+			cellchain( sid ) = CellsFormChain( sid );
+			if ( HAMTDirectSolve && ! cellchain( sid ) ) {
+				ShowWarningError( RoutineName + "Surface=" + Surface( sid ).Name + " cells cannot be solved together (HAMTDirectSolve)." );
+				ShowContinueError( "...The cells of this surface are updated one at a time." );
+			}
 			SetupOutputVariable( "HAMT Surface Average Water Content Ratio [kg/kg]", watertot( sid ), "Zone", "State", Surface( sid ).Name );
 			SetupOutputVariable( "HAMT Surface Inside Face Temperature [C]", surftemp( sid ), "Zone", "State", Surface( sid ).Name );
 			SetupOutputVariable( "HAMT Surface Inside Face Relative Humidity [%]", surfrh( sid ), "Zone", "State", Surface( sid ).Name );
@@ -1030,6 +1042,31 @@ namespace HeatBalanceHAMTManager {
 
 	}
 
+	bool
+	CellsFormChain( int const sid )
+	{
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Check that every cell from Extcell to Intcell of a surface is only adjacent to the cells before and
+		// after it within that range, so that their equations are tridiagonal and can be solved together
+		// (HAMTDirectSolve).  Adjacent cells outside the range are boundary values.
+
+		for ( int cid = Extcell( sid ); cid <= Intcell( sid ); ++cid ) {
+			for ( int ii = 1; ii <= adjmax; ++ii ) {
+				int const adj( cells( cid ).adjs( ii ) );
+				if ( adj == -1 ) break;
+				if ( ( adj < Extcell( sid ) ) || ( adj > Intcell( sid ) ) ) continue;
+				if ( std::abs( adj - cid ) != 1 ) return false;
+			}
+		}
+		return true;
+	}
+
 	void
 	CalcHeatBalHAMT(
 		int const sid,
@@ -1054,8 +1091,10 @@ namespace HeatBalanceHAMTManager {
 
 		// Using/Aliasing
 		using General::RoundSigDigits;
+		using General::SolveTridiagonal;
 		using DataSurfaces::OtherSideCondModeledExt;
 		using DataSurfaces::OSCM;
+		using DataSystemVariables::HAMTDirectSolve;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -1108,6 +1147,26 @@ namespace HeatBalanceHAMTManager {
 		static int qvpErrReport( 0 );
 		Real64 denominator;
 
+		// With HAMTDirectSolve the cells from Extcell to Intcell are solved together in each iteration instead of
+		// being updated one at a time, when InitHeatBalHAMT found that they form a chain (cellchain).  The resistances
+		// and capacitances are evaluated as for the cell by cell update, so the outer iteration still updates the
+		// material properties.
+		bool const DirectSolve( HAMTDirectSolve && cellchain( sid ) );
+		static Array1D< Real64 > A; // Coefficient of the previous cell
+		static Array1D< Real64 > B; // Coefficient of the cell
+		static Array1D< Real64 > C; // Coefficient of the next cell
+		static Array1D< Real64 > D; // Right hand side, then the solution
+		static Array1D< Real64 > W; // Scratch array for the tridiagonal solution
+		int const NumChainCells( Intcell( sid ) - Extcell( sid ) + 1 );
+		if ( DirectSolve && ( A.isize() < NumChainCells ) ) {
+			A.allocate( NumChainCells );
+			B.allocate( NumChainCells );
+			C.allocate( NumChainCells );
+			D.allocate( NumChainCells );
+			W.allocate( NumChainCells );
+		}
+		int n; // position of a cell in the chain
+
 		if ( BeginEnvrnFlag && MyEnvrnFlag( sid ) ) {
 			cells( Extcell( sid ) ).rh = 0.0;
 			cells( Extcell( sid ) ).rhp1 = 0.0;
@@ -1254,10 +1313,18 @@ namespace HeatBalanceHAMTManager {
 				torsum = 0.0;
 				oorsum = 0.0;
 				vpdiff = 0.0;
+				n = cid - Extcell( sid ) + 1;
+				if ( DirectSolve ) {
+					A( n ) = 0.0;
+					C( n ) = 0.0;
+				}
 				for ( ii = 1; ii <= adjmax; ++ii ) {
 					adj = cells( cid ).adjs( ii );
 					adjl = cells( cid ).adjsl( ii );
 					if ( adj == -1 ) break;
+					// -1 or 1 for the previous or next cell of the chain when it is solved together, otherwise 0
+					int const adjSide( ( DirectSolve && ( adj >= Extcell( sid ) ) && ( adj <= Intcell( sid ) ) ) ? adj - cid : 0 );
+					assert( std::abs( adjSide ) <= 1 );
 
 					if ( cells( cid ).htc > 0 ) {
 						thermr1 = 1.0 / ( cells( cid ).overlap( ii ) * cells( cid ).htc );
@@ -1293,7 +1360,13 @@ namespace HeatBalanceHAMTManager {
 
 					if ( thermr1 + thermr2 > 0 ) {
 						oorsum += 1.0 / ( thermr1 + thermr2 );
-						torsum += cells( adj ).tempp1 / ( thermr1 + thermr2 );
+						if ( adjSide == -1 ) {
+							A( n ) -= 1.0 / ( thermr1 + thermr2 );
+						} else if ( adjSide == 1 ) {
+							C( n ) -= 1.0 / ( thermr1 + thermr2 );
+						} else {
+							torsum += cells( adj ).tempp1 / ( thermr1 + thermr2 );
+						}
 					}
 					if ( vaporr1 + vaporr2 > 0 ) {
 						vpdiff += ( cells( adj ).vp - cells( cid ).vp ) / ( vaporr1 + vaporr2 );
@@ -1322,7 +1395,18 @@ namespace HeatBalanceHAMTManager {
 				}
 
 				// Calculate the temperature for the next time step
-				cells( cid ).tempp1 = ( torsum + qvp + cells( cid ).Qadds + ( tcap * cells( cid ).temp / deltat ) ) / ( oorsum + ( tcap / deltat ) );
+				if ( DirectSolve ) {
+					B( n ) = oorsum + ( tcap / deltat );
+					D( n ) = torsum + qvp + cells( cid ).Qadds + ( tcap * cells( cid ).temp / deltat );
+				} else {
+					cells( cid ).tempp1 = ( torsum + qvp + cells( cid ).Qadds + ( tcap * cells( cid ).temp / deltat ) ) / ( oorsum + ( tcap / deltat ) );
+				}
+			}
+			if ( DirectSolve ) {
+				SolveTridiagonal( NumChainCells, A, B, C, D, W );
+				for ( cid = Extcell( sid ); cid <= Intcell( sid ); ++cid ) {
+					cells( cid ).tempp1 = D( cid - Extcell( sid ) + 1 );
+				}
 			}
 
 			// Check for silly temperatures
@@ -1367,11 +1451,19 @@ namespace HeatBalanceHAMTManager {
 				phiorsum = 0.0;
 				vpoosum = 0.0;
 				vporsum = 0.0;
+				n = cid - Extcell( sid ) + 1;
+				if ( DirectSolve ) {
+					A( n ) = 0.0;
+					C( n ) = 0.0;
+				}
 
 				for ( ii = 1; ii <= adjmax; ++ii ) {
 					adj = cells( cid ).adjs( ii );
 					adjl = cells( cid ).adjsl( ii );
 					if ( adj == -1 ) break;
+					// -1 or 1 for the previous or next cell of the chain when it is solved together, otherwise 0
+					int const adjSide( ( DirectSolve && ( adj >= Extcell( sid ) ) && ( adj <= Intcell( sid ) ) ) ? adj - cid : 0 );
+					assert( std::abs( adjSide ) <= 1 );
 
 					if ( cells( cid ).vtc > 0 ) {
 						vaporr1 = 1.0 / ( cells( cid ).overlap( ii ) * cells( cid ).vtc );
@@ -1390,7 +1482,13 @@ namespace HeatBalanceHAMTManager {
 					}
 					if ( vaporr1 + vaporr2 > 0 ) {
 						vpoosum += 1.0 / ( vaporr1 + vaporr2 );
-						vporsum += ( cells( adj ).vpp1 / ( vaporr1 + vaporr2 ) );
+						if ( adjSide == -1 ) {
+							A( n ) -= cells( adj ).vpsat / ( vaporr1 + vaporr2 );
+						} else if ( adjSide == 1 ) {
+							C( n ) -= cells( adj ).vpsat / ( vaporr1 + vaporr2 );
+						} else {
+							vporsum += ( cells( adj ).vpp1 / ( vaporr1 + vaporr2 ) );
+						}
 					}
 
 					if ( ( cells( cid ).dw > 0 ) && ( cells( cid ).dwdphi > 0 ) ) {
@@ -1407,7 +1505,13 @@ namespace HeatBalanceHAMTManager {
 					//             IF(rhr1+rhr2>0)THEN
 					if ( rhr1 * rhr2 > 0 ) {
 						phioosum += 1.0 / ( rhr1 + rhr2 );
-						phiorsum += ( cells( adj ).rhp1 / ( rhr1 + rhr2 ) );
+						if ( adjSide == -1 ) {
+							A( n ) -= 1.0 / ( rhr1 + rhr2 );
+						} else if ( adjSide == 1 ) {
+							C( n ) -= 1.0 / ( rhr1 + rhr2 );
+						} else {
+							phiorsum += ( cells( adj ).rhp1 / ( rhr1 + rhr2 ) );
+						}
 					}
 
 				}
@@ -1422,7 +1526,12 @@ namespace HeatBalanceHAMTManager {
 				// Calculate the RH for the next time step
 				denominator = ( phioosum + vpoosum * cells( cid ).vpsat + wcap / deltat );
 				if ( denominator != 0.0 ) {
-					cells( cid ).rhp1 = ( phiorsum + vporsum + ( wcap * cells( cid ).rh ) / deltat ) / denominator;
+					if ( DirectSolve ) {
+						B( n ) = denominator;
+						D( n ) = phiorsum + vporsum + ( wcap * cells( cid ).rh ) / deltat;
+					} else {
+						cells( cid ).rhp1 = ( phiorsum + vporsum + ( wcap * cells( cid ).rh ) / deltat ) / denominator;
+					}
 				} else {
 					ShowSevereError( "CalcHeatBalHAMT: demoninator in calculating RH is zero.  Check material properties for accuracy." );
 					ShowContinueError( "...Problem occurs in Material=\"" + Material( cells( cid ).matid ).Name + "\"." );
@@ -1433,6 +1542,12 @@ namespace HeatBalanceHAMTManager {
 					cells( cid ).rhp1 = rhmax;
 				}
 			}
+			if ( DirectSolve ) {
+				SolveTridiagonal( NumChainCells, A, B, C, D, W );
+				for ( cid = Extcell( sid ); cid <= Intcell( sid ); ++cid ) {
+					cells( cid ).rhp1 = min( D( cid - Extcell( sid ) + 1 ), rhmax );
+				}
+			}
 
 			//Check for convergence or too many itterations
 			sumtp1 = 0.0;
@@ -107,6 +107,7 @@ namespace HeatBalanceHAMTManager {
 	extern Array1D_bool extvtcflag; // External Surface vapor transfer coefficient flag
 	extern Array1D_bool intvtcflag; // Internal Surface Vapor Transfer Coefficient flag
 	extern Array1D_bool MyEnvrnFlag; // Flag to reset surface properties.
+	extern Array1D_bool cellchain; // TRUE if each cell from Extcell to Intcell is only adjacent to its neighbours in that range
 
 	extern Real64 deltat; // time step in seconds
 
@@ -207,6 +208,9 @@ namespace HeatBalanceHAMTManager {
 	void
 	InitHeatBalHAMT();
 
+	bool
+	CellsFormChain( int const sid );
+
 	void
 	CalcHeatBalHAMT(
 		int const sid,
@@ -348,6 +348,13 @@ namespace HeatBalanceManager {
 			if ( TotSurfaces >= DaylightingManager::octreeCrossover ) { // Octree can be active
 				if ( GetNumObjectsFound( "Daylighting:Controls" ) > 0 ) { // Daylighting is active
 					surfaceOctree.init( DataSurfaces::Surface ); // Set up surface octree
+
+					// Separate octree of the surfaces that can be exterior obstructions for the exterior daylighting ray searches
+					SurfaceOctreeCube::Surfaces obstructions;
+					for ( auto & surface : DataSurfaces::Surface ) {
+						if ( ( surface.Vertex.size() >= 3 ) && ( ! surface.IsTransparent ) && surface.ShadowSurfPossibleObstruction ) obstructions.push_back( &surface );
+					}
+					obstructionOctree.init( obstructions );
 				}
 			}
 
@@ -457,6 +457,7 @@ namespace HeatBalanceSurfaceManager {
 
 		// Do the Begin Simulation initializations
 		if ( BeginSimFlag ) {
+			SetupSurfaceHotArrays(); // Geometry and daylighting devices are final, so split out the per-timestep surface fields
 			AllocateSurfaceHeatBalArrays(); // Allocate the Module Arrays before any inits take place
 			InterZoneWindow = std::any_of( Zone.begin(), Zone.end(), []( DataHeatBalance::ZoneData const & e ){ return e.HasInterZoneWindow; } );
 			IsZoneDV.dimension( NumOfZones, false );
@@ -710,15 +711,14 @@ namespace HeatBalanceSurfaceManager {
 		CTFConstInPart = 0.0;
 		CTFTsrcConstPart = 0.0;
 		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) { // Loop through all surfaces...
-			auto const & surface( Surface( SurfNum ) );
 
-			if ( ! surface.HeatTransSurf ) continue; // Skip non-heat transfer surfaces
-			if ( surface.HeatTransferAlgorithm != HeatTransferModel_CTF && surface.HeatTransferAlgorithm != HeatTransferModel_EMPD ) continue;
-			if ( surface.Class == SurfaceClass_Window ) continue;
+			if ( ! SurfHeatTransSurf( SurfNum ) ) continue; // Skip non-heat transfer surfaces
+			if ( SurfHeatTransferAlgorithm( SurfNum ) != HeatTransferModel_CTF && SurfHeatTransferAlgorithm( SurfNum ) != HeatTransferModel_EMPD ) continue;
+			if ( SurfClass( SurfNum ) == SurfaceClass_Window ) continue;
 			// Outside surface temp of "normal" windows not needed in Window5 calculation approach
 			// Window layer temperatures are calculated in CalcHeatBalanceInsideSurf
 
-			ConstrNum = surface.Construction;
+			ConstrNum = Surface( SurfNum ).Construction;
 			auto const & construct( Construct( ConstrNum ) );
 			if ( construct.NumCTFTerms > 1 ) { // COMPUTE CONSTANT PORTION OF CONDUCTIVE FLUXES.
 
@@ -728,25 +728,37 @@ namespace HeatBalanceSurfaceManager {
 				auto l11( TH.index( 1, 2, SurfNum ) );
 				auto l12( TH.index( 2, 2, SurfNum ) );
 				auto const s3( TH.size3() );
-				for ( Term = 1; Term <= construct.NumCTFTerms; ++Term, l11 += s3, l12 += s3 ) { // [ l11 ] == ( 1, Term + 1, SurfNum ), [ l12 ] == ( 1, Term + 1, SurfNum )
 
-					// Sign convention for the various terms in the following two equations
-					// is based on the form of the Conduction Transfer Function equation
-					// given by:
-					// Qin,now  = (Sum of)(Y Tout) - (Sum of)(Z Tin) + (Sum of)(F Qin,old)
-					// Qout,now = (Sum of)(X Tout) - (Sum of)(Y Tin) + (Sum of)(F Qout,old)
-					// In both equations, flux is positive from outside to inside.
+				// Sign convention for the various terms in the following two equations
+				// is based on the form of the Conduction Transfer Function equation
+				// given by:
+				// Qin,now  = (Sum of)(Y Tout) - (Sum of)(Z Tin) + (Sum of)(F Qin,old)
+				// Qout,now = (Sum of)(X Tout) - (Sum of)(Y Tin) + (Sum of)(F Qout,old)
+				// In both equations, flux is positive from outside to inside.
+
+				if ( ! construct.SourceSinkPresent ) { // Plain conduction: branch-free sums over the history terms
+					for ( Term = 1; Term <= construct.NumCTFTerms; ++Term, l11 += s3, l12 += s3 ) { // [ l11 ] == ( 1, Term + 1, SurfNum ), [ l12 ] == ( 1, Term + 1, SurfNum )
+						//Tuned Aliases and linear indexing
+						Real64 const ctf_cross( construct.CTFCross( Term ) );
+						Real64 const ctf_flux( construct.CTFFlux( Term ) );
+						Real64 const TH11( TH[ l11 ] );
+						Real64 const TH12( TH[ l12 ] );
 
-					//Tuned Aliases and linear indexing
-					Real64 const ctf_cross( construct.CTFCross( Term ) );
-					Real64 const TH11( TH[ l11 ] );
-					Real64 const TH12( TH[ l12 ] );
+						QIC += ctf_cross * TH11 - construct.CTFInside( Term ) * TH12 + ctf_flux * QH[ l12 ];
 
-					QIC += ctf_cross * TH11 - construct.CTFInside( Term ) * TH12 + construct.CTFFlux( Term ) * QH[ l12 ];
+						QOC += construct.CTFOutside( Term ) * TH11 - ctf_cross * TH12 + ctf_flux * QH[ l11 ];
+					}
+				} else {
+					for ( Term = 1; Term <= construct.NumCTFTerms; ++Term, l11 += s3, l12 += s3 ) { // [ l11 ] == ( 1, Term + 1, SurfNum ), [ l12 ] == ( 1, Term + 1, SurfNum )
+						//Tuned Aliases and linear indexing
+						Real64 const ctf_cross( construct.CTFCross( Term ) );
+						Real64 const TH11( TH[ l11 ] );
+						Real64 const TH12( TH[ l12 ] );
+
+						QIC += ctf_cross * TH11 - construct.CTFInside( Term ) * TH12 + construct.CTFFlux( Term ) * QH[ l12 ];
 
-					QOC += construct.CTFOutside( Term ) * TH11 - ctf_cross * TH12 + construct.CTFFlux( Term ) * QH[ l11 ];
+						QOC += construct.CTFOutside( Term ) * TH11 - ctf_cross * TH12 + construct.CTFFlux( Term ) * QH[ l11 ];
 
-					if ( construct.SourceSinkPresent ) {
 						Real64 const QsrcHist1( QsrcHist( SurfNum, Term + 1 ) );
 
 						QIC += construct.CTFSourceIn( Term ) * QsrcHist1;
@@ -755,7 +767,6 @@ namespace HeatBalanceSurfaceManager {
 
 						TSC += construct.CTFTSourceOut( Term ) * TH11 + construct.CTFTSourceIn( Term ) * TH12 + construct.CTFTSourceQ( Term ) * QsrcHist1 + construct.CTFFlux( Term ) * TsrcHist( SurfNum, Term + 1 );
 					}
-
 				}
 
 				CTFConstOutPart( SurfNum ) = QOC;
@@ -4011,13 +4022,16 @@ namespace HeatBalanceSurfaceManager {
 
 		} // ...end of loop over all (heat transfer) surfaces...
 
+		// SHIFT TEMPERATURE AND FLUX HISTORIES:
+		// SHIFT AIR TEMP AND FLUX SHIFT VALUES WHEN AT BOTTOM OF ARRAY SPACE.
+		// The start-of-block values are captured in the same pass so each surface's history is only walked once.
 		l11 = l111;
 		l21 = l211;
 		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum, ++l11, ++l21 ) { // Loop through all (heat transfer) surfaces...  [ l11 ] = ( 1, 1, SurfNum ), [ l21 ] = ( 2, 1, SurfNum )
-			auto const & surface( Surface( SurfNum ) );
+			int const surfClass( SurfClass( SurfNum ) );
 
-			if ( surface.Class == SurfaceClass_Window || ! surface.HeatTransSurf ) continue;
-			if ( ( surface.HeatTransferAlgorithm != HeatTransferModel_CTF ) && ( surface.HeatTransferAlgorithm != HeatTransferModel_EMPD ) && ( surface.HeatTransferAlgorithm != HeatTransferModel_TDD ) ) continue;
+			if ( surfClass == SurfaceClass_Window || ! SurfHeatTransSurf( SurfNum ) ) continue;
+			if ( ( SurfHeatTransferAlgorithm( SurfNum ) != HeatTransferModel_CTF ) && ( SurfHeatTransferAlgorithm( SurfNum ) != HeatTransferModel_EMPD ) && ( SurfHeatTransferAlgorithm( SurfNum ) != HeatTransferModel_TDD ) ) continue;
 			if ( SUMH( SurfNum ) == 0 ) { // First time step in a block for a surface, update arrays
 				TempExt1( SurfNum ) = TH[ l11 ];
 				TempInt1( SurfNum ) = TempSurfIn( SurfNum );
@@ -4027,17 +4041,9 @@ namespace HeatBalanceSurfaceManager {
 				Qsrc1( SurfNum ) = QsrcHist( SurfNum, 1 );
 			}
 
-		} // ...end of loop over all (heat transfer) surfaces...
-
-		// SHIFT TEMPERATURE AND FLUX HISTORIES:
-		// SHIFT AIR TEMP AND FLUX SHIFT VALUES WHEN AT BOTTOM OF ARRAY SPACE.
-		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) { // Loop through all (heat transfer) surfaces...
-			auto const & surface( Surface( SurfNum ) );
+			if ( surfClass == SurfaceClass_TDD_Dome ) continue;
 
-			if ( surface.Class == SurfaceClass_Window || surface.Class == SurfaceClass_TDD_Dome || ! surface.HeatTransSurf ) continue;
-			if ( ( surface.HeatTransferAlgorithm != HeatTransferModel_CTF ) && ( surface.HeatTransferAlgorithm != HeatTransferModel_EMPD ) && ( surface.HeatTransferAlgorithm != HeatTransferModel_TDD ) ) continue;
-
-			int const ConstrNum( surface.Construction );
+			int const ConstrNum( Surface( SurfNum ).Construction );
 			auto const & construct( Construct( ConstrNum ) );
 
 			++SUMH( SurfNum );
@@ -4532,10 +4538,10 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 		// Need to transfer any source/sink for a surface to the local array.  Note that
 		// the local array is flux (W/m2) while the QRadSysSource is heat transfer (W).
 		// This must be done at this location so that this is always updated correctly.
-		if ( Surface( SurfNum ).Area > 0.0 ) QsrcHist( SurfNum, 1 ) = QRadSysSource( SurfNum ) / Surface( SurfNum ).Area; // Make sure we don't divide by zero...
+		if ( SurfArea( SurfNum ) > 0.0 ) QsrcHist( SurfNum, 1 ) = QRadSysSource( SurfNum ) / SurfArea( SurfNum ); // Make sure we don't divide by zero...
 
 		// next we add source (actually a sink) from any integrated PV
-		if ( Surface( SurfNum ).Area > 0.0 ) QsrcHist( SurfNum, 1 ) += QPVSysSource( SurfNum ) / Surface( SurfNum ).Area; // Make sure we don't divide by zero...
+		if ( SurfArea( SurfNum ) > 0.0 ) QsrcHist( SurfNum, 1 ) += QPVSysSource( SurfNum ) / SurfArea( SurfNum ); // Make sure we don't divide by zero...
 	}
 
 	if ( present( ZoneToResimulate ) ) {
@@ -4546,7 +4552,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 
 	for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) { // Loop through all surfaces...
 
-		ZoneNum = Surface( SurfNum ).Zone;
+		ZoneNum = SurfZone( SurfNum );
 
 		if ( present( ZoneToResimulate ) ) {
 			if ( ( ZoneNum != ZoneToResimulate ) && ( AdjacentZoneToSurface( SurfNum ) != ZoneToResimulate ) ) {
@@ -4554,9 +4560,9 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 			}
 		}
 
-		if ( ! Surface( SurfNum ).HeatTransSurf || ZoneNum == 0 ) continue; // Skip non-heat transfer surfaces
+		if ( ! SurfHeatTransSurf( SurfNum ) || ZoneNum == 0 ) continue; // Skip non-heat transfer surfaces
 
-		if ( Surface( SurfNum ).Class == SurfaceClass_Window ) continue;
+		if ( SurfClass( SurfNum ) == SurfaceClass_Window ) continue;
 		// Interior windows in partitions use "normal" heat balance calculations
 		// For rest, Outside surface temp of windows not needed in Window5 calculation approach.
 		// Window layer temperatures are calculated in CalcHeatBalanceInsideSurf
@@ -4574,7 +4580,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 
 		// Calculate the current outside surface temperature TH(SurfNum,1,1) for the
 		// various different boundary conditions
-		{ auto const SELECT_CASE_var( Surface( SurfNum ).ExtBoundCond );
+		{ auto const SELECT_CASE_var( SurfExtBoundCond( SurfNum ) );
 
 		if ( SELECT_CASE_var == Ground ) { // Surface in contact with ground
 
@@ -4584,7 +4590,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 			if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( 1, 1, SurfNum );
 
 			// start HAMT
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+			if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_HAMT ) {
 				// Set variables used in the HAMT moisture balance
 				TempOutsideAirFD( SurfNum ) = GroundTemp;
 				RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRh( GroundTemp, 1.0, HBSurfManGroundHAMT );
@@ -4598,7 +4604,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 			}
 			// end HAMT
 
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
+			if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CondFD ) {
 				// Set variables used in the FD moisture balance
 				TempOutsideAirFD( SurfNum ) = GroundTemp;
 				RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRhLBnd0C( GroundTemp, 1.0 );
@@ -4617,7 +4623,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 			// Set the only radiant system heat balance coefficient that is non-zero for this case
 			if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( 1, 1, SurfNum );
 
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+			if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_HAMT ) {
 				// Set variables used in the HAMT moisture balance
 				TempOutsideAirFD( SurfNum ) = GroundTempFC;
 				RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRh( GroundTempFC, 1.0, HBSurfManGroundHAMT );
@@ -4630,7 +4636,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 				HAirFD( SurfNum ) = HAir;
 			}
 
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
+			if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CondFD ) {
 				// Set variables used in the FD moisture balance
 				TempOutsideAirFD( SurfNum ) = GroundTempFC;
 				RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRhLBnd0C( GroundTempFC, 1.0 );
@@ -4673,7 +4679,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 			// Set the only radiant system heat balance coefficient that is non-zero for this case
 			if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( 1, 1, SurfNum );
 
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+			if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CondFD || SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_HAMT ) {
 				// Set variables used in the FD moisture balance and HAMT
 				TempOutsideAirFD( SurfNum ) = TH( 1, 1, SurfNum );
 				RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbWPb( TempOutsideAirFD( SurfNum ), OutHumRat, OutBaroPress );
@@ -4713,7 +4719,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 			// Set the only radiant system heat balance coefficient that is non-zero for this case
 			if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( 1, 1, SurfNum );
 
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+			if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CondFD || SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_HAMT ) {
 				// Set variables used in the FD moisture balance and HAMT
 				TempOutsideAirFD( SurfNum ) = TempExt;
 				RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbWPb( TempOutsideAirFD( SurfNum ), OutHumRat, OutBaroPress );
@@ -4725,7 +4731,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 			}
 
 			// Call the outside surface temp calculation and pass the necessary terms
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CTF || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_EMPD ) CalcOutsideSurfTemp( SurfNum, ZoneNum, ConstrNum, HMovInsul, TempExt );
+			if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CTF || SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_EMPD ) CalcOutsideSurfTemp( SurfNum, ZoneNum, ConstrNum, HMovInsul, TempExt );
 
 			// This ends the calculations for this surface and goes on to the next SurfNum
 
@@ -4747,7 +4753,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 			// Set the only radiant system heat balance coefficient that is non-zero for this case
 			if ( Construct( ConstrNum ).SourceSinkPresent ) RadSysToHBConstCoef( SurfNum ) = TH( 1, 1, SurfNum );
 
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+			if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CondFD || SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_HAMT ) {
 				// Set variables used in the FD moisture balance and HAMT
 				TempOutsideAirFD( SurfNum ) = TempExt;
 				RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbWPb( TempOutsideAirFD( SurfNum ), OutHumRat, OutBaroPress );
@@ -4759,14 +4765,14 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 			}
 
 			// Call the outside surface temp calculation and pass the necessary terms
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CTF || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_EMPD ) {
+			if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CTF || SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_EMPD ) {
 
 				if ( Surface( SurfNum ).ExtCavityPresent ) {
 					CalcExteriorVentedCavity( SurfNum );
 				}
 
 				CalcOutsideSurfTemp( SurfNum, ZoneNum, ConstrNum, HMovInsul, TempExt );
-			} else if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+			} else if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CondFD || SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_HAMT ) {
 				if ( Surface( SurfNum ).ExtCavityPresent ) {
 					CalcExteriorVentedCavity( SurfNum );
 				}
@@ -4807,7 +4813,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 					TempExt = Surface( SurfNum ).OutWetBulbTemp;
 
 					// start HAMT
-					if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+					if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_HAMT ) {
 						// Set variables used in the HAMT moisture balance
 						TempOutsideAirFD( SurfNum ) = TempExt;
 						RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRh( TempOutsideAirFD( SurfNum ), 1.0, HBSurfManRainHAMT );
@@ -4819,7 +4825,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 					}
 					// end HAMT
 
-					if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
+					if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CondFD ) {
 						// Set variables used in the FD moisture balance
 						TempOutsideAirFD( SurfNum ) = TempExt;
 						RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbRhLBnd0C( TempOutsideAirFD( SurfNum ), 1.0 );
@@ -4834,7 +4840,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 
 					TempExt = Surface( SurfNum ).OutDryBulbTemp;
 
-					if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+					if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CondFD || SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_HAMT ) {
 						// Set variables used in the FD moisture balance and HAMT
 						TempOutsideAirFD( SurfNum ) = TempExt;
 						RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbWPb( TempOutsideAirFD( SurfNum ), OutHumRat, OutBaroPress );
@@ -4857,7 +4863,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 
 				TempExt = Surface( SurfNum ).OutDryBulbTemp;
 
-				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+				if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CondFD || SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_HAMT ) {
 					// Set variables used in the FD moisture balance and HAMT
 					TempOutsideAirFD( SurfNum ) = TempExt;
 					RhoVaporAirOut( SurfNum ) = PsyRhovFnTdbWPb( TempOutsideAirFD( SurfNum ), OutHumRat, OutBaroPress );
@@ -4870,17 +4876,17 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 
 			}
 
-			if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CTF || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_EMPD ) CalcOutsideSurfTemp( SurfNum, ZoneNum, ConstrNum, HMovInsul, TempExt );
+			if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CTF || SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_EMPD ) CalcOutsideSurfTemp( SurfNum, ZoneNum, ConstrNum, HMovInsul, TempExt );
 
 		} else { // for interior or other zone surfaces
 
-			if ( Surface( SurfNum ).ExtBoundCond == SurfNum ) { // Regular partition/internal mass
+			if ( SurfExtBoundCond( SurfNum ) == SurfNum ) { // Regular partition/internal mass
 
 				TH( 1, 1, SurfNum ) = TempSurfIn( SurfNum );
 
 				// No need to set any radiant system heat balance coefficients here--will be done during inside heat balance
 
-				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+				if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CondFD || SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_HAMT ) {
 					// Set variables used in the FD moisture balance HAMT
 					TempOutsideAirFD( SurfNum ) = TempSurfIn( SurfNum );
 					RhoVaporAirOut( SurfNum ) = RhoVaporAirIn( SurfNum );
@@ -4893,15 +4899,15 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 
 			} else { // Interzone partition
 
-				TH( 1, 1, SurfNum ) = TH( 2, 1, Surface( SurfNum ).ExtBoundCond );
+				TH( 1, 1, SurfNum ) = TH( 2, 1, SurfExtBoundCond( SurfNum ) );
 
 				// No need to set any radiant system heat balance coefficients here--will be done during inside heat balance
 
-				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD || Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_HAMT ) {
+				if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CondFD || SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_HAMT ) {
 					// Set variables used in the FD moisture balance and HAMT
-					TempOutsideAirFD( SurfNum ) = TH( 2, 1, Surface( SurfNum ).ExtBoundCond );
-					RhoVaporAirOut( SurfNum ) = RhoVaporAirIn( Surface( SurfNum ).ExtBoundCond );
-					HConvExtFD( SurfNum ) = HConvIn( Surface( SurfNum ).ExtBoundCond );
+					TempOutsideAirFD( SurfNum ) = TH( 2, 1, SurfExtBoundCond( SurfNum ) );
+					RhoVaporAirOut( SurfNum ) = RhoVaporAirIn( SurfExtBoundCond( SurfNum ) );
+					HConvExtFD( SurfNum ) = HConvIn( SurfExtBoundCond( SurfNum ) );
 					HMassConvExtFD( SurfNum ) = HConvExtFD( SurfNum ) / ( ( PsyRhoAirFnPbTdbW( OutBaroPress, TempOutsideAirFD( SurfNum ), PsyWFnTdbRhPb( TempOutsideAirFD( SurfNum ), 1.0, OutBaroPress, RoutineNameIZPart ) ) + RhoVaporAirOut( SurfNum ) ) * PsyCpAirFnWTdb( OutHumRat, TempOutsideAirFD( SurfNum ) ) );
 					HSkyFD( SurfNum ) = 0.0;
 					HGrndFD( SurfNum ) = 0.0;
@@ -4914,7 +4920,7 @@ CalcHeatBalanceOutsideSurf( Optional_int_const ZoneToResimulate ) // if passed i
 		}}
 
 		//fill in reporting values for outside face
-		QdotConvOutRep( SurfNum ) = -Surface( SurfNum ).Area * HcExtSurf( SurfNum ) * ( TH( 1, 1, SurfNum ) - Surface( SurfNum ).OutDryBulbTemp );
+		QdotConvOutRep( SurfNum ) = -SurfArea( SurfNum ) * HcExtSurf( SurfNum ) * ( TH( 1, 1, SurfNum ) - Surface( SurfNum ).OutDryBulbTemp );
 
 		if ( Surface( SurfNum ).OSCMPtr > 0 ) { //Optr is set above in this case, use OSCM boundary data
 			QdotConvOutRepPerArea( SurfNum ) = -OSCM( OPtr ).HConv * ( TH( 1, 1, SurfNum ) - OSCM( OPtr ).TConv );
@@ -5122,23 +5128,23 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 
 	// determine reference air temperatures
 	for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
-		ZoneNum = Surface( SurfNum ).Zone;
+		ZoneNum = SurfZone( SurfNum );
 
 		if ( PartialResimulate ) {
 			if ( ( ZoneNum != ZoneToResimulate ) && ( AdjacentZoneToSurface( SurfNum ) != ZoneToResimulate ) ) { // Surface not relevant
 				continue; // skip surfaces that are not associated with this zone
 			} else { // Surface is relevant for ZoneToResimulate
 				SurfToResimulate.push_back( SurfNum );
-				if ( Surface( SurfNum ).HeatTransSurf ) HTSurfToResimulate.push_back( SurfNum ); // Skip non-heat transfer surfaces
+				if ( SurfHeatTransSurf( SurfNum ) ) HTSurfToResimulate.push_back( SurfNum ); // Skip non-heat transfer surfaces
 			}
 		} else {
 			SurfToResimulate.push_back( SurfNum );
-			if ( Surface( SurfNum ).HeatTransSurf ) HTSurfToResimulate.push_back( SurfNum ); // Skip non-heat transfer surfaces
+			if ( SurfHeatTransSurf( SurfNum ) ) HTSurfToResimulate.push_back( SurfNum ); // Skip non-heat transfer surfaces
 		}
 
 		// These conditions are not used in every SurfNum loop here so we don't use them to skip surfaces
-		if ( ( ZoneNum == 0 ) || ! Surface( SurfNum ).HeatTransSurf ) continue; // Skip non-heat transfer surfaces
-		if ( Surface( SurfNum ).Class == SurfaceClass_TDD_Dome ) continue; // Skip TDD:DOME objects.  Inside temp is handled by TDD:DIFFUSER.
+		if ( ( ZoneNum == 0 ) || ! SurfHeatTransSurf( SurfNum ) ) continue; // Skip non-heat transfer surfaces
+		if ( SurfClass( SurfNum ) == SurfaceClass_TDD_Dome ) continue; // Skip TDD:DOME objects.  Inside temp is handled by TDD:DIFFUSER.
 
 		if ( PartialResimulate ) {
 			WinHeatGain( SurfNum ) = 0.0;
@@ -5722,7 +5728,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 			// Interzones must have an exterior boundary condition greater than zero
 			// (meaning that the other side is a surface) and the surface number must
 			// not be the surface itself (which is just a simple partition)
-			int const surfExtBoundCond( Surface( SurfNum ).ExtBoundCond );
+			int const surfExtBoundCond( SurfExtBoundCond( SurfNum ) );
 			if ( ( surfExtBoundCond > 0 ) && ( surfExtBoundCond != SurfNum ) ) {
 				// Set the outside surface temperature to the inside surface temperature
 				// of the interzone pair and reassign the reporting variable.  By going
@@ -5741,7 +5747,7 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 			ConstrNum = Surface( SurfNum ).Construction;
 			if ( Construct( ConstrNum ).TransDiff <= 0.0 ) { // Opaque surface
 				MaxDelTemp = max( std::abs( TempSurfIn( SurfNum ) - TempInsOld( SurfNum ) ), MaxDelTemp );
-				if ( Surface( SurfNum ).HeatTransferAlgorithm == HeatTransferModel_CondFD ) {
+				if ( SurfHeatTransferAlgorithm( SurfNum ) == HeatTransferModel_CondFD ) {
 					// also check all internal nodes as well as surface faces
 					MaxDelTemp = max( MaxDelTemp, SurfaceFD( SurfNum ).MaxNodeDelTemp );
 				}
@@ -5863,8 +5869,8 @@ CalcHeatBalanceInsideSurf( Optional_int_const ZoneToResimulate ) // if passed in
 	for ( std::vector< int >::size_type iSurfToResimulate = 0u; iSurfToResimulate < nSurfToResimulate; ++iSurfToResimulate ) { // Perform a heat balance on all of the relevant inside surfaces...
 		SurfNum = SurfToResimulate[ iSurfToResimulate ];
 		if ( ! Surface( SurfNum ).ExtSolar ) continue; // WindowManager's definition of ZoneWinHeatGain/Loss
-		if ( Surface( SurfNum ).Class != SurfaceClass_Window ) continue;
-		ZoneNum = Surface( SurfNum ).Zone;
+		if ( SurfClass( SurfNum ) != SurfaceClass_Window ) continue;
+		ZoneNum = SurfZone( SurfNum );
 		if ( ZoneNum == 0 ) continue;
 		ZoneWinHeatGain( ZoneNum ) += WinHeatGain( SurfNum );
 	}
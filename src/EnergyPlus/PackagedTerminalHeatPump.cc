@@ -433,7 +433,7 @@ namespace PackagedTerminalHeatPump {
 			if ( PTUnit( PTUnitNum ).useVSCoilModel ) {
 				SimVariableSpeedHP( PTUnitNum, ZoneNum, FirstHVACIteration, QZnReq, QLatReq, OnOffAirFlowRatio, OpMode, HXUnitOn );
 			} else {
-				ControlPTUnitOutput( PTUnitNum, FirstHVACIteration, OpMode, QZnReq, ZoneNum, PartLoadFrac, OnOffAirFlowRatio, SupHeaterLoad, HXUnitOn );
+				ControlPTUnitOutput( PTUnitNum, FirstHVACIteration, QZnReq, PartLoadFrac, OnOffAirFlowRatio, SupHeaterLoad, HXUnitOn );
 			}
 		} else {
 			PartLoadFrac = 0.0;
@@ -4058,9 +4058,7 @@ namespace PackagedTerminalHeatPump {
 	ControlPTUnitOutput(
 		int const PTUnitNum, // Unit index in fan coil array
 		bool const FirstHVACIteration, // flag for 1st HVAC iteration in the time step
-		int const OpMode, // operating mode: CycFanCycCoil | ContFanCycCoil
 		Real64 const QZnReq, // cooling or heating output needed by zone [W]
-		int const ZoneNum, // Index to zone number
 		Real64 & PartLoadFrac, // unit part load fraction
 		Real64 & OnOffAirFlowRatio, // ratio of compressor ON airflow to AVERAGE airflow over timestep
 		Real64 & SupHeaterLoad, // Supplemental heater load [W]
@@ -4084,7 +4082,7 @@ namespace PackagedTerminalHeatPump {
 		// na
 
 		// Using/Aliasing
-		using General::SolveRegulaFalsi;
+		using General::SolveRoot;
 		using General::RoundSigDigits;
 		using General::TrimSigDigits;
 		using DataGlobals::WarmupFlag;
@@ -4116,7 +4114,6 @@ namespace PackagedTerminalHeatPump {
 		Real64 NoCompOutput; // output when no active compressor [W]
 		Real64 ErrorToler; // error tolerance
 		int SolFla; // Flag of RegulaFalsi solver
-		static Array1D< Real64 > Par( 8 ); // Parameters passed to RegulaFalsi
 		std::string IterNum; // Max number of iterations for warning message
 		Real64 CpAir; // air specific heat
 		Real64 OutsideDryBulbTemp; // Outside air temperature at external node height
@@ -4186,23 +4183,20 @@ namespace PackagedTerminalHeatPump {
 
 		if ( ( HeatingLoad && QZnReq < FullOutput ) || ( CoolingLoad && QZnReq > FullOutput ) ) {
 
-			Par( 1 ) = PTUnitNum;
-			Par( 2 ) = ZoneNum;
-			if ( FirstHVACIteration ) {
-				Par( 3 ) = 1.0;
-			} else {
-				Par( 3 ) = 0.0;
-			}
-			Par( 4 ) = OpMode;
-			Par( 5 ) = QZnReq;
-			Par( 6 ) = OnOffAirFlowRatio;
-			Par( 7 ) = SupHeaterLoad;
-			if ( HXUnitOn ) {
-				Par( 8 ) = 1.0;
-			} else {
-				Par( 8 ) = 0.0;
-			}
-			SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, PartLoadFrac, PLRResidual, 0.0, 1.0, Par );
+			// Part load residual ((ActualOutput - QZnReq)/QZnReq), bound to the unit state so the solver can inline it.
+			// The air flow ratio and supplemental heater load are held at their values on entry.
+			Real64 const QZnReqTemp( std::abs( QZnReq ) < 100.0 ? sign( 100.0, QZnReq ) : QZnReq );
+			Real64 const ResOnOffAirFlowRatio( OnOffAirFlowRatio );
+			Real64 const ResSupHeaterLoad( SupHeaterLoad );
+			bool const ResHXUnitOn( HXUnitOn );
+			auto const PLRResid = [&]( Real64 const PLR ) -> Real64 {
+				Real64 ActualOutput; // delivered capacity of PTHP
+				Real64 AirFlowRatio( ResOnOffAirFlowRatio );
+				Real64 HeaterLoad( ResSupHeaterLoad * PLR );
+				CalcPTUnit( PTUnitNum, FirstHVACIteration, PLR, ActualOutput, QZnReq, AirFlowRatio, HeaterLoad, ResHXUnitOn );
+				return ( ActualOutput - QZnReq ) / QZnReqTemp;
+			};
+			SolveRoot( ErrorToler, MaxIte, SolFla, PartLoadFrac, PLRResid, 0.0, 1.0 );
 			if ( SolFla == -1 ) {
 				//     Very low loads may not converge quickly. Tighten PLR boundary and try again.
 				TempMaxPLR = -0.1;
@@ -4221,7 +4215,7 @@ namespace PackagedTerminalHeatPump {
 					if ( HeatingLoad && TempOutput < QZnReq ) ContinueIter = false;
 					if ( CoolingLoad && TempOutput > QZnReq ) ContinueIter = false;
 				}
-				SolveRegulaFalsi( ErrorToler, MaxIte, SolFla, PartLoadFrac, PLRResidual, TempMinPLR, TempMaxPLR, Par );
+				SolveRoot( ErrorToler, MaxIte, SolFla, PartLoadFrac, PLRResid, TempMinPLR, TempMaxPLR );
 				if ( SolFla == -1 ) {
 					if ( ! FirstHVACIteration && ! WarmupFlag ) {
 						CalcPTUnit( PTUnitNum, FirstHVACIteration, PartLoadFrac, TempOutput, QZnReq, OnOffAirFlowRatio, SupHeaterLoad, HXUnitOn );
@@ -4897,85 +4891,6 @@ namespace PackagedTerminalHeatPump {
 		return SupSATResidual;
 	}
 
-	Real64
-	PLRResidual(
-		Real64 const PartLoadFrac, // compressor cycling ratio (1.0 is continuous, 0.0 is off)
-		Array1< Real64 > const & Par // par(1) = PTUnitNum
-	)
-	{
-		// FUNCTION INFORMATION:
-		//       AUTHOR         Richard Raustad
-		//       DATE WRITTEN   July 2005
-		//       MODIFIED
-		//       RE-ENGINEERED
-
-		// PURPOSE OF THIS FUNCTION:
-		//  Calculates residual function ((ActualOutput - QZnReq)/QZnReq)
-		//  PTHP output depends on the part load ratio which is being varied to zero the residual.
-
-		// METHODOLOGY EMPLOYED:
-		//  Calls CalcPTHP to get ActualOutput at the given part load ratio
-		//  and calculates the residual as defined above
-
-		// REFERENCES:
-
-		// USE STATEMENTS:
-		// na
-
-		// Return value
-		Real64 PLRResidual;
-
-		// Argument array dimensioning
-
-		// Locals
-		Real64 SupHeaterLoad; // load passed to supplemental heater (W)
-
-		// SUBROUTINE ARGUMENT DEFINITIONS:
-		// par(2) = Zone Num
-		// par(3) = FirstHVACIteration
-		// par(4) = OpMode
-		// par(5) = QZnReq
-		// par(6) = OnOffAirFlowRatio
-		// par(7) = SupHeaterLoad
-
-		// FUNCTION PARAMETER DEFINITIONS:
-		//  na
-
-		// INTERFACE BLOCK SPECIFICATIONS
-		//  na
-
-		// DERIVED TYPE DEFINITIONS
-		//  na
-
-		// FUNCTION LOCAL VARIABLE DECLARATIONS:
-		int PTUnitNum; // PTHP index
-		int ZoneNum; // Zone index
-		bool FirstHVACIteration; // FirstHVACIteration flag
-		int OpMode; // Compressor operating mode
-		Real64 QZnReq; // zone load (W)
-		Real64 QZnReqTemp; // denominator representing zone load (W)
-		Real64 OnOffAirFlowRatio; // ratio of compressor ON airflow to average airflow over timestep
-		Real64 ActualOutput; // delivered capacity of PTHP
-		bool HXUnitOn; // flag to enable heat exchanger
-
-		PTUnitNum = int( Par( 1 ) );
-		ZoneNum = int( Par( 2 ) );
-		// FirstHVACIteration is a logical, Par is real, so make 1.0=TRUE and 0.0=FALSE
-		FirstHVACIteration = ( Par( 3 ) == 1.0 );
-		OpMode = int( Par( 4 ) );
-		QZnReq = Par( 5 );
-		QZnReqTemp = QZnReq;
-		if ( std::abs( QZnReq ) < 100.0 ) QZnReqTemp = sign( 100.0, QZnReq );
-		OnOffAirFlowRatio = Par( 6 );
-		SupHeaterLoad = Par( 7 ) * PartLoadFrac;
-		HXUnitOn = ( Par( 8 ) == 1.0 );
-
-		CalcPTUnit( PTUnitNum, FirstHVACIteration, PartLoadFrac, ActualOutput, QZnReq, OnOffAirFlowRatio, SupHeaterLoad, HXUnitOn );
-		PLRResidual = ( ActualOutput - QZnReq ) / QZnReqTemp;
-
-		return PLRResidual;
-	}
-
 	void
 	SetAverageAirFlow(
 		int const PTUnitNum, // Unit index
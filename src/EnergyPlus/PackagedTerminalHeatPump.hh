@@ -467,9 +467,7 @@ namespace PackagedTerminalHeatPump {
 	ControlPTUnitOutput(
 		int const PTUnitNum, // Unit index in fan coil array
 		bool const FirstHVACIteration, // flag for 1st HVAC iteration in the time step
-		int const OpMode, // operating mode: CycFanCycCoil | ContFanCycCoil
 		Real64 const QZnReq, // cooling or heating output needed by zone [W]
-		int const ZoneNum, // Index to zone number
 		Real64 & PartLoadFrac, // unit part load fraction
 		Real64 & OnOffAirFlowRatio, // ratio of compressor ON airflow to AVERAGE airflow over timestep
 		Real64 & SupHeaterLoad, // Supplemental heater load [W]
@@ -508,12 +506,6 @@ namespace PackagedTerminalHeatPump {
 		Array1< Real64 > const & Par // par(1) = PTUnitNum
 	);
 
-	Real64
-	PLRResidual(
-		Real64 const PartLoadFrac, // compressor cycling ratio (1.0 is continuous, 0.0 is off)
-		Array1< Real64 > const & Par // par(1) = PTUnitNum
-	);
-
 	void
 	SetAverageAirFlow(
 		int const PTUnitNum, // Unit index
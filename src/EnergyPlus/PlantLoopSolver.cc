@@ -75,6 +75,7 @@
 #include <DataLoopNode.hh>
 #include <DataPlant.hh>
 #include <DataPrecisionGlobals.hh>
+#include <DataSystemVariables.hh>
 #include <FluidProperties.hh>
 #include <General.hh>
 #include <HVACInterfaceManager.hh>
@@ -1061,6 +1062,8 @@ namespace PlantLoopSolver {
 		using PlantUtilities::UpdatePlantMixer;
 		using DataPlant::PlantLoop;
 		using DataPlant::FlowUnlocked;
+		using DataLoopNode::Node;
+		using DataSystemVariables::SkipIdlePlantBranches;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -1099,6 +1102,15 @@ namespace PlantLoopSolver {
 				SimulateLoopSideBranchGroup( LoopNum, LoopSideNum, 2, PlantLoop( LoopNum ).LoopSide( LoopSideNum ).TotalBranches - 1, ThisLoopSideFlow, FirstHVACIteration, LoopShutDownFlag );
 				UpdatePlantMixer( LoopNum, LoopSideNum, 1 );
 
+				// Remember which parallel branches ended the unlocked pass without flow
+				if ( SkipIdlePlantBranches && ( PlantLoop( LoopNum ).LoopSide( LoopSideNum ).FlowLock == FlowUnlocked ) ) {
+					for ( int BranchNum = 2; BranchNum <= PlantLoop( LoopNum ).LoopSide( LoopSideNum ).TotalBranches - 1; ++BranchNum ) {
+						auto & branch( PlantLoop( LoopNum ).LoopSide( LoopSideNum ).Branch( BranchNum ) );
+						branch.IdleInUnlockedPass = BranchCanSkipWhenIdle( LoopNum, LoopSideNum, BranchNum ) && ( Node( branch.NodeNumIn ).MassFlowRate == 0.0 ) && ( Node( branch.NodeNumOut ).MassFlowRate == 0.0 );
+						branch.IdleInletTemp = Node( branch.NodeNumIn ).Temp;
+					}
+				}
+
 			} else if ( SELECT_CASE_var == OutletBranch ) { // This group is the outlet branch
 				SimulateLoopSideBranchGroup( LoopNum, LoopSideNum, PlantLoop( LoopNum ).LoopSide( LoopSideNum ).TotalBranches, PlantLoop( LoopNum ).LoopSide( LoopSideNum ).TotalBranches, ThisLoopSideFlow, FirstHVACIteration, LoopShutDownFlag );
 
@@ -1148,8 +1160,12 @@ namespace PlantLoopSolver {
 		//  load distribution engine will be called again before the next component.
 		// After all load distribution is done and those components are complete, the simulation moves back to do any
 		//  remaining components that may be downstream.
+		// With SkipIdlePlantBranches, a parallel branch that had no flow at the end of the unlocked pass and still has
+		//  no flow and the same inlet temperature once flow is locked is not resimulated.  Its components are off either
+		//  way, so the unlocked pass results stand.  Load distribution and pressure drop are still done for the branch.
 
 		// Using/Aliasing
+		using DataGlobals::AnyEnergyManagementSystemInModel;
 		using DataPlant::PlantLoop;
 		using DataPlant::DemandOpSchemeType;
 		using DataPlant::PumpOpSchemeType;
@@ -1169,6 +1185,7 @@ namespace PlantLoopSolver {
 		using PlantLoopEquip::SimPlantEquip;
 		using PlantPressureSystem::SimPressureDropSystem;
 		using General::TrimSigDigits;
+		using DataSystemVariables::SkipIdlePlantBranches;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
@@ -1197,6 +1214,7 @@ namespace PlantLoopSolver {
 
 		//~ General variables
 		static Array1D_int LastComponentSimulated;
+		static Array1D_bool BranchIsIdle; // true if the branch components are not resimulated in this pass
 		Real64 LoadToLoopSetPoint;
 
 		int curCompOpSchemePtr;
@@ -1221,6 +1239,7 @@ namespace PlantLoopSolver {
 			// Reallocate for the number of locations we have available // No heap if size is unchanged
 			if ( NumBranchesInRegion > LastComponentSimulated.isize() ) { //Tuned Changed to grow-only strategy
 				LastComponentSimulated.allocate( NumBranchesInRegion );
+				BranchIsIdle.allocate( NumBranchesInRegion );
 			}
 			for ( int i = 1; i <= NumBranchesInRegion; ++i ) LastComponentSimulated( i ) = 0; // Only zero the active elements
 //			AccessibleBranches.allocate( NumBranchesInRegion );
@@ -1248,6 +1267,17 @@ namespace PlantLoopSolver {
 		bool EncounteredLRBObjDuringPass1( false );
 		BranchIndex = 0;
 		auto & loop( PlantLoop( LoopNum ).LoopSide( LoopSideNum ) );
+
+		// Find the parallel branches that stayed idle since the unlocked pass
+		bool const SkipIdleBranches( SkipIdlePlantBranches && ( loop.FlowLock == FlowLocked ) && ( ! AnyEnergyManagementSystemInModel ) );
+		for ( BranchCounter = FirstBranchNum; BranchCounter <= LastBranchNum; ++BranchCounter ) {
+			auto & branch( loop.Branch( BranchCounter ) );
+			++BranchIndex;
+			BranchIsIdle( BranchIndex ) = SkipIdleBranches && branch.IdleInUnlockedPass && ( Node( branch.NodeNumIn ).MassFlowRate == 0.0 ) && ( Node( branch.NodeNumIn ).Temp == branch.IdleInletTemp );
+			if ( loop.FlowLock == FlowLocked ) branch.IdleInUnlockedPass = false;
+		}
+
+		BranchIndex = 0;
 		for ( BranchCounter = FirstBranchNum; BranchCounter <= LastBranchNum; ++BranchCounter ) {
 			auto & branch( loop.Branch( BranchCounter ) );
 			++BranchIndex;
@@ -1264,7 +1294,7 @@ namespace PlantLoopSolver {
 				switch ( CurOpSchemeType ) {
 				case WSEconOpSchemeType: //~ coils
 					this_comp.MyLoad = UpdatedDemandToLoopSetPoint;
-					SimPlantEquip( LoopNum, LoopSideNum, BranchCounter, CompCounter, FirstHVACIteration, DummyInit, DoNotGetCompSizFac );
+					if ( ! BranchIsIdle( BranchIndex ) ) SimPlantEquip( LoopNum, LoopSideNum, BranchCounter, CompCounter, FirstHVACIteration, DummyInit, DoNotGetCompSizFac );
 					break;
 				case PumpOpSchemeType: //~ pump
 					PumpLocation.LoopNum = LoopNum;
@@ -1279,7 +1309,7 @@ namespace PlantLoopSolver {
 					break;
 				case CompSetPtBasedSchemeType:
 					ManagePlantLoadDistribution( LoopNum, LoopSideNum, BranchCounter, CompCounter, LoadToLoopSetPoint, LoadToLoopSetPointThatWasntMet, FirstHVACIteration, LoopShutDownFlag, LoadDistributionWasPerformed );
-					SimPlantEquip( LoopNum, LoopSideNum, BranchCounter, CompCounter, FirstHVACIteration, DummyInit, DoNotGetCompSizFac );
+					if ( ! BranchIsIdle( BranchIndex ) ) SimPlantEquip( LoopNum, LoopSideNum, BranchCounter, CompCounter, FirstHVACIteration, DummyInit, DoNotGetCompSizFac );
 					break;
 				case EMSOpSchemeType:
 					if ( LoopSideNum == SupplySide ) {
@@ -1288,14 +1318,14 @@ namespace PlantLoopSolver {
 						PlantLoop( LoopNum ).OpScheme( OpSchemePtr ).EMSIntVarLoopDemandRate = InitialDemandToLoopSetPoint;
 					}
 					ManagePlantLoadDistribution( LoopNum, LoopSideNum, BranchCounter, CompCounter, UpdatedDemandToLoopSetPoint, LoadToLoopSetPointThatWasntMet, FirstHVACIteration, LoopShutDownFlag, LoadDistributionWasPerformed );
-					SimPlantEquip( LoopNum, LoopSideNum, BranchCounter, CompCounter, FirstHVACIteration, DummyInit, DoNotGetCompSizFac );
+					if ( ! BranchIsIdle( BranchIndex ) ) SimPlantEquip( LoopNum, LoopSideNum, BranchCounter, CompCounter, FirstHVACIteration, DummyInit, DoNotGetCompSizFac );
 					break;
 				default:
 					if ( ( CurOpSchemeType >= LoadRangeBasedMin ) && ( CurOpSchemeType <= LoadRangeBasedMax ) ) { //~ load range based
 						EncounteredLRBObjDuringPass1 = true;
 						goto components_end; // don't do any more components on this branch
 					} else { //demand, , etc.
-						SimPlantEquip( LoopNum, LoopSideNum, BranchCounter, CompCounter, FirstHVACIteration, DummyInit, DoNotGetCompSizFac );
+						if ( ! BranchIsIdle( BranchIndex ) ) SimPlantEquip( LoopNum, LoopSideNum, BranchCounter, CompCounter, FirstHVACIteration, DummyInit, DoNotGetCompSizFac );
 					}
 				}
 
@@ -1342,7 +1372,7 @@ namespace PlantLoopSolver {
 
 				switch ( CurOpSchemeType ) {
 				case NoControlOpSchemeType: //~ pipes, for example
-					SimPlantEquip( LoopNum, LoopSideNum, BranchCounter, CompCounter, FirstHVACIteration, DummyInit, DoNotGetCompSizFac );
+					if ( ! BranchIsIdle( BranchIndex ) ) SimPlantEquip( LoopNum, LoopSideNum, BranchCounter, CompCounter, FirstHVACIteration, DummyInit, DoNotGetCompSizFac );
 					break;
 				case DemandOpSchemeType:
 				case CompSetPtBasedSchemeType:
@@ -1365,7 +1395,7 @@ namespace PlantLoopSolver {
 						if ( ! LoadDistributionWasPerformed ) { //~ Still need to distribute load among load range based components
 							ManagePlantLoadDistribution( LoopNum, LoopSideNum, BranchCounter, CompCounter, LoadToLoopSetPoint, LoadToLoopSetPointThatWasntMet, FirstHVACIteration, LoopShutDownFlag, LoadDistributionWasPerformed );
 						}
-						SimPlantEquip( LoopNum, LoopSideNum, BranchCounter, CompCounter, FirstHVACIteration, DummyInit, DoNotGetCompSizFac );
+						if ( ! BranchIsIdle( BranchIndex ) ) SimPlantEquip( LoopNum, LoopSideNum, BranchCounter, CompCounter, FirstHVACIteration, DummyInit, DoNotGetCompSizFac );
 					}
 				}
 
@@ -1402,7 +1432,7 @@ namespace PlantLoopSolver {
 
 				switch ( CurOpSchemeType ) {
 				case DemandOpSchemeType: //~ coils
-					SimPlantEquip( LoopNum, LoopSideNum, BranchCounter, CompCounter, FirstHVACIteration, DummyInit, DoNotGetCompSizFac );
+					if ( ! BranchIsIdle( BranchIndex ) ) SimPlantEquip( LoopNum, LoopSideNum, BranchCounter, CompCounter, FirstHVACIteration, DummyInit, DoNotGetCompSizFac );
 					break;
 				case PumpOpSchemeType: //~ pump
 					PumpLocation.LoopNum = LoopNum;
@@ -1419,7 +1449,7 @@ namespace PlantLoopSolver {
 					if ( ( CurOpSchemeType >= LoadRangeBasedMin ) && ( CurOpSchemeType <= LoadRangeBasedMax ) ) { //~ load range based
 						ShowFatalError( "Encountered Load Based Object after other components, invalid." );
 					} else { //~ Typical control equipment
-						SimPlantEquip( LoopNum, LoopSideNum, BranchCounter, CompCounter, FirstHVACIteration, DummyInit, DoNotGetCompSizFac );
+						if ( ! BranchIsIdle( BranchIndex ) ) SimPlantEquip( LoopNum, LoopSideNum, BranchCounter, CompCounter, FirstHVACIteration, DummyInit, DoNotGetCompSizFac );
 					}
 				}
 
@@ -1439,6 +1469,51 @@ namespace PlantLoopSolver {
 
 	}
 
+	bool
+	BranchCanSkipWhenIdle(
+		int const LoopNum,
+		int const LoopSideNum,
+		int const BranchNum
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Determines if every component on a branch is fully described by its inlet node state when
+		//  it has no flow, so that an idle branch does not need to be resimulated once flow is locked.
+
+		// METHODOLOGY EMPLOYED:
+		// Plain pipes, boilers, chillers and heat rejection equipment shut off and pass the inlet
+		//  conditions through without flow.  Pumps, storage, ground coupled and other components that
+		//  carry state or act without flow make the branch ineligible.
+
+		// Using/Aliasing
+		using namespace DataPlant;
+
+		// Return value
+		bool CanSkip( true );
+
+		auto const & branch( PlantLoop( LoopNum ).LoopSide( LoopSideNum ).Branch( BranchNum ) );
+		if ( branch.IsBypass ) return false;
+		for ( int CompNum = 1; CompNum <= branch.TotalComponents; ++CompNum ) {
+			{ auto const SELECT_CASE_var( branch.Comp( CompNum ).TypeOf_Num );
+			if ( ( SELECT_CASE_var == TypeOf_Pipe ) || ( SELECT_CASE_var == TypeOf_PipeSteam ) || ( SELECT_CASE_var == TypeOf_Boiler_Simple ) || ( SELECT_CASE_var == TypeOf_Chiller_Electric ) || ( SELECT_CASE_var == TypeOf_Chiller_ElectricEIR ) || ( SELECT_CASE_var == TypeOf_Chiller_ElectricReformEIR ) || ( SELECT_CASE_var == TypeOf_Chiller_ConstCOP ) || ( SELECT_CASE_var == TypeOf_Chiller_EngineDriven ) || ( SELECT_CASE_var == TypeOf_Chiller_CombTurbine ) || ( SELECT_CASE_var == TypeOf_Chiller_Absorption ) || ( SELECT_CASE_var == TypeOf_Chiller_Indirect_Absorption ) || ( SELECT_CASE_var == TypeOf_CoolingTower_SingleSpd ) || ( SELECT_CASE_var == TypeOf_CoolingTower_TwoSpd ) || ( SELECT_CASE_var == TypeOf_CoolingTower_VarSpd ) || ( SELECT_CASE_var == TypeOf_CoolingTower_VarSpdMerkel ) || ( SELECT_CASE_var == TypeOf_FluidCooler_SingleSpd ) || ( SELECT_CASE_var == TypeOf_FluidCooler_TwoSpd ) || ( SELECT_CASE_var == TypeOf_EvapFluidCooler_SingleSpd ) || ( SELECT_CASE_var == TypeOf_EvapFluidCooler_TwoSpd ) ) {
+				// shuts off without flow
+			} else {
+				CanSkip = false;
+			}}
+			if ( ! CanSkip ) break;
+		}
+
+		return CanSkip;
+
+	}
+
 	//==================================================================!
 	//==================================================================!
 	//==================================================================!
@@ -197,6 +197,13 @@ namespace PlantLoopSolver {
 		bool const StartingNewLoopSidePass = false
 	);
 
+	bool
+	BranchCanSkipWhenIdle(
+		int const LoopNum,
+		int const LoopSideNum,
+		int const BranchNum
+	);
+
 	//==================================================================!
 	//==================================================================!
 	//==================================================================!
@@ -61,6 +61,7 @@
 #include <cmath>
 #include <vector>
 #include <memory>
+#include <unordered_map>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -74,6 +75,8 @@
 #include <BranchInputManager.hh>
 #include <DataAirLoop.hh>
 #include <DataAirSystems.hh>
+#include <DataAirflowNetwork.hh>
+#include <DataBranchNodeConnections.hh>
 #include <DataContaminantBalance.hh>
 #include <DataConvergParams.hh>
 #include <DataDefineEquip.hh>
@@ -110,6 +113,7 @@
 #include <InputProcessor.hh>
 #include <MixedAir.hh>
 #include <NodeInputManager.hh>
+#include <OutAirNodeManager.hh>
 #include <OutputProcessor.hh>
 #include <OutputReportPredefined.hh>
 #include <Psychrometrics.hh>
@@ -212,6 +216,13 @@ namespace SimAirServingZones {
 
 	int NumOfTimeStepInDay; // number of zone time steps in a day
 
+	int NumAirLoopPartitions( 0 ); // number of groups of air loops that share no nodes, zones or plant loops
+	Array1D_int AirLoopPartition; // partition number of each air loop
+	Array1D_bool AirLoopPartitionIsolated; // TRUE if the partition has no plant nodes or heat reclaim from other systems
+	Array1D_bool AirLoopPartitionSkip; // TRUE if the partition is not resimulated on the current HVAC iteration
+	Array1D_int AirLoopSimCount; // times each air loop was simulated in the current system timestep
+	Array1D_bool AirLoopEconoLockoutLast; // economizer lockout at the last simulation of each air loop
+
 	namespace {
 	// These were static variables within different functions. They were pulled out into the namespace
 	// to facilitate easier unit testing of those functions.
@@ -251,6 +262,12 @@ namespace SimAirServingZones {
 		TestUniqueNodesNum = 0;
 		FaByZoneCool.deallocate(); // triggers allocation in UpdateSysSizing
 		SensCoolCapTemp.deallocate(); // triggers allocation in UpdateSysSizing
+		NumAirLoopPartitions = 0;
+		AirLoopPartition.deallocate();
+		AirLoopPartitionIsolated.deallocate();
+		AirLoopPartitionSkip.deallocate();
+		AirLoopSimCount.deallocate();
+		AirLoopEconoLockoutLast.deallocate();
 	}
 
 	void
@@ -2262,10 +2279,19 @@ namespace SimAirServingZones {
 			}
 		}
 
+		SetAirLoopPartitionSkipFlags( FirstHVACIteration );
+
 		// Loop over all the primary air loop; simulate their components (equipment)
 		// and controllers
 		for ( AirLoopNum = 1; AirLoopNum <= NumPrimaryAirSys; ++AirLoopNum ) { // NumPrimaryAirSys is the number of primary air loops
 
+			if ( NumAirLoopPartitions > 0 ) {
+				// keep the last solution of converged, independent groups of air loops
+				if ( AirLoopPartitionSkip( AirLoopPartition( AirLoopNum ) ) ) continue;
+				++AirLoopSimCount( AirLoopNum );
+				AirLoopEconoLockoutLast( AirLoopNum ) = AirLoopControlInfo( AirLoopNum ).EconoLockout;
+			}
+
 			// Check to see if System Availability Managers are asking for fans to cycle on or shut off
 			// and set fan on/off flags accordingly.
 			TurnFansOn = false;
@@ -2334,6 +2360,154 @@ namespace SimAirServingZones {
 
 	}
 
+	void
+	SetupAirLoopPartitions()
+	{
+
+		// SUBROUTINE INFORMATION
+		//             AUTHOR:  na
+		//       DATE WRITTEN:  na
+		//      RE-ENGINEERED:  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Group the primary air systems into partitions that share no nodes, zones or plant loops,
+		// so that a partition can be left alone once its own interfaces have converged.
+
+		// METHODOLOGY EMPLOYED:
+		// The node connection list is treated as a graph: all nodes registered by the same object are
+		// joined (union-find), so air loop branches, splitters, terminal units, zone equipment
+		// connections, plenums and plant loops link up. Outdoor air nodes, sensor and setpoint
+		// references are boundary conditions and are not joined. Each air loop then belongs to the
+		// group of its supply outlet node. A partition is isolated if it has no water or steam nodes
+		// (plant is simulated after the air loops) and no components that take heat from another system.
+		// Must be called after all HVAC input has been read (after the first HVAC simulation).
+
+		// Using/Aliasing
+		using DataBranchNodeConnections::NodeConnections;
+		using DataBranchNodeConnections::NumOfNodeConnections;
+		using DataSystemVariables::SkipConvergedAirLoops;
+		using InputProcessor::SameString;
+		using OutAirNodeManager::CheckOutAirNodeNumber;
+		using General::RoundSigDigits;
+
+		// SUBROUTINE PARAMETER DEFINITIONS
+		static gio::Fmt fmtA( "(A)" );
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS
+		std::vector< int > NodeGroup( NumOfNodes + 1 ); // union-find parent of each node
+		std::unordered_map< std::string, int > ObjectFirstNode; // first node registered by each object
+		Array1D_int GroupPartition; // partition number of each node group root
+		int ConnNum;
+		int NodeNum;
+		int AirLoopNum;
+		int Root;
+
+		auto FindGroup = [ &NodeGroup ]( int Node ) {
+			while ( NodeGroup[ Node ] != Node ) {
+				NodeGroup[ Node ] = NodeGroup[ NodeGroup[ Node ] ]; // path halving
+				Node = NodeGroup[ Node ];
+			}
+			return Node;
+		};
+
+		NumAirLoopPartitions = 0;
+		if ( NumPrimaryAirSys == 0 || NumOfNodes == 0 ) return;
+
+		for ( NodeNum = 0; NodeNum <= NumOfNodes; ++NodeNum ) NodeGroup[ NodeNum ] = NodeNum;
+
+		for ( ConnNum = 1; ConnNum <= NumOfNodeConnections; ++ConnNum ) {
+			auto const & thisConn( NodeConnections( ConnNum ) );
+			NodeNum = thisConn.NodeNumber;
+			if ( NodeNum <= 0 || NodeNum > NumOfNodes ) continue;
+			if ( SameString( thisConn.ConnectionType, "Sensor" ) || SameString( thisConn.ConnectionType, "Setpoint" ) || SameString( thisConn.ConnectionType, "OutsideAirReference" ) || SameString( thisConn.ConnectionType, "Electric" ) ) continue;
+			if ( CheckOutAirNodeNumber( NodeNum ) ) continue;
+			auto const Found = ObjectFirstNode.emplace( thisConn.ObjectType + ':' + thisConn.ObjectName, NodeNum );
+			if ( ! Found.second ) NodeGroup[ FindGroup( NodeNum ) ] = FindGroup( Found.first->second );
+		}
+
+		AirLoopPartition.dimension( NumPrimaryAirSys, 0 );
+		GroupPartition.dimension( NumOfNodes, 0 );
+		for ( AirLoopNum = 1; AirLoopNum <= NumPrimaryAirSys; ++AirLoopNum ) {
+			Root = FindGroup( AirToZoneNodeInfo( AirLoopNum ).AirLoopSupplyNodeNum( 1 ) );
+			if ( GroupPartition( Root ) == 0 ) GroupPartition( Root ) = ++NumAirLoopPartitions;
+			AirLoopPartition( AirLoopNum ) = GroupPartition( Root );
+		}
+
+		AirLoopPartitionIsolated.dimension( NumAirLoopPartitions, true );
+		for ( NodeNum = 1; NodeNum <= NumOfNodes; ++NodeNum ) {
+			if ( Node( NodeNum ).FluidType != NodeType_Water && Node( NodeNum ).FluidType != NodeType_Steam ) continue;
+			Root = FindGroup( NodeNum );
+			if ( GroupPartition( Root ) > 0 ) AirLoopPartitionIsolated( GroupPartition( Root ) ) = false;
+		}
+		for ( ConnNum = 1; ConnNum <= NumOfNodeConnections; ++ConnNum ) {
+			auto const & thisConn( NodeConnections( ConnNum ) );
+			if ( thisConn.NodeNumber <= 0 || thisConn.NodeNumber > NumOfNodes ) continue;
+			if ( ! SameString( thisConn.ObjectType, "Coil:Heating:Desuperheater" ) && ! SameString( thisConn.ObjectType, "Coil:UserDefined" ) ) continue;
+			Root = FindGroup( thisConn.NodeNumber );
+			if ( GroupPartition( Root ) > 0 ) AirLoopPartitionIsolated( GroupPartition( Root ) ) = false;
+		}
+
+		AirLoopPartitionSkip.dimension( NumAirLoopPartitions, false );
+		AirLoopSimCount.dimension( NumPrimaryAirSys, 0 );
+		AirLoopEconoLockoutLast.dimension( NumPrimaryAirSys, false );
+
+		if ( SkipConvergedAirLoops ) {
+			gio::write( OutputFileInits, fmtA ) << "! <Air Loop Partition>, Air Loop Name, Partition Number, Isolated";
+			for ( AirLoopNum = 1; AirLoopNum <= NumPrimaryAirSys; ++AirLoopNum ) {
+				gio::write( OutputFileInits, fmtA ) << " Air Loop Partition," + PrimaryAirSystem( AirLoopNum ).Name + ',' + RoundSigDigits( AirLoopPartition( AirLoopNum ) ) + ',' + ( AirLoopPartitionIsolated( AirLoopPartition( AirLoopNum ) ) ? "Yes" : "No" );
+			}
+		}
+
+	}
+
+	void
+	SetAirLoopPartitionSkipFlags( bool const FirstHVACIteration ) // TRUE if first full HVAC iteration in an HVAC timestep
+	{
+
+		// SUBROUTINE INFORMATION
+		//             AUTHOR:  na
+		//       DATE WRITTEN:  na
+		//      RE-ENGINEERED:  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Flag the air loop partitions that need not be resimulated on this HVAC iteration.
+
+		// METHODOLOGY EMPLOYED:
+		// An isolated partition only sees the rest of the HVAC system through its return (demand side)
+		// interfaces, so once every air loop in it has been simulated on two iterations of this system
+		// timestep, its return interfaces are converged (same tolerances as SimHVAC), no heat recovery
+		// or economizer lockout resimulation is pending, resimulating it would reproduce the last solution.
+		// Only active with the SkipConvergedAirLoops environment variable, and never with EMS or
+		// an AirflowNetwork, which can change loop inputs between iterations.
+
+		// Using/Aliasing
+		using DataSystemVariables::SkipConvergedAirLoops;
+		using DataConvergParams::AirLoopConvergence;
+		using DataAirflowNetwork::SimulateAirflowNetwork;
+		using DataAirflowNetwork::AirflowNetworkControlSimple;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS
+		int AirLoopNum;
+
+		if ( NumAirLoopPartitions == 0 ) return;
+		AirLoopPartitionSkip = false;
+		if ( FirstHVACIteration ) {
+			AirLoopSimCount = 0;
+			return;
+		}
+		if ( ! SkipConvergedAirLoops || AnyEnergyManagementSystemInModel || SimulateAirflowNetwork > AirflowNetworkControlSimple ) return;
+
+		AirLoopPartitionSkip = AirLoopPartitionIsolated;
+		for ( AirLoopNum = 1; AirLoopNum <= NumPrimaryAirSys; ++AirLoopNum ) {
+			auto const & thisConverg( AirLoopConvergence( AirLoopNum ) );
+			auto const & thisControl( AirLoopControlInfo( AirLoopNum ) );
+			if ( AirLoopSimCount( AirLoopNum ) < 2 || thisControl.ResimAirLoopFlag || thisControl.EconoLockout != AirLoopEconoLockoutLast( AirLoopNum ) || thisConverg.HVACMassFlowNotConverged( 1 ) || thisConverg.HVACHumRatNotConverged( 1 ) || thisConverg.HVACTempNotConverged( 1 ) || thisConverg.HVACEnergyNotConverged( 1 ) || thisConverg.HVACEnthalpyNotConverged( 1 ) || thisConverg.HVACPressureNotConverged( 1 ) ) {
+				AirLoopPartitionSkip( AirLoopPartition( AirLoopNum ) ) = false;
+			}
+		}
+
+	}
+
 	void
 	SimAirLoop(
 		bool const FirstHVACIteration,
@@ -62,6 +62,9 @@
 // C++ Headers
 #include <string>
 
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+
 // EnergyPlus Headers
 #include <EnergyPlus.hh>
 
@@ -114,6 +117,12 @@ namespace SimAirServingZones {
 	extern Array1D< Real64 > VbzByZone; // saved value of ZoneOAUnc which is Vbz used in 62.1 tabular report
 	extern bool GetAirLoopInputFlag; // Flag set to make sure you get input once
 	extern int NumOfTimeStepInDay; // number of zone time steps in a day
+	extern int NumAirLoopPartitions; // number of groups of air loops that share no nodes, zones or plant loops
+	extern Array1D_int AirLoopPartition; // partition number of each air loop
+	extern Array1D_bool AirLoopPartitionIsolated; // TRUE if the partition has no plant nodes or heat reclaim from other systems
+	extern Array1D_bool AirLoopPartitionSkip; // TRUE if the partition is not resimulated on the current HVAC iteration
+	extern Array1D_int AirLoopSimCount; // times each air loop was simulated in the current system timestep
+	extern Array1D_bool AirLoopEconoLockoutLast; // economizer lockout at the last simulation of each air loop
 
 	// Subroutine Specifications for the Module
 	// Driver/Manager Routines
@@ -159,6 +168,12 @@ namespace SimAirServingZones {
 		bool & SimZoneEquipment
 	);
 
+	void
+	SetupAirLoopPartitions();
+
+	void
+	SetAirLoopPartitionSkipFlags( bool const FirstHVACIteration ); // TRUE if first full HVAC iteration in an HVAC timestep
+
 	void
 	SimAirLoop(
 		bool const FirstHVACIteration,
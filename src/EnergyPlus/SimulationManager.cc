@@ -107,6 +107,7 @@ extern "C" {
 #include <DemandManager.hh>
 #include <DisplayRoutines.hh>
 #include <DualDuct.hh>
+#include <DXCoils.hh>
 #include <EconomicLifeCycleCost.hh>
 #include <EconomicTariff.hh>
 #include <ElectricPowerServiceManager.hh>
@@ -137,6 +138,7 @@ extern "C" {
 #include <Psychrometrics.hh>
 #include <RefrigeratedCase.hh>
 #include <SetPointManager.hh>
+#include <SimAirServingZones.hh>
 #include <SizingManager.hh>
 #include <SolarShading.hh>
 #include <SQLiteProcedures.hh>
@@ -281,6 +283,7 @@ namespace SimulationManager {
 		using General::TrimSigDigits;
 		using OutputReportPredefined::SetPredefinedTables;
 		using HVACControllers::DumpAirLoopStatistics;
+		using DXCoils::ReportDXCoilPerfMemo;
 		using NodeInputManager::SetupNodeVarsForReporting;
 		using NodeInputManager::CheckMarkedNodes;
 		using BranchNodeConnections::CheckNodeConnections;
@@ -289,6 +292,7 @@ namespace SimulationManager {
 		using PollutionModule::SetupPollutionCalculations;
 		using PollutionModule::CheckPollutionMeterReporting;
 		using SystemReports::ReportAirLoopConnections;
+		using SimAirServingZones::SetupAirLoopPartitions;
 		using SystemReports::CreateEnergyReportStructure;
 		using BranchInputManager::ManageBranchInput;
 		using BranchInputManager::TestBranchIntegrity;
@@ -441,6 +445,7 @@ namespace SimulationManager {
 			if ( ErrFound ) TerminalError = true;
 			CheckControllerLists( ErrFound );
 			if ( ErrFound ) TerminalError = true;
+			SetupAirLoopPartitions();
 
 			if ( DoDesDaySim || DoWeathSim ) {
 				ReportLoopConnections();
@@ -656,6 +661,8 @@ namespace SimulationManager {
 
 		DumpAirLoopStatistics(); // Dump runtime statistics for air loop controller simulation to csv file
 
+		ReportDXCoilPerfMemo(); // Write DX coil performance memo hit counts to eio file
+
 #ifdef EP_Detailed_Timings
 		epStopTime( "Closeout Reporting=" );
 #endif
@@ -745,7 +752,7 @@ namespace SimulationManager {
 		// Formats
 		static gio::Fmt Format_721( "(' Version, ',A)" );
 		static gio::Fmt Format_731( "(' Timesteps per Hour, ',I2,', ',I2)" );
-		static gio::Fmt Format_733( "(' System Convergence Limits',4(', ',A))" );
+		static gio::Fmt Format_733( "(' System Convergence Limits',5(', ',A))" );
 		static gio::Fmt Format_741( "(' Simulation Control',$)" );
 		static gio::Fmt Format_741_1( "(', ',A,$)" );
 		static gio::Fmt Format_751( "(' Output Reporting Tolerances',5(', ',A))" );
@@ -909,6 +916,7 @@ namespace SimulationManager {
 			if ( MinPlantSubIterations < 1 ) MinPlantSubIterations = 1;
 			if ( MaxPlantSubIterations < 3 ) MaxPlantSubIterations = 3;
 			if ( MinPlantSubIterations > MaxPlantSubIterations ) MaxPlantSubIterations = MinPlantSubIterations + 1;
+			if ( ! lNumericFieldBlanks( 5 ) ) ZoneTempErrorTol = max( Number( 5 ), 0.0 );
 
 		} else if ( Num == 0 ) {
 			MinTimeStepSys = 1.0 / 60.0;
@@ -1052,9 +1060,9 @@ namespace SimulationManager {
 		gio::write( OutputFileInits, fmtA ) << "! <Timesteps per Hour>, #TimeSteps, Minutes per TimeStep {minutes}";
 		gio::write( OutputFileInits, Format_731 ) << NumOfTimeStepInHour << int( MinutesPerTimeStep );
 
-		gio::write( OutputFileInits, fmtA ) << "! <System Convergence Limits>, Minimum System TimeStep {minutes}, Max HVAC Iterations, Minimum Plant Iterations, Maximum Plant Iterations";
+		gio::write( OutputFileInits, fmtA ) << "! <System Convergence Limits>, Minimum System TimeStep {minutes}, Max HVAC Iterations, Minimum Plant Iterations, Maximum Plant Iterations, Zone Air Temperature Error Tolerance {deltaC}";
 		MinInt = MinTimeStepSys * 60.0;
-		gio::write( OutputFileInits, Format_733 ) << RoundSigDigits( MinInt ) << RoundSigDigits( MaxIter ) << RoundSigDigits( MinPlantSubIterations ) << RoundSigDigits( MaxPlantSubIterations );
+		gio::write( OutputFileInits, Format_733 ) << RoundSigDigits( MinInt ) << RoundSigDigits( MaxIter ) << RoundSigDigits( MinPlantSubIterations ) << RoundSigDigits( MaxPlantSubIterations ) << RoundSigDigits( ZoneTempErrorTol, 3 );
 
 		if ( DoZoneSizing ) {
 			Alphas( 1 ) = "Yes";
@@ -57,8 +57,10 @@
 // in binary and source code form.
 
 // C++ Headers
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array.functions.hh>
@@ -221,6 +223,26 @@ namespace SolarShading {
 		bool MustAllocSolarShading( true );
 		bool GetInputFlag( true );
 		bool firstTime( true );
+
+		Real64 const ShadowCasterTolerance( 0.0003 ); // Plane distance tolerance (matches CHKGSS)
+
+		// Candidate shadow casting surface bounding data used by DetermineShadowingCombinations
+		struct ShadowCasterBound
+		{
+			// Members
+			int SurfNum; // Surface number of the casting surface
+			Real64 ZMax; // Highest point of the casting surface
+			Vector Center; // Center of the casting surface bounding box
+			Vector HalfWidth; // Half-widths of the casting surface bounding box
+
+			// Default Constructor
+			ShadowCasterBound() :
+				SurfNum( 0 ),
+				ZMax( 0.0 ),
+				Center( 0.0 ),
+				HalfWidth( 0.0 )
+			{}
+		};
 	}
 
 	std::ofstream shd_stream; // Shading file stream
@@ -3317,6 +3339,47 @@ namespace SolarShading {
 		NV2 = HCNV( NS2 );
 		NV3 = 0;
 
+		// Convex figures whose bounding boxes are separated cannot overlap: skip the clipping
+		if ( ( NV1 > 0 ) && ( NV2 > 0 ) ) {
+			assert( equal_dimensions( HCX, HCY ) );
+			auto l1( HCX.index( NS1, 1 ) );
+			Int64 XMin1( HCX[ l1 ] ), XMax1( XMin1 ), YMin1( HCY[ l1 ] ), YMax1( YMin1 );
+			for ( N = 2, ++l1; N <= NV1; ++N, ++l1 ) { // [ l1 ] == ( NS1, N )
+				Int64 const X( HCX[ l1 ] );
+				Int64 const Y( HCY[ l1 ] );
+				if ( X < XMin1 ) {
+					XMin1 = X;
+				} else if ( X > XMax1 ) {
+					XMax1 = X;
+				}
+				if ( Y < YMin1 ) {
+					YMin1 = Y;
+				} else if ( Y > YMax1 ) {
+					YMax1 = Y;
+				}
+			}
+			auto l2( HCX.index( NS2, 1 ) );
+			Int64 XMin2( HCX[ l2 ] ), XMax2( XMin2 ), YMin2( HCY[ l2 ] ), YMax2( YMin2 );
+			for ( N = 2, ++l2; N <= NV2; ++N, ++l2 ) { // [ l2 ] == ( NS2, N )
+				Int64 const X( HCX[ l2 ] );
+				Int64 const Y( HCY[ l2 ] );
+				if ( X < XMin2 ) {
+					XMin2 = X;
+				} else if ( X > XMax2 ) {
+					XMax2 = X;
+				}
+				if ( Y < YMin2 ) {
+					YMin2 = Y;
+				} else if ( Y > YMax2 ) {
+					YMax2 = Y;
+				}
+			}
+			if ( ( XMax1 < XMin2 ) || ( XMax2 < XMin1 ) || ( YMax1 < YMin2 ) || ( YMax2 < YMin1 ) ) {
+				OverlapStatus = NoOverlap;
+				return;
+			}
+		}
+
 		if ( ! SutherlandHodgman ) {
 			INCLOS( NS1, NV1, NS2, NV2, NV3, NIN1 ); // Find vertices of NS1 within NS2.
 
@@ -3835,6 +3898,50 @@ namespace SolarShading {
 			return;
 		}
 
+		// Index the surfaces once so each receiving surface only visits its own subsurfaces, the heat transfer
+		// surfaces of its zone and the casting surfaces that reach above its lowest point, rather than every surface.
+		// The lists are in surface number order so the combinations match a scan of all surfaces.
+		std::vector< std::vector< int > > SubSurfaces( TotSurfaces + 1 ); // Subsurfaces of each surface
+		int MaxZoneNum( 0 ); // Highest zone number of a heat transfer surface
+		for ( SBSNR = 1; SBSNR <= TotSurfaces; ++SBSNR ) {
+			int const BaseSurfNum( Surface( SBSNR ).BaseSurf );
+			if ( ( BaseSurfNum > 0 ) && ( BaseSurfNum <= TotSurfaces ) && ( BaseSurfNum != SBSNR ) ) SubSurfaces[ BaseSurfNum ].push_back( SBSNR );
+			if ( Surface( SBSNR ).HeatTransSurf ) MaxZoneNum = max( MaxZoneNum, Surface( SBSNR ).Zone );
+		}
+		std::vector< std::vector< int > > ZoneSurfaces( MaxZoneNum + 1 ); // Possible back surfaces in each zone
+		for ( BackSurfaceNumber = 1; BackSurfaceNumber <= TotSurfaces; ++BackSurfaceNumber ) {
+			if ( ! Surface( BackSurfaceNumber ).HeatTransSurf ) continue;
+			if ( Surface( BackSurfaceNumber ).Class == SurfaceClass_IntMass ) continue;
+			if ( Surface( BackSurfaceNumber ).Zone < 1 ) continue;
+			ZoneSurfaces[ Surface( BackSurfaceNumber ).Zone ].push_back( BackSurfaceNumber );
+		}
+
+		// Detached shadowing surfaces and base surfaces exposed to the outside environment can shade other
+		// surfaces: keep their bounding boxes, highest first. Upward facing ones are dropped here as CHKGSS
+		// would reject them for every receiving surface.
+		std::vector< ShadowCasterBound > Casters;
+		if ( SolarDistribution != MinimalShadowing ) {
+			for ( GSSNR = 1; GSSNR <= TotSurfaces; ++GSSNR ) {
+				auto const & surface_C( Surface( GSSNR ) );
+				if ( ! ( ( surface_C.BaseSurf == 0 ) || ( ( surface_C.BaseSurf == GSSNR ) && ( ( surface_C.ExtBoundCond == ExternalEnvironment ) || surface_C.ExtBoundCond == OtherSideCondModeledExt ) ) ) ) continue;
+				if ( surface_C.OutNormVec( 3 ) > 0.9999 ) continue;
+				auto const & vertex_C( surface_C.Vertex );
+				Vector Lower( vertex_C( 1 ) );
+				Vector Upper( vertex_C( 1 ) );
+				for ( int i = 2, e = surface_C.Sides; i <= e; ++i ) {
+					Lower.min( vertex_C( i ) );
+					Upper.max( vertex_C( i ) );
+				}
+				ShadowCasterBound Caster;
+				Caster.SurfNum = GSSNR;
+				Caster.ZMax = Upper.z;
+				Caster.Center = 0.5 * ( Lower + Upper );
+				Caster.HalfWidth = 0.5 * ( Upper - Lower );
+				Casters.push_back( Caster );
+			}
+			std::stable_sort( Casters.begin(), Casters.end(), []( ShadowCasterBound const & a, ShadowCasterBound const & b ){ return a.ZMax > b.ZMax; } );
+		}
+
 		for ( GRSNR = 1; GRSNR <= TotSurfaces; ++GRSNR ) { // Loop through all surfaces (looking for potential receiving surfaces)...
 
 			ShadowingSurf = Surface( GRSNR ).ShadowingSurf;
@@ -3853,13 +3960,43 @@ namespace SolarShading {
 
 			// Check every surface as a possible shadow casting surface ("SS" = shadow sending)
 			NGSS = 0;
+			for ( int const SubSurfNum : SubSurfaces[ GRSNR ] ) { // Shadowing subsurfaces of receiving surface
+
+				GSSNR = SubSurfNum;
+				if ( Surface( GSSNR ).HeatTransSurf ) continue; // A heat transfer subsurface of a receiving surface
+				// cannot shade the receiving surface
+				if ( ShadowingSurf && ( SolarDistribution != MinimalShadowing ) ) {
+					// If receiving surf is a shadowing surface exclude matching shadow surface as sending surface
+					if ( ( ( GSSNR == GRSNR + 1 ) && Surface( GSSNR ).MirroredSurf ) || ( ( GSSNR == GRSNR - 1 ) && Surface( GRSNR ).MirroredSurf ) ) continue;
+				}
+
+				++NGSS;
+				if ( NGSS > MaxGSS ) {
+					GSS.redimension( MaxGSS *= 2, 0 );
+				}
+				GSS( NGSS ) = GSSNR;
+
+			}
+
 			if ( SolarDistribution != MinimalShadowing ) { // Except when doing simplified exterior shadowing.
 
-				for ( GSSNR = 1; GSSNR <= TotSurfaces; ++GSSNR ) { // Loop through all surfaces, looking for ones that could shade GRSNR
+				// Receiving surface plane (as in CHKGSS) for the conservative bounding box check: a casting surface
+				// whose box lies entirely behind the plane has no vertex in front of it, so CHKGSS would reject it
+				bool const UseBound( Surface( GRSNR ).Sides >= 3 );
+				Vector RVec( 0.0 ); // Vertex 2 of receiving surface
+				Vector CVec( 0.0 ); // Vector perpendicular to receiving surface at vertex 2
+				if ( UseBound ) {
+					auto const & vertex_R( Surface( GRSNR ).Vertex );
+					RVec = vertex_R( 2 );
+					CVec = cross( vertex_R( 3 ) - RVec, vertex_R( 1 ) - RVec );
+				}
+				Real64 const CSum( std::abs( CVec.x ) + std::abs( CVec.y ) + std::abs( CVec.z ) );
+
+				for ( auto const & Caster : Casters ) { // Casting surfaces, highest first
 
+					if ( Caster.ZMax <= ZMIN ) break; // This and all remaining casting surfaces are below the receiving surface
+					GSSNR = Caster.SurfNum;
 					if ( GSSNR == GRSNR ) continue; // Receiving surface cannot shade itself
-					if ( ( Surface( GSSNR ).HeatTransSurf ) && ( Surface( GSSNR ).BaseSurf == GRSNR ) ) continue; // A heat transfer subsurface of a receiving surface
-					// cannot shade the receiving surface
 					if ( ShadowingSurf ) {
 						// If receiving surf is a shadowing surface exclude matching shadow surface as sending surface
 						//IF((GSSNR == GRSNR+1 .AND. Surface(GSSNR)%Name(1:3) == 'Mir').OR. &
@@ -3867,42 +4004,27 @@ namespace SolarShading {
 						if ( ( ( GSSNR == GRSNR + 1 ) && Surface( GSSNR ).MirroredSurf ) || ( ( GSSNR == GRSNR - 1 ) && Surface( GRSNR ).MirroredSurf ) ) continue;
 					}
 
-					if ( Surface( GSSNR ).BaseSurf == GRSNR ) { // Shadowing subsurface of receiving surface
+					if ( UseBound ) {
+						Vector const Offset( Caster.Center - RVec );
+						Real64 const DOTMax( dot( CVec, Offset ) + std::abs( CVec.x ) * Caster.HalfWidth.x + std::abs( CVec.y ) * Caster.HalfWidth.y + std::abs( CVec.z ) * Caster.HalfWidth.z );
+						// Allowance for the roundoff of the vertex dot products in CHKGSS keeps this check conservative
+						Real64 const DOTTol( 1.0e-9 * CSum * ( max( std::abs( Offset.x ), std::abs( Offset.y ), std::abs( Offset.z ) ) + max( Caster.HalfWidth.x, Caster.HalfWidth.y, Caster.HalfWidth.z ) ) );
+						if ( DOTMax + DOTTol <= ShadowCasterTolerance ) continue;
+					}
 
+					CHKGSS( GRSNR, GSSNR, ZMIN, CannotShade ); // Check to see if this can shade the receiving surface
+					if ( ! CannotShade ) { // Update the shadowing surface data if shading is possible
 						++NGSS;
 						if ( NGSS > MaxGSS ) {
 							GSS.redimension( MaxGSS *= 2, 0 );
 						}
 						GSS( NGSS ) = GSSNR;
-
-					} else if ( ( Surface( GSSNR ).BaseSurf == 0 ) || ( ( Surface( GSSNR ).BaseSurf == GSSNR ) && ( ( Surface( GSSNR ).ExtBoundCond == ExternalEnvironment ) || Surface( GSSNR ).ExtBoundCond == OtherSideCondModeledExt ) ) ) { // Detached shadowing surface or | any other base surface exposed to outside environment
-
-						CHKGSS( GRSNR, GSSNR, ZMIN, CannotShade ); // Check to see if this can shade the receiving surface
-						if ( ! CannotShade ) { // Update the shadowing surface data if shading is possible
-							++NGSS;
-							if ( NGSS > MaxGSS ) {
-								GSS.redimension( MaxGSS *= 2, 0 );
-							}
-							GSS( NGSS ) = GSSNR;
-						}
-
 					}
 
-				} // ...end of surfaces DO loop (GSSNR)
-			} else { // Simplified Distribution -- still check for Shading Subsurfaces
+				} // ...end of casting surfaces loop
 
-				for ( GSSNR = 1; GSSNR <= TotSurfaces; ++GSSNR ) { // Loop through all surfaces (looking for surfaces which could shade GRSNR) ...
-
-					if ( GSSNR == GRSNR ) continue; // Receiving surface cannot shade itself
-					if ( ( Surface( GSSNR ).HeatTransSurf ) && ( Surface( GSSNR ).BaseSurf == GRSNR ) ) continue; // Skip heat transfer subsurfaces of receiving surface
-					if ( Surface( GSSNR ).BaseSurf == GRSNR ) { // Shadowing subsurface of receiving surface
-						++NGSS;
-						if ( NGSS > MaxGSS ) {
-							GSS.redimension( MaxGSS *= 2, 0 );
-						}
-						GSS( NGSS ) = GSSNR;
-					}
-				}
+				// Keep the casting surfaces in surface number order
+				if ( NGSS > 1 ) std::sort( &GSS( 1 ), &GSS( 1 ) + NGSS );
 
 			} // ...end of check for simplified solar distribution
 
@@ -3910,11 +4032,10 @@ namespace SolarShading {
 			NSBS = 0;
 			HasWindow = false;
 			//legacy: IF (OSENV(HTS) > 10) WINDOW=.TRUE. -->Note: WINDOW was set true for roof ponds, solar walls, or other zones
-			for ( SBSNR = 1; SBSNR <= TotSurfaces; ++SBSNR ) { // Loop through the surfaces yet again (looking for subsurfaces of GRSNR)...
+			for ( int const SubSurfNum : SubSurfaces[ GRSNR ] ) { // Loop through the subsurfaces of GRSNR...
 
+				SBSNR = SubSurfNum;
 				if ( ! Surface( SBSNR ).HeatTransSurf ) continue; // Skip non heat transfer subsurfaces
-				if ( SBSNR == GRSNR ) continue; // Surface itself cannot be its own subsurface
-				if ( Surface( SBSNR ).BaseSurf != GRSNR ) continue; // Ignore subsurfaces of other surfaces and other surfaces
 
 				if ( Construct( Surface( SBSNR ).Construction ).TransDiff > 0.0 ) HasWindow = true; // Check for window
 				CHKSBS( HTS, GRSNR, SBSNR ); // Check that the receiving surface completely encloses the subsurface;
@@ -3925,22 +4046,19 @@ namespace SolarShading {
 				}
 				SBS( NSBS ) = SBSNR;
 
-			} // ...end of surfaces DO loop (SBSNR)
+			} // ...end of subsurfaces loop (SBSNR)
 
 			// Check every surface as a back surface
 			NBKS = 0;
 			//                                        Except for simplified
 			//                                        interior solar distribution,
-			if ( ( SolarDistribution == FullInteriorExterior ) && ( HasWindow ) ) { // For full interior solar distribution | and a window present on base surface (GRSNR)
+			if ( ( SolarDistribution == FullInteriorExterior ) && ( HasWindow ) && ( Surface( GRSNR ).Zone >= 1 ) && ( Surface( GRSNR ).Zone <= MaxZoneNum ) ) { // For full interior solar distribution | and a window present on base surface (GRSNR)
 
-				for ( BackSurfaceNumber = 1; BackSurfaceNumber <= TotSurfaces; ++BackSurfaceNumber ) { // Loop through surfaces yet again, looking for back surfaces to GRSNR
+				for ( int const ZoneSurfNum : ZoneSurfaces[ Surface( GRSNR ).Zone ] ) { // Loop through the heat transfer surfaces in the zone, looking for back surfaces to GRSNR
 
-					if ( ! Surface( BackSurfaceNumber ).HeatTransSurf ) continue; // Skip non-heat transfer surfaces
+					BackSurfaceNumber = ZoneSurfNum;
 					if ( Surface( BackSurfaceNumber ).BaseSurf == GRSNR ) continue; // Skip subsurfaces of this GRSNR
 					if ( BackSurfaceNumber == GRSNR ) continue; // A back surface cannot be GRSNR itself
-					if ( Surface( BackSurfaceNumber ).Zone != Surface( GRSNR ).Zone ) continue; // Skip if back surface not in zone
-
-					if ( Surface( BackSurfaceNumber ).Class == SurfaceClass_IntMass ) continue;
 
 					// Following line removed 1/27/03 by FCW. Was in original code that didn't do beam solar transmitted through
 					// interior windows. Was removed to allow such beam solar but then somehow was put back in.
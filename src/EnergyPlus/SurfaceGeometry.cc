@@ -61,6 +61,8 @@
 #include <cassert>
 #include <cmath>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Fmath.hh>
@@ -78,6 +80,7 @@
 #include <DataIPShortCuts.hh>
 #include <DataPrecisionGlobals.hh>
 #include <DataReportingFlags.hh>
+#include <DataTimings.hh>
 #include <DataWindowEquivalentLayer.hh>
 #include <DisplayRoutines.hh>
 #include <EMSManager.hh>
@@ -119,6 +122,8 @@ namespace SurfaceGeometry {
 	using namespace DataEnvironment;
 	using namespace DataHeatBalance;
 	using namespace DataSurfaces;
+	using DataTimings::epStartTime;
+	using DataTimings::epStopTime;
 	using DataWindowEquivalentLayer::CFSMAXNL;
 
 	// Use statements for access to subroutines in other modules
@@ -317,7 +322,13 @@ namespace SurfaceGeometry {
 			SinZoneRelNorth( ZoneNum ) = std::sin( -Zone( ZoneNum ).RelNorth * DegToRadians );
 
 		}
+#ifdef EP_Detailed_Timings
+		epStartTime( "GetSurfaceData=" );
+#endif
 		GetSurfaceData( ErrorsFound );
+#ifdef EP_Detailed_Timings
+		epStopTime( "GetSurfaceData=" );
+#endif
 
 		if ( ErrorsFound ) {
 			CosZoneRelNorth.deallocate();
@@ -344,6 +355,9 @@ namespace SurfaceGeometry {
 		FixedShadingCount = 0;
 		AttachedShadingCount = 0;
 
+#ifdef EP_Detailed_Timings
+		epStartTime( "ProcessSurfaceVertices=" );
+#endif
 		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) { // Loop through all surfaces...
 
 			AirSkyRadSplit( SurfNum ) = std::sqrt( 0.5 * ( 1.0 + Surface( SurfNum ).CosTilt ) );
@@ -357,6 +371,9 @@ namespace SurfaceGeometry {
 
 			if ( Surface( SurfNum ).Class != SurfaceClass_IntMass ) ProcessSurfaceVertices( SurfNum, ErrorsFound );
 		}
+#ifdef EP_Detailed_Timings
+		epStopTime( "ProcessSurfaceVertices=" );
+#endif
 
 		for ( auto & e : Zone ) {
 			e.ExtWindowArea = 0.0;
@@ -1054,9 +1071,23 @@ namespace SurfaceGeometry {
 
 		SurfaceWindow.allocate( TotSurfaces );
 
+#ifdef EP_Detailed_Timings
+		epStartTime( "GetSurfaceData:MatchSurfaces=" );
+#endif
+
+		// Surface names are resolved through hash maps rather than repeated FindItemInList searches.
+		// Only the first surface with a given name is entered, as FindItemInList would find it.
+		std::unordered_map< std::string, int > SurfaceNameIndex;
+
 		// add the "need to add" surfaces
 		//Debug    write(outputfiledebug,*) ' need to add ',NeedtoAddSurfaces+NeedToAddSubSurfaces
-		if ( NeedToAddSurfaces + NeedToAddSubSurfaces > 0 ) CurNewSurf = FirstTotalSurfaces;
+		if ( NeedToAddSurfaces + NeedToAddSubSurfaces > 0 ) {
+			CurNewSurf = FirstTotalSurfaces;
+			SurfaceNameIndex.reserve( TotSurfaces );
+			for ( SurfNum = 1; SurfNum <= FirstTotalSurfaces; ++SurfNum ) {
+				SurfaceNameIndex.emplace( SurfaceTmp( SurfNum ).Name, SurfNum );
+			}
+		}
 		for ( SurfNum = 1; SurfNum <= FirstTotalSurfaces; ++SurfNum ) {
 			if ( SurfaceTmp( SurfNum ).ExtBoundCond != UnenteredAdjacentZoneSurface ) continue;
 			// Need to add surface
@@ -1112,6 +1143,7 @@ namespace SurfaceGeometry {
 
 			// Change Name
 			SurfaceTmp( CurNewSurf ).Name = "iz-" + SurfaceTmp( SurfNum ).Name;
+			SurfaceNameIndex.emplace( SurfaceTmp( CurNewSurf ).Name, CurNewSurf );
 			//Debug   write(outputfiledebug,*) ' new surf name=',TRIM(SurfaceTmp(CurNewSurf)%Name)
 			//Debug   write(outputfiledebug,*) ' new surf in zone=',TRIM(surfacetmp(curnewsurf)%zoneName)
 			SurfaceTmp( CurNewSurf ).ExtBoundCond = UnreconciledZoneSurface;
@@ -1132,7 +1164,8 @@ namespace SurfaceGeometry {
 				//Debug        write(outputfiledebug,*) ' basesurf, extboundcondname=',TRIM(SurfaceTmp(CurNewSurf)%ExtBoundCondName)
 			} else {
 				// subsurface
-				Found = FindItemInList( "iz-" + SurfaceTmp( SurfNum ).BaseSurfName, SurfaceTmp, FirstTotalSurfaces + CurNewSurf - 1 );
+				auto const iName( SurfaceNameIndex.find( "iz-" + SurfaceTmp( SurfNum ).BaseSurfName ) );
+				Found = ( iName != SurfaceNameIndex.end() ) ? iName->second : 0;
 				if ( Found > 0 ) {
 					SurfaceTmp( CurNewSurf ).BaseSurfName = "iz-" + SurfaceTmp( SurfNum ).BaseSurfName;
 					SurfaceTmp( CurNewSurf ).BaseSurf = Found;
@@ -1162,6 +1195,11 @@ namespace SurfaceGeometry {
 		// After all of the surfaces have been defined then the base surfaces for the
 		// sub-surfaces can be defined.  Loop through surfaces and match with the sub-surface
 		// names.
+		SurfaceNameIndex.clear();
+		SurfaceNameIndex.reserve( TotSurfaces );
+		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+			SurfaceNameIndex.emplace( SurfaceTmp( SurfNum ).Name, SurfNum );
+		}
 		for ( SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
 			if ( ! SurfaceTmp( SurfNum ).HeatTransSurf ) continue;
 
@@ -1169,7 +1207,8 @@ namespace SurfaceGeometry {
 			if ( SameString( SurfaceTmp( SurfNum ).BaseSurfName, SurfaceTmp( SurfNum ).Name ) ) {
 				Found = SurfNum;
 			} else {
-				Found = FindItemInList( SurfaceTmp( SurfNum ).BaseSurfName, SurfaceTmp, TotSurfaces );
+				auto const iName( SurfaceNameIndex.find( SurfaceTmp( SurfNum ).BaseSurfName ) );
+				Found = ( iName != SurfaceNameIndex.end() ) ? iName->second : 0;
 			}
 			if ( Found > 0 ) {
 				SurfaceTmp( SurfNum ).BaseSurf = Found;
@@ -1203,6 +1242,13 @@ namespace SurfaceGeometry {
 		//      Internal Mass
 		//    After reordering, MovedSurfs should equal TotSurfaces
 
+		// Subsurfaces of each base surface, in input order, so each base surface does not scan all surfaces
+		std::vector< std::vector< int > > SubSurfaces( TotSurfaces + 1 );
+		for ( SubSurfNum = 1; SubSurfNum <= TotSurfaces; ++SubSurfNum ) {
+			BaseSurfNum = SurfaceTmp( SubSurfNum ).BaseSurf;
+			if ( ( SurfaceTmp( SubSurfNum ).Zone != 0 ) && ( BaseSurfNum > 0 ) && ( BaseSurfNum <= TotSurfaces ) ) SubSurfaces[ BaseSurfNum ].push_back( SubSurfNum );
+		}
+
 		MovedSurfs = 0;
 		Surface.allocate( TotSurfaces ); // Allocate the Surface derived type appropriately
 
@@ -1241,7 +1287,7 @@ namespace SurfaceGeometry {
 					Surface( MovedSurfs ).BaseSurf = BaseSurfNum;
 
 					//  Find all subsurfaces to this surface
-					for ( SubSurfNum = 1; SubSurfNum <= TotSurfaces; ++SubSurfNum ) {
+					for ( int const SubSurfNum : SubSurfaces[ SurfNum ] ) {
 
 						if ( SurfaceTmp( SubSurfNum ).Zone == 0 ) continue;
 						if ( SurfaceTmp( SubSurfNum ).BaseSurf != SurfNum ) continue;
@@ -1286,6 +1332,12 @@ namespace SurfaceGeometry {
 
 		SurfaceTmp.deallocate(); // DeAllocate the Temp Surface derived type
 
+		for ( auto & e : SubSurfaces ) e.clear();
+		for ( SubSurfNum = 1; SubSurfNum <= TotSurfaces; ++SubSurfNum ) {
+			BaseSurfNum = Surface( SubSurfNum ).BaseSurf;
+			if ( ( Surface( SubSurfNum ).Zone != 0 ) && ( BaseSurfNum > 0 ) && ( BaseSurfNum <= TotSurfaces ) ) SubSurfaces[ BaseSurfNum ].push_back( SubSurfNum );
+		}
+
 		//  For each Base Surface Type (Wall, Floor, Roof)
 
 		for ( Loop = 1; Loop <= 3; ++Loop ) {
@@ -1297,7 +1349,7 @@ namespace SurfaceGeometry {
 				if ( Surface( SurfNum ).Class != BaseSurfIDs( Loop ) ) continue;
 
 				//  Find all subsurfaces to this surface
-				for ( SubSurfNum = 1; SubSurfNum <= TotSurfaces; ++SubSurfNum ) {
+				for ( int const SubSurfNum : SubSurfaces[ SurfNum ] ) {
 
 					if ( SurfNum == SubSurfNum ) continue;
 					if ( Surface( SubSurfNum ).Zone == 0 ) continue;
@@ -1314,6 +1366,10 @@ namespace SurfaceGeometry {
 		// Now, match up interzone surfaces
 		NonMatch = false;
 		izConstDiffMsg = false;
+		SurfaceNameIndex.clear();
+		for ( SurfNum = 1; SurfNum <= MovedSurfs; ++SurfNum ) {
+			SurfaceNameIndex.emplace( Surface( SurfNum ).Name, SurfNum );
+		}
 		for ( SurfNum = 1; SurfNum <= MovedSurfs; ++SurfNum ) { //TotSurfaces
 			//  Clean up Shading Surfaces, make sure they don't go through here.
 			//  Shading surfaces have "Zone=0", should also have "BaseSurf=0"
@@ -1332,7 +1388,8 @@ namespace SurfaceGeometry {
 					if ( Surface( SurfNum ).ExtBoundCondName == Surface( SurfNum ).Name ) {
 						Found = SurfNum;
 					} else {
-						Found = FindItemInList( Surface( SurfNum ).ExtBoundCondName, Surface, MovedSurfs );
+						auto const iName( SurfaceNameIndex.find( Surface( SurfNum ).ExtBoundCondName ) );
+						Found = ( iName != SurfaceNameIndex.end() ) ? iName->second : 0;
 					}
 					if ( Found != 0 ) {
 						Surface( SurfNum ).ExtBoundCond = Found;
@@ -1560,6 +1617,9 @@ namespace SurfaceGeometry {
 		if ( NonMatch ) {
 			ShowSevereError( RoutineName + "Non matching interzone surfaces found" );
 		}
+#ifdef EP_Detailed_Timings
+		epStopTime( "GetSurfaceData:MatchSurfaces=" );
+#endif
 
 		//**********************************************************************************
 		// Warn about interzone surfaces that have adiabatic windows/vice versa
@@ -119,7 +119,25 @@ namespace EnergyPlus {
 				surfaces_.push_back( &surface );
 			}
 		}
+		initCube();
+	}
 
+	// Selected Surfaces Outer Cube Initilization
+	void
+	SurfaceOctreeCube::
+	init( Surfaces const & surfaces )
+	{
+		assert( d_ == 0u );
+		assert( n_ == 0u );
+		surfaces_ = surfaces;
+		initCube();
+	}
+
+	// Outer Cube Set Up for Assigned Surfaces
+	void
+	SurfaceOctreeCube::
+	initCube()
+	{
 		// No surfaces handler
 		if ( surfaces_.empty() ) {
 			l_ = u_ = c_ = Vertex( 0.0 );
@@ -262,5 +280,6 @@ namespace EnergyPlus {
 
 // Globals
 SurfaceOctreeCube surfaceOctree;
+SurfaceOctreeCube obstructionOctree;
 
 } // EnergyPlus
@@ -347,9 +347,9 @@ public: // Methods
 		return true;
 	}
 
-	// Ray Intersects Cube?
+	// Ray Intersects Cube? (Sets t to the distance along the ray to the entry point)
 	bool
-	rayIntersectsCube( Vertex const & a, Vertex const & dir, Vertex const & dir_inv ) const
+	rayIntersectsCube( Vertex const & a, Vertex const & dir, Vertex const & dir_inv, Real & t ) const
 	{
 		// Note: dir_inv coordinates corresponding to a zero dir coordinate are not used and can be set to zero
 
@@ -359,7 +359,10 @@ public: // Methods
 		assert( ( dir.z == 0.0 ) || ( std::abs( dir_inv.z - ( 1.0 / dir.z ) ) < 2 * std::numeric_limits< Real >::epsilon() * std::abs( dir_inv.z ) ) );
 
 		// Check if ray origin is in cube
-		if ( contains( a ) ) return true;
+		if ( contains( a ) ) {
+			t = 0.0;
+			return true;
+		}
 
 		// Refined Smits' method: Largest distance to 3 visible cube face planes along ray is the candidate entry point
 		Real tx, ty, tz; // Ray position parameter for intersections with box face planes
@@ -403,12 +406,21 @@ public: // Methods
 				Real const y( a.y + ( tmax * dir.y ) );
 				if ( ( y < l_.y ) || ( y > u_.y ) ) return false;
 			}
+			t = tmax;
 			return true;
 		} else { // Entry point is on backwards projection of ray
 			return false;
 		}
 	}
 
+	// Ray Intersects Cube?
+	bool
+	rayIntersectsCube( Vertex const & a, Vertex const & dir, Vertex const & dir_inv ) const
+	{
+		Real t; // Distance to entry point (unused)
+		return rayIntersectsCube( a, dir, dir_inv, t );
+	}
+
 	// Ray Intersects Cube?
 	bool
 	rayIntersectsCube( Vertex const & a, Vertex const & dir ) const
@@ -486,6 +498,10 @@ public: // Methods
 	void
 	init( ObjexxFCL::Array1< Surface > & surfaces );
 
+	// Selected Surfaces Outer Cube Initilization
+	void
+	init( Surfaces const & surfaces );
+
 	// Surfaces that Line Segment Intersects Cube's Enclosing Sphere
 	void
 	surfacesSegmentIntersectsSphere( Vertex const & a, Vertex const & b, Surfaces & surfaces ) const
@@ -635,6 +651,21 @@ public: // Methods
 		processSurfaceRayIntersectsCube( a, dir, safe_inverse( dir ), function ); // Inefficient if called in loop with same dir
 	}
 
+	// Process Surfaces in Cube that Ray Intersects Nearer than a Distance Limit with Function
+	//  Sub-cubes are visited nearest first and skipped if the ray enters them beyond tLimit,
+	//  which the function can reduce as it finds nearer hits (for closest hit searches)
+	//  dir must be a unit vector so that the entry points and tLimit are distances along the ray
+	template< typename Function >
+	void
+	processSurfaceRayIntersectsCubeNearest( Vertex const & a, Vertex const & dir, Vertex const & dir_inv, Real const & tLimit, Function const & function ) const
+	{
+		assert( std::abs( dir.mag_squared() - 1.0 ) < 4 * std::numeric_limits< Real >::epsilon() ); // Check unit vector
+		Real t; // Distance to entry point
+		if ( rayIntersectsCube( a, dir, dir_inv, t ) && ( t <= tLimit ) ) {
+			processSurfaceRayEntersCubeNearest( a, dir, dir_inv, tLimit, function );
+		}
+	}
+
 	// Process Surfaces in Cube that Ray Intersects Stopping if Predicate Satisfied
 	template< typename Predicate >
 	bool
@@ -686,6 +717,43 @@ private: // Methods
 		surfaces_.push_back( &surface );
 	}
 
+	// Process Surfaces in Cube that Ray Enters with Function: Sub-Cubes Nearest First Within Distance Limit
+	template< typename Function >
+	void
+	processSurfaceRayEntersCubeNearest( Vertex const & a, Vertex const & dir, Vertex const & dir_inv, Real const & tLimit, Function const & function ) const
+	{
+		for ( auto const * surface_p : surfaces_ ) { // Process this cube's surfaces
+			function( *surface_p );
+		}
+		if ( n_ == 0u ) return;
+
+		// Order the sub-cubes the ray enters by entry distance
+		SurfaceOctreeCube const * cubes[ 8 ];
+		Real ts[ 8 ];
+		std::uint8_t m( 0u );
+		for ( std::uint8_t i = 0; i < n_; ++i ) {
+			Real t; // Distance to entry point
+			if ( cubes_[ i ]->rayIntersectsCube( a, dir, dir_inv, t ) ) {
+				std::uint8_t k( m++ );
+				while ( ( k > 0u ) && ( ts[ k - 1 ] > t ) ) {
+					cubes[ k ] = cubes[ k - 1 ];
+					ts[ k ] = ts[ k - 1 ];
+					--k;
+				}
+				cubes[ k ] = cubes_[ i ];
+				ts[ k ] = t;
+			}
+		}
+		for ( std::uint8_t k = 0; k < m; ++k ) { // Recurse
+			if ( ts[ k ] > tLimit ) break; // This and later sub-cubes are entered beyond the limit
+			cubes[ k ]->processSurfaceRayEntersCubeNearest( a, dir, dir_inv, tLimit, function );
+		}
+	}
+
+	// Outer Cube Set Up for Assigned Surfaces
+	void
+	initCube();
+
 	// Branch to Sub-Tree
 	void
 	branch();
@@ -738,6 +806,7 @@ private: // Data
 
 // Globals
 extern SurfaceOctreeCube surfaceOctree;
+extern SurfaceOctreeCube obstructionOctree; // Surfaces that can be exterior obstructions
 
 } // EnergyPlus
 
@@ -317,9 +317,10 @@ namespace TARCOGCommon {
 		using namespace TARCOGParams;
 
 		// Locals
-		Array1D_int indx( n );
+		static Array1D_int indx;
 		Real64 d;
 
+		indx.dimension( n );
 		ludcmp( a, n, indx, d, nperr, ErrorMessage );
 
 		// Exit on error
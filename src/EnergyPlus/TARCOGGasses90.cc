@@ -59,6 +59,7 @@
 // C++ Headers
 #include <cassert>
 #include <cmath>
+#include <vector>
 
 // ObjexxFCL Headers
 #include <ObjexxFCL/Array1D.hh>
@@ -108,6 +109,70 @@ namespace TARCOGGasses90 {
 	// Data
 	//private doe2gas90
 
+	namespace {
+		// ISO 15099 mixture terms that depend only on the molecular weights of the gases in a
+		// mixture. They are kept for each distinct mixture met so far, so that the square and
+		// fourth roots are not re-evaluated for every gas pair on every GASSES90 call.
+		struct MixtureFactorData
+		{
+			// Members
+			int nmix; // Number of gases in the mixture
+			Array1D< Real64 > wght; // Molecular weights of the gases in the mixture
+			Array2D< Real64 > xpow; // Fourth root of molecular weight of gas j over that of gas i
+			Array2D< Real64 > downer; // Denominator of equation 61, 64 and 66
+			Array2D< Real64 > psiterm; // Bracketed term of equation 64
+
+			// Default Constructor
+			MixtureFactorData() :
+				nmix( 0 ),
+				wght( maxgas, 0.0 ),
+				xpow( maxgas, maxgas, 0.0 ),
+				downer( maxgas, maxgas, 0.0 ),
+				psiterm( maxgas, maxgas, 0.0 )
+			{}
+		};
+
+		std::vector< MixtureFactorData > MixtureFactors; // Factors for each mixture seen so far
+		std::vector< MixtureFactorData >::size_type const MaxMixtureFactors( 64 ); // Limit on the number of mixtures kept
+
+		MixtureFactorData const &
+		GetMixtureFactors(
+			Array1_int const & iprop,
+			int const nmix,
+			Array1< Real64 > const & xwght
+		)
+		{
+			static Real64 const two_sqrt_2( 2.0 * std::sqrt( 2.0 ) );
+
+			for ( auto const & factors : MixtureFactors ) {
+				if ( factors.nmix != nmix ) continue;
+				bool match( true );
+				for ( int i = 1; match && i <= nmix; ++i ) {
+					if ( factors.wght( i ) != xwght( iprop( i ) ) ) match = false;
+				}
+				if ( match ) return factors;
+			}
+
+			if ( MixtureFactors.size() >= MaxMixtureFactors ) MixtureFactors.clear();
+			MixtureFactors.emplace_back();
+			auto & factors( MixtureFactors.back() );
+			factors.nmix = nmix;
+			for ( int i = 1; i <= nmix; ++i ) {
+				factors.wght( i ) = xwght( iprop( i ) );
+			}
+			for ( int i = 1; i <= nmix; ++i ) {
+				Real64 const xwght_i( xwght( iprop( i ) ) );
+				for ( int j = 1; j <= nmix; ++j ) {
+					Real64 const xwght_j( xwght( iprop( j ) ) );
+					factors.xpow( i, j ) = root_4( xwght_j / xwght_i );
+					factors.downer( i, j ) = two_sqrt_2 * std::sqrt( 1.0 + ( xwght_i / xwght_j ) );
+					factors.psiterm( i, j ) = 1.0 + 2.41 * ( xwght_i - xwght_j ) * ( xwght_i - 0.142 * xwght_j ) / pow_2( xwght_i + xwght_j );
+				}
+			}
+			return factors;
+		}
+	}
+
 	// Functions
 
 	void
@@ -136,7 +201,6 @@ namespace TARCOGGasses90 {
 
 		// Locals
 
-		static Real64 const two_sqrt_2( 2.0 * std::sqrt( 2.0 ) );
 		static Array1D< Real64 > fvis( maxgas );
 		static Array1D< Real64 > fcon( maxgas );
 		static Array1D< Real64 > fdens( maxgas );
@@ -230,21 +294,20 @@ namespace TARCOGGasses90 {
 			}
 
 			if ( stdISO15099 ) {
+				auto const & mixFactors( GetMixtureFactors( iprop, nmix, xwght ) );
 				Real64 mumix( 0.0 );
 				Real64 kpmix( 0.0 );
 				Real64 kdpmix( 0.0 );
 				for ( int i = 1; i <= nmix; ++i ) {
 					Real64 const kprime_i( kprime( i ) );
-					Real64 const xwght_i( xwght( iprop( i ) ) );
 					for ( int j = 1; j <= nmix; ++j ) {
-						Real64 const xwght_j( xwght( iprop( j ) ) );
 
 						// numerator of equation 61
-						Real64 const x_pow( root_4( xwght_j / xwght_i ) );
+						Real64 const x_pow( mixFactors.xpow( i, j ) );
 						phimup = pow_2( 1.0 + std::sqrt( fvis( i ) / fvis( j ) ) * x_pow );
 
 						// denominator of equation 61, 64 and 66
-						downer = two_sqrt_2 * std::sqrt( 1.0 + ( xwght_i / xwght_j ) );
+						downer = mixFactors.downer( i, j );
 
 						// calculate the denominator of equation 60
 						if ( i != j ) mukpdwn( i ) += phimup / downer * frct( j ) / frct( i );
@@ -252,7 +315,7 @@ namespace TARCOGGasses90 {
 						// numerator of equation 64, psiterm is the multiplied term in brackets
 						psiup = pow_2( 1.0 + std::sqrt( kprime_i / kprime( j ) ) / x_pow );
 
-						psiterm = 1.0 + 2.41 * ( xwght_i - xwght_j ) * ( xwght_i - 0.142 * xwght_j ) / pow_2( xwght_i + xwght_j );
+						psiterm = mixFactors.psiterm( i, j );
 
 						// using the common denominator downer calculate the denominator for equation 63
 						if ( i != j ) kpdown( i ) += psiup * psiterm / downer * frct( j ) / frct( i );
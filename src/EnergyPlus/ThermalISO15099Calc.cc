@@ -998,8 +998,10 @@ namespace ThermalISO15099Calc {
 		//   3 - save in-between results (in all iterations) to existing debug file
 
 
-		Array2D< Real64 > a( 4*nlayer, 4*nlayer );
-		Array1D< Real64 > b( 4*nlayer );
+		// The work arrays sized by the number of layers are kept between calls and redimensioned
+		// below: they are reused while the number of layers is unchanged and reallocated when it changes
+		static Array2D< Real64 > a;
+		static Array1D< Real64 > b;
 		static Array1D< Real64 > hgas( maxlay1 );
 		//REAL(r64) :: hhatv(maxlay3),hcv(maxlay3), Ebgap(maxlay3), Tgap(maxlay1)
 		static Array1D< Real64 > Tgap( maxlay1 );
@@ -1010,30 +1012,27 @@ namespace ThermalISO15099Calc {
 		Real64 qr_gap_out;
 		Real64 qr_gap_in;
 
-		Array1D< Real64 > told( 2*nlayer );
+		static Array1D< Real64 > told;
 
 		// Simon: parameters used in case of JCFN iteration method
 		//REAL(r64) :: Dvector(maxlay4) ! store diagonal matrix used in JCFN iterations
-		Array1D< Real64 > FRes( {1,4*nlayer} ); // store function results from current iteration
-		Array1D< Real64 > FResOld( {1,4*nlayer} ); // store function results from previous iteration
-		Array1D< Real64 > FResDiff( {1,4*nlayer} ); // save difference in results between iterations
-		Array1D< Real64 > Radiation( {1,2*nlayer} ); // radiation on layer surfaces.  used as temporary storage during iterations
+		static Array1D< Real64 > FRes; // store function results from current iteration
+		static Array1D< Real64 > FResOld; // store function results from previous iteration
+		static Array1D< Real64 > FResDiff; // save difference in results between iterations
+		static Array1D< Real64 > Radiation; // radiation on layer surfaces.  used as temporary storage during iterations
 
-		Array1D< Real64 > x( {1,4*nlayer} ); // temporary vector for storing results (theta and Radiation).  used for easier handling
-		Array1D< Real64 > dX( {1,4*nlayer}, 0.0 ); // difference in results
-		Array2D< Real64 > Jacobian( {1,4*nlayer}, {1,4*nlayer} ); // diagonal vector for jacobian comuptation-free newton method
-		Array1D< Real64 > DRes( {1,4*nlayer} ); // used in jacobian forward-difference approximation
+		static Array1D< Real64 > x; // temporary vector for storing results (theta and Radiation).  used for easier handling
 
 		// This is used to store matrix before equation solver.  It is important because solver destroys
 		// content of matrices
-		Array2D< Real64 > LeftHandSide( {1,4*nlayer}, {1,4*nlayer} );
-		Array1D< Real64 > RightHandSide( {1,4*nlayer} );
+		static Array2D< Real64 > LeftHandSide;
+		static Array1D< Real64 > RightHandSide;
 
 		// Simon: Keep best achieved convergence
 		Real64 prevDifference;
 		Real64 Relaxation;
-		Array1D< Real64 > RadiationSave( {1,2*nlayer} );
-		Array1D< Real64 > thetaSave( {1,2*nlayer} );
+		static Array1D< Real64 > RadiationSave;
+		static Array1D< Real64 > thetaSave;
 		int currentTry;
 
 //		static Array1D_int LayerTypeSpec( maxlay ); //Unused
@@ -1062,6 +1061,19 @@ namespace ThermalISO15099Calc {
 
 		int SDLayerIndex = -1;
 
+		a.dimension( 4 * nlayer, 4 * nlayer );
+		b.dimension( 4 * nlayer );
+		told.dimension( 2 * nlayer );
+		FRes.dimension( 4 * nlayer );
+		FResOld.dimension( 4 * nlayer );
+		FResDiff.dimension( 4 * nlayer );
+		Radiation.dimension( 2 * nlayer );
+		x.dimension( 4 * nlayer );
+		LeftHandSide.dimension( 4 * nlayer, 4 * nlayer );
+		RightHandSide.dimension( 4 * nlayer );
+		RadiationSave.dimension( 2 * nlayer );
+		thetaSave.dimension( 2 * nlayer );
+
 		// Simon: This is set to zero until it is resolved what to do with modifier
 		ShadeHcModifiedOut = 0.0;
 		//BuffIndex = 0
@@ -1502,7 +1514,7 @@ namespace ThermalISO15099Calc {
 		Tgap.dim( maxlay1 );
 
 		// Locals
-		Array1D< Real64 > x( maxlay2 );
+		static Array1D< Real64 > x( maxlay2 );
 		Real64 delta;
 		int i;
 		int j;
@@ -1573,7 +1585,7 @@ namespace ThermalISO15099Calc {
 		//REAL(r64), intent(out) :: dtmax
 		//integer, intent(out) :: MaxIndex
 
-		Array1D< Real64 > told( maxlay2 );
+		static Array1D< Real64 > told( maxlay2 );
 		int i;
 		int j;
 
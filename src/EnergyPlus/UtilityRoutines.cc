@@ -107,6 +107,29 @@ namespace UtilityRoutines {
 	bool outputErrorHeader( true );
 }
 
+namespace {
+	// Recurring messages are searched for the MessageSearch strings when they are first stored; repeats of a
+	// stored message count the matches remembered then instead of searching the text again.
+	void
+	CountRecurringMessageSearches(
+		std::string const & Message, // Message as passed to the ShowRecurring routine
+		int const MsgIndex // Recurring message index, zero if not yet stored
+	)
+	{
+		using namespace DataErrorTracking;
+
+		if ( MsgIndex > 0 ) {
+			for ( int const Loop : RecurringErrors( MsgIndex ).SearchMatches ) {
+				++MatchCounts( Loop );
+			}
+		} else {
+			for ( int Loop = 1; Loop <= SearchCounts; ++Loop ) {
+				if ( has( Message, MessageSearch( Loop ) ) ) ++MatchCounts( Loop );
+			}
+		}
+	}
+}
+
 void
 AbortEnergyPlus()
 {
@@ -1330,14 +1353,47 @@ ShowRecurringSevereErrorAtEnd(
 	// na
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-	int Loop;
+	// na
 
-	for ( Loop = 1; Loop <= SearchCounts; ++Loop ) {
-		if ( has( Message, MessageSearch( Loop ) ) ) ++MatchCounts( Loop );
-	}
+	CountRecurringMessageSearches( Message, MsgIndex );
 
 	++TotalSevereErrors;
-	StoreRecurringErrorMessage( " ** Severe  ** " + Message, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
+	if ( MsgIndex > 0 ) { // repeat of a stored message, the text is not needed
+		StoreRecurringErrorMessage( Message, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
+	} else {
+		StoreRecurringErrorMessage( " ** Severe  ** " + Message, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
+	}
+
+}
+
+void
+ShowRecurringSevereErrorAtEnd(
+	std::function< std::string() > const & MessageBuilder, // Builds the message; only called when the message is first stored
+	int & MsgIndex, // Recurring message index, if zero, next available index is assigned
+	Optional< Real64 const > ReportMaxOf, // Track and report the max of the values passed to this argument
+	Optional< Real64 const > ReportMinOf, // Track and report the min of the values passed to this argument
+	Optional< Real64 const > ReportSumOf, // Track and report the sum of the values passed to this argument
+	std::string const & ReportMaxUnits, // optional char string (<=15 length) of units for max value
+	std::string const & ReportMinUnits, // optional char string (<=15 length) of units for min value
+	std::string const & ReportSumUnits // optional char string (<=15 length) of units for sum value
+)
+{
+
+	// SUBROUTINE INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   na
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS SUBROUTINE:
+	// Same as the message string version, for callers whose message is costly to build (concatenation,
+	// number formatting).  The message is only built the first time, when it is stored.
+
+	if ( MsgIndex > 0 ) {
+		ShowRecurringSevereErrorAtEnd( std::string(), MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
+	} else {
+		ShowRecurringSevereErrorAtEnd( MessageBuilder(), MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
+	}
 
 }
 
@@ -1390,14 +1446,47 @@ ShowRecurringWarningErrorAtEnd(
 	// na
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-	int Loop;
+	// na
 
-	for ( Loop = 1; Loop <= SearchCounts; ++Loop ) {
-		if ( has( Message, MessageSearch( Loop ) ) ) ++MatchCounts( Loop );
-	}
+	CountRecurringMessageSearches( Message, MsgIndex );
 
 	++TotalWarningErrors;
-	StoreRecurringErrorMessage( " ** Warning ** " + Message, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
+	if ( MsgIndex > 0 ) { // repeat of a stored message, the text is not needed
+		StoreRecurringErrorMessage( Message, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
+	} else {
+		StoreRecurringErrorMessage( " ** Warning ** " + Message, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
+	}
+
+}
+
+void
+ShowRecurringWarningErrorAtEnd(
+	std::function< std::string() > const & MessageBuilder, // Builds the message; only called when the message is first stored
+	int & MsgIndex, // Recurring message index, if zero, next available index is assigned
+	Optional< Real64 const > ReportMaxOf, // Track and report the max of the values passed to this argument
+	Optional< Real64 const > ReportMinOf, // Track and report the min of the values passed to this argument
+	Optional< Real64 const > ReportSumOf, // Track and report the sum of the values passed to this argument
+	std::string const & ReportMaxUnits, // optional char string (<=15 length) of units for max value
+	std::string const & ReportMinUnits, // optional char string (<=15 length) of units for min value
+	std::string const & ReportSumUnits // optional char string (<=15 length) of units for sum value
+)
+{
+
+	// SUBROUTINE INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   na
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS SUBROUTINE:
+	// Same as the message string version, for callers whose message is costly to build (concatenation,
+	// number formatting).  The message is only built the first time, when it is stored.
+
+	if ( MsgIndex > 0 ) {
+		ShowRecurringWarningErrorAtEnd( std::string(), MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
+	} else {
+		ShowRecurringWarningErrorAtEnd( MessageBuilder(), MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
+	}
 
 }
 
@@ -1450,13 +1539,46 @@ ShowRecurringContinueErrorAtEnd(
 	// na
 
 	// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
-	int Loop;
+	// na
 
-	for ( Loop = 1; Loop <= SearchCounts; ++Loop ) {
-		if ( has( Message, MessageSearch( Loop ) ) ) ++MatchCounts( Loop );
+	CountRecurringMessageSearches( Message, MsgIndex );
+
+	if ( MsgIndex > 0 ) { // repeat of a stored message, the text is not needed
+		StoreRecurringErrorMessage( Message, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
+	} else {
+		StoreRecurringErrorMessage( " **   ~~~   ** " + Message, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
 	}
 
-	StoreRecurringErrorMessage( " **   ~~~   ** " + Message, MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
+}
+
+void
+ShowRecurringContinueErrorAtEnd(
+	std::function< std::string() > const & MessageBuilder, // Builds the message; only called when the message is first stored
+	int & MsgIndex, // Recurring message index, if zero, next available index is assigned
+	Optional< Real64 const > ReportMaxOf, // Track and report the max of the values passed to this argument
+	Optional< Real64 const > ReportMinOf, // Track and report the min of the values passed to this argument
+	Optional< Real64 const > ReportSumOf, // Track and report the sum of the values passed to this argument
+	std::string const & ReportMaxUnits, // optional char string (<=15 length) of units for max value
+	std::string const & ReportMinUnits, // optional char string (<=15 length) of units for min value
+	std::string const & ReportSumUnits // optional char string (<=15 length) of units for sum value
+)
+{
+
+	// SUBROUTINE INFORMATION:
+	//       AUTHOR         na
+	//       DATE WRITTEN   na
+	//       MODIFIED       na
+	//       RE-ENGINEERED  na
+
+	// PURPOSE OF THIS SUBROUTINE:
+	// Same as the message string version, for callers whose message is costly to build (concatenation,
+	// number formatting).  The message is only built the first time, when it is stored.
+
+	if ( MsgIndex > 0 ) {
+		ShowRecurringContinueErrorAtEnd( std::string(), MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
+	} else {
+		ShowRecurringContinueErrorAtEnd( MessageBuilder(), MsgIndex, ReportMaxOf, ReportMinOf, ReportSumOf, ReportMaxUnits, ReportMinUnits, ReportSumUnits );
+	}
 
 }
 
@@ -1517,6 +1639,9 @@ StoreRecurringErrorMessage(
 		ErrorMsgIndex = NumRecurringErrors;
 		// The message string only needs to be stored once when a new recurring message is created
 		RecurringErrors( ErrorMsgIndex ).Message = ErrorMessage;
+		for ( int Loop = 1; Loop <= SearchCounts; ++Loop ) {
+			if ( has( ErrorMessage, MessageSearch( Loop ) ) ) RecurringErrors( ErrorMsgIndex ).SearchMatches.push_back( Loop );
+		}
 		RecurringErrors( ErrorMsgIndex ).Count = 1;
 		if ( WarmupFlag ) RecurringErrors( ErrorMsgIndex ).WarmupCount = 1;
 		if ( DoingSizing ) RecurringErrors( ErrorMsgIndex ).SizingCount = 1;
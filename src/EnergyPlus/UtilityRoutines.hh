@@ -59,6 +59,9 @@
 #ifndef UtilityRoutines_hh_INCLUDED
 #define UtilityRoutines_hh_INCLUDED
 
+// C++ Headers
+#include <functional>
+
 // ObjexxFCL Headers
 #include <ObjexxFCL/Optional.hh>
 
@@ -231,6 +234,18 @@ ShowRecurringSevereErrorAtEnd(
 	std::string const & ReportSumUnits = "" // optional char string (<=15 length) of units for sum value
 );
 
+void
+ShowRecurringSevereErrorAtEnd(
+	std::function< std::string() > const & MessageBuilder, // Builds the message; only called when the message is first stored
+	int & MsgIndex, // Recurring message index, if zero, next available index is assigned
+	Optional< Real64 const > ReportMaxOf = _, // Track and report the max of the values passed to this argument
+	Optional< Real64 const > ReportMinOf = _, // Track and report the min of the values passed to this argument
+	Optional< Real64 const > ReportSumOf = _, // Track and report the sum of the values passed to this argument
+	std::string const & ReportMaxUnits = "", // optional char string (<=15 length) of units for max value
+	std::string const & ReportMinUnits = "", // optional char string (<=15 length) of units for min value
+	std::string const & ReportSumUnits = "" // optional char string (<=15 length) of units for sum value
+);
+
 void
 ShowRecurringWarningErrorAtEnd(
 	std::string const & Message, // Message automatically written to "error file" at end of simulation
@@ -243,6 +258,18 @@ ShowRecurringWarningErrorAtEnd(
 	std::string const & ReportSumUnits = "" // optional char string (<=15 length) of units for sum value
 );
 
+void
+ShowRecurringWarningErrorAtEnd(
+	std::function< std::string() > const & MessageBuilder, // Builds the message; only called when the message is first stored
+	int & MsgIndex, // Recurring message index, if zero, next available index is assigned
+	Optional< Real64 const > ReportMaxOf = _, // Track and report the max of the values passed to this argument
+	Optional< Real64 const > ReportMinOf = _, // Track and report the min of the values passed to this argument
+	Optional< Real64 const > ReportSumOf = _, // Track and report the sum of the values passed to this argument
+	std::string const & ReportMaxUnits = "", // optional char string (<=15 length) of units for max value
+	std::string const & ReportMinUnits = "", // optional char string (<=15 length) of units for min value
+	std::string const & ReportSumUnits = "" // optional char string (<=15 length) of units for sum value
+);
+
 void
 ShowRecurringContinueErrorAtEnd(
 	std::string const & Message, // Message automatically written to "error file" at end of simulation
@@ -255,6 +282,18 @@ ShowRecurringContinueErrorAtEnd(
 	std::string const & ReportSumUnits = "" // optional char string (<=15 length) of units for sum value
 );
 
+void
+ShowRecurringContinueErrorAtEnd(
+	std::function< std::string() > const & MessageBuilder, // Builds the message; only called when the message is first stored
+	int & MsgIndex, // Recurring message index, if zero, next available index is assigned
+	Optional< Real64 const > ReportMaxOf = _, // Track and report the max of the values passed to this argument
+	Optional< Real64 const > ReportMinOf = _, // Track and report the min of the values passed to this argument
+	Optional< Real64 const > ReportSumOf = _, // Track and report the sum of the values passed to this argument
+	std::string const & ReportMaxUnits = "", // optional char string (<=15 length) of units for max value
+	std::string const & ReportMinUnits = "", // optional char string (<=15 length) of units for min value
+	std::string const & ReportSumUnits = "" // optional char string (<=15 length) of units for sum value
+);
+
 void
 StoreRecurringErrorMessage(
 	std::string const & ErrorMessage, // Message automatically written to "error file" at end of simulation
@@ -193,6 +193,9 @@ namespace WaterThermalTanks {
 	int const InletModeFixed( 1 ); // water heater only, inlet water always enters at the user-specified height
 	int const InletModeSeeking( 2 ); // water heater only, inlet water seeks out the node with the closest temperature
 
+	int const SolutionAlgorithmExplicit( 1 ); // stratified tank node temperatures advanced explicitly in one second substeps
+	int const SolutionAlgorithmImplicit( 2 ); // stratified tank node temperatures advanced implicitly between heater control events
+
 	// integer parameter for water heater
 	int const MixedWaterHeater( TypeOf_WtrHeaterMixed ); // WaterHeater:Mixed
 	int const StratifiedWaterHeater( TypeOf_WtrHeaterStratified ); // WaterHeater:Stratified
@@ -3006,6 +3009,18 @@ namespace WaterThermalTanks {
 						}
 					}
 
+					if ( ! lAlphaFieldBlanks( 23 ) ) {
+						{ auto const SELECT_CASE_var( cAlphaArgs( 23 ) );
+						if ( SELECT_CASE_var == "EXPLICIT" ) {
+							WaterThermalTank( WaterThermalTankNum ).SolutionAlgorithm = SolutionAlgorithmExplicit;
+						} else if ( SELECT_CASE_var == "IMPLICIT" ) {
+							WaterThermalTank( WaterThermalTankNum ).SolutionAlgorithm = SolutionAlgorithmImplicit;
+						} else {
+							ShowSevereError( cCurrentModuleObject + " = " + cAlphaArgs( 1 ) + ":  Invalid " + cAlphaFieldNames( 23 ) + " entered=" + cAlphaArgs( 23 ) );
+							ErrorsFound = true;
+						}}
+					}
+
 				} // WaterThermalTankNum
 
 				if ( ErrorsFound ) {
@@ -6208,6 +6223,9 @@ namespace WaterThermalTanks {
 		// node at a sub time step interval of one second.  Temperatures and energies change dynamically over the system
 		// time step.  Final node temperatures are reported as final instantaneous values as well as averages over the
 		// time step.  Heat transfer rates are averages over the time step.
+		// With the implicit solution algorithm the node heat balances are solved with the backward Euler method in steps
+		// of up to one minute.  A step ends early at the first heater control event, which is located by root finding on
+		// the implicit solution, so heater cycling no longer forces one second substeps.
 
 		// Using/Aliasing
 		using DataGlobals::TimeStep;
@@ -6217,12 +6235,15 @@ namespace WaterThermalTanks {
 		using DataHVACGlobals::TimeStepSys;
 		using FluidProperties::GetDensityGlycol;
 		using FluidProperties::GetSpecificHeatGlycol;
+		using General::SolveRoot;
+		using General::RootFinderMethod;
 
 		// Locals
 		// SUBROUTINE ARGUMENT DEFINITIONS:
 
 		// SUBROUTINE PARAMETER DEFINITIONS:
 		Real64 const dt( 1.0 ); // Sub time step interval (s)
+		Real64 const dtImplicitMax( 60.0 ); // Longest implicit step (s)
 		static std::string const RoutineName( "CalcWaterThermalTankStratified" );
 
 		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
@@ -6373,6 +6394,180 @@ namespace WaterThermalTanks {
 		if ( Tank.InletMode == InletModeFixed ) CalcNodeMassFlows( WaterThermalTankNum, InletModeFixed );
 
 		TimeRemaining = SecInTimeStep;
+		if ( Tank.SolutionAlgorithm == SolutionAlgorithmImplicit ) {
+			while ( TimeRemaining > 0.0 ) {
+
+				if ( Tank.InletMode == InletModeSeeking ) CalcNodeMassFlows( WaterThermalTankNum, InletModeSeeking );
+
+				// Control the heater elements on the node temperatures at the start of the step, as in the explicit solution
+				if ( ! Tank.IsChilledWaterTank ) {
+					if ( Tank.MaxCapacity > 0.0 ) {
+						NodeTemp = Tank.Node( Tank.HeaterNode1 ).Temp;
+						if ( Tank.HeaterOn1 ) {
+							if ( NodeTemp >= SetPointTemp1 ) {
+								Tank.HeaterOn1 = false;
+								SetPointRecovered = true;
+							}
+						} else if ( NodeTemp < MinTemp1 ) {
+							Tank.HeaterOn1 = true;
+							++CycleOnCount1;
+						}
+					}
+
+					if ( Tank.MaxCapacity2 > 0.0 ) {
+						if ( ( Tank.ControlType == PriorityMasterSlave ) && Tank.HeaterOn1 ) {
+							Tank.HeaterOn2 = false;
+						} else {
+							NodeTemp = Tank.Node( Tank.HeaterNode2 ).Temp;
+							if ( Tank.HeaterOn2 ) {
+								if ( NodeTemp >= SetPointTemp2 ) {
+									Tank.HeaterOn2 = false;
+									SetPointRecovered = true;
+								}
+							} else if ( NodeTemp < MinTemp2 ) {
+								Tank.HeaterOn2 = true;
+								++CycleOnCount2;
+							}
+						}
+					}
+				}
+
+				// Take the longest step allowed, then cut it back to the first heater control event.  Steps are never
+				// shorter than the explicit substep, so a heater that sits on its set point cannot stall the solution.
+				Real64 StepTime( min( TimeRemaining, dtImplicitMax ) );
+				CalcStratifiedTankImplicitStep( WaterThermalTankNum, StepTime, Cp, Qheatpump, HPWHCondenserConfig );
+				if ( ( ! Tank.IsChilledWaterTank ) && ( StepTime > dt ) ) {
+					Real64 EventTime( StepTime );
+					bool ResolveStep( false );
+					for ( int HeaterNum = 1; HeaterNum <= 2; ++HeaterNum ) {
+						bool HeaterOn;
+						int HeaterNode;
+						Real64 ControlTemp;
+						if ( HeaterNum == 1 ) {
+							if ( Tank.MaxCapacity <= 0.0 ) continue;
+							HeaterOn = Tank.HeaterOn1;
+							HeaterNode = Tank.HeaterNode1;
+							ControlTemp = HeaterOn ? SetPointTemp1 : MinTemp1;
+						} else {
+							if ( ( Tank.MaxCapacity2 <= 0.0 ) || ( ( Tank.ControlType == PriorityMasterSlave ) && Tank.HeaterOn1 ) ) continue;
+							HeaterOn = Tank.HeaterOn2;
+							HeaterNode = Tank.HeaterNode2;
+							ControlTemp = HeaterOn ? SetPointTemp2 : MinTemp2;
+						}
+						NodeTemp = Tank.Node( HeaterNode ).NewTemp;
+						if ( HeaterOn ? ( NodeTemp < ControlTemp ) : ( NodeTemp >= ControlTemp ) ) continue; // no event in this step
+
+						int SolFla; // Flag of solver
+						Real64 ControlTime; // Time at which the heater node reaches its control temperature (s)
+						SolveRoot( 0.001, 30, SolFla, ControlTime, [&]( Real64 const Time ) -> Real64 {
+							CalcStratifiedTankImplicitStep( WaterThermalTankNum, Time, Cp, Qheatpump, HPWHCondenserConfig );
+							return Tank.Node( HeaterNode ).NewTemp - ControlTemp;
+						}, dt, StepTime, RootFinderMethod::Illinois );
+						if ( SolFla == -2 ) ControlTime = dt; // control temperature is already crossed after one substep
+						EventTime = min( EventTime, max( ControlTime, dt ) );
+						ResolveStep = true;
+					}
+					if ( ResolveStep ) {
+						StepTime = EventTime;
+						CalcStratifiedTankImplicitStep( WaterThermalTankNum, StepTime, Cp, Qheatpump, HPWHCondenserConfig );
+					}
+				}
+
+				if ( ! Tank.IsChilledWaterTank ) {
+					if ( Tank.HeaterOn1 ) {
+						Qheater1 = Tank.MaxCapacity;
+						Runtime1 += StepTime;
+					} else {
+						Qheater1 = 0.0;
+					}
+					if ( Tank.HeaterOn2 ) {
+						Qheater2 = Tank.MaxCapacity2;
+						Runtime2 += StepTime;
+					} else {
+						Qheater2 = 0.0;
+					}
+				} else {
+					Qheater1 = 0.0;
+					Qheater2 = 0.0;
+				}
+
+				if ( Tank.HeaterOn1 || Tank.HeaterOn2 ) {
+					Runtime += StepTime;
+
+					Qfuel = ( Qheater1 + Qheater2 ) / Tank.Efficiency;
+					Qoncycfuel = Tank.OnCycParaLoad;
+					Qoffcycfuel = 0.0;
+				} else {
+					Qfuel = 0.0;
+					Qoncycfuel = 0.0;
+					Qoffcycfuel = Tank.OffCycParaLoad;
+				}
+
+				// Heat transfer rates at the end of the step, which close the energy balance of the implicit solution
+				for ( NodeNum = 1; NodeNum <= Tank.Nodes; ++NodeNum ) {
+					auto const & node( Tank.Node( NodeNum ) );
+					NodeTemp = node.NewTemp;
+
+					UseMassFlowRate = node.UseMassFlowRate * Tank.UseEffectiveness;
+					SourceMassFlowRate = node.SourceMassFlowRate * Tank.SourceEffectiveness;
+
+					Quse = UseMassFlowRate * Cp * ( UseInletTemp - NodeTemp );
+					if ( Tank.HeatPumpNum > 0 ) {
+						if ( HPWHCondenserConfig == TypeOf_HeatPumpWtrHeaterPumped ) {
+							Qsource = ( SourceMassFlowRate > 0.0 ) ? Qheatpump : 0.0;
+						} else {
+							Qsource = Qheatpump * node.HPWHWrappedCondenserHeatingFrac;
+						}
+					} else {
+						Qsource = SourceMassFlowRate * Cp * ( SourceInletTemp - NodeTemp );
+					}
+
+					if ( Tank.HeaterOn1 || Tank.HeaterOn2 ) {
+						Qloss = node.OnCycLossCoeff * ( AmbientTemp - NodeTemp );
+						Qoncycheat = node.OnCycParaLoad * Tank.OnCycParaFracToTank;
+						Qneeded = max( -Quse - Qsource - Qloss - Qoncycheat, 0.0 );
+					} else {
+						Qloss = node.OffCycLossCoeff * ( AmbientTemp - NodeTemp );
+						Qoffcycheat = node.OffCycParaLoad * Tank.OffCycParaFracToTank;
+						Qneeded = max( -Quse - Qsource - Qloss - Qoffcycheat, 0.0 );
+					}
+					Qlosszone = Qloss * Tank.SkinLossFracToZone;
+					Qunmet = max( Qneeded - Qheater1 - Qheater2, 0.0 );
+
+					Esource += Qsource * StepTime;
+					Eloss += Qloss * StepTime;
+					Elosszone += Qlosszone * StepTime;
+					Eneeded += Qneeded * StepTime;
+					Eunmet += Qunmet * StepTime;
+				}
+
+				if ( Tank.UseOutletStratNode > 0 ) {
+					Euse += Tank.UseMassFlowRate * Tank.UseEffectiveness * Cp * ( UseInletTemp - Tank.Node( Tank.UseOutletStratNode ).NewTemp ) * StepTime;
+				}
+
+				if ( ( ! Tank.IsChilledWaterTank ) && ( Tank.Node( 1 ).NewTemp > MaxTemp ) ) {
+					Event += Tank.Node( 1 ).Mass * Cp * ( MaxTemp - Tank.Node( 1 ).NewTemp );
+					Tank.Node( 1 ).NewTemp = MaxTemp;
+				}
+
+				// Calculation for standard ratings
+				if ( ! Tank.FirstRecoveryDone ) {
+					Tank.FirstRecoveryFuel += ( Qfuel + Qoffcycfuel + Qoncycfuel ) * StepTime;
+					if ( SetPointRecovered ) Tank.FirstRecoveryDone = true;
+				}
+
+				// Update node temperatures
+				for ( auto & e : Tank.Node ) {
+					e.Temp = e.NewTemp;
+					e.TempSum += e.Temp * StepTime;
+				}
+
+				TimeRemaining -= StepTime;
+
+			} // TimeRemaining > 0.0
+		}
+
+		// Explicit solution in one second substeps; the implicit solution has already used up the time step
 		while ( TimeRemaining > 0.0 ) {
 
 			if ( Tank.InletMode == InletModeSeeking ) CalcNodeMassFlows( WaterThermalTankNum, InletModeSeeking );
@@ -6664,6 +6859,128 @@ namespace WaterThermalTanks {
 
 	}
 
+	void
+	CalcStratifiedTankImplicitStep(
+		int const WaterThermalTankNum, // Water Heater being simulated
+		Real64 const StepTime, // Length of the implicit step (s)
+		Real64 const Cp, // Specific heat of water (J/kg K)
+		Real64 const Qheatpump, // Heating rate from the heat pump (W)
+		int const HPWHCondenserConfig // Condenser configuration of HPWH
+	)
+	{
+
+		// SUBROUTINE INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS SUBROUTINE:
+		// Advances the stratified tank node temperatures over one implicit step, from Node%Temp to Node%NewTemp.
+
+		// METHODOLOGY EMPLOYED:
+		// The node heat balances of CalcWaterThermalTankStratified are written with the node temperatures at the end
+		// of the step (backward Euler).  Vertical conduction, internode flow and inversion mixing only couple
+		// neighboring nodes, so the system is tridiagonal and is solved directly.  Inversion mixing is switched on
+		// between nodes that are inverted at the start of the step, and the system is solved again whenever the
+		// solution shows a new inversion, so a heated plume rises through the tank within one step as it does in
+		// the explicit substeps.  Heater states and flows are held over the step.
+
+		// Using/Aliasing
+		using General::SolveTridiagonal;
+
+		// SUBROUTINE LOCAL VARIABLE DECLARATIONS:
+		static Array1D< Real64 > A; // Coefficient of the upper node temperature (W/K)
+		static Array1D< Real64 > B; // Coefficient of the node temperature (W/K)
+		static Array1D< Real64 > C; // Coefficient of the lower node temperature (W/K)
+		static Array1D< Real64 > D; // Right hand side (W), then new node temperatures (C)
+		static Array1D< Real64 > W; // Scratch array for the tridiagonal solution
+		static Array1D_bool InvMix; // True if node and the node below it are mixed by a temperature inversion
+
+		// References
+		WaterThermalTankData & Tank = WaterThermalTank( WaterThermalTankNum ); // Tank object
+
+		int const Nodes( Tank.Nodes );
+		if ( A.isize() < Nodes ) {
+			A.allocate( Nodes );
+			B.allocate( Nodes );
+			C.allocate( Nodes );
+			D.allocate( Nodes );
+			W.allocate( Nodes );
+			InvMix.allocate( Nodes );
+		}
+
+		bool const HeaterOn( Tank.HeaterOn1 || Tank.HeaterOn2 );
+
+		for ( int NodeNum = 1; NodeNum < Nodes; ++NodeNum ) {
+			InvMix( NodeNum ) = ( Tank.Node( NodeNum + 1 ).Temp > Tank.Node( NodeNum ).Temp );
+		}
+		InvMix( Nodes ) = false;
+
+		bool NewInversion( true );
+		for ( int Iter = 1; NewInversion && ( Iter <= Nodes ); ++Iter ) {
+			for ( int NodeNum = 1; NodeNum <= Nodes; ++NodeNum ) {
+				auto const & node( Tank.Node( NodeNum ) );
+				Real64 const NodeTemp( node.Temp );
+
+				// Coupling with the upper and lower nodes through conduction, internode flow and inversion mixing
+				Real64 CoeffUp( 0.0 );
+				if ( NodeNum > 1 ) {
+					CoeffUp = node.CondCoeffUp + node.MassFlowFromUpper * Cp;
+					if ( InvMix( NodeNum - 1 ) ) CoeffUp += Tank.InversionMixingRate * Cp;
+				}
+				Real64 CoeffDn( 0.0 );
+				if ( NodeNum < Nodes ) {
+					CoeffDn = node.CondCoeffDn + node.MassFlowFromLower * Cp;
+					if ( InvMix( NodeNum ) ) CoeffDn += Tank.InversionMixingRate * Cp;
+				}
+
+				// Use and source side inlet flows, and losses to ambient
+				Real64 const UseCoeff( node.UseMassFlowRate * Tank.UseEffectiveness * Cp );
+				Real64 SourceCoeff( 0.0 );
+				Real64 const LossCoeff( HeaterOn ? node.OnCycLossCoeff : node.OffCycLossCoeff );
+
+				// Heat added independently of the node temperature: heaters, parasitics and heat pump condensers
+				Real64 Qheat( HeaterOn ? node.OnCycParaLoad * Tank.OnCycParaFracToTank : node.OffCycParaLoad * Tank.OffCycParaFracToTank );
+				if ( ! Tank.IsChilledWaterTank ) {
+					if ( Tank.HeaterOn1 && ( NodeNum == Tank.HeaterNode1 ) ) Qheat += Tank.MaxCapacity;
+					if ( Tank.HeaterOn2 && ( NodeNum == Tank.HeaterNode2 ) ) Qheat += Tank.MaxCapacity2;
+				}
+				if ( Tank.HeatPumpNum > 0 ) {
+					if ( HPWHCondenserConfig == TypeOf_HeatPumpWtrHeaterPumped ) {
+						if ( node.SourceMassFlowRate * Tank.SourceEffectiveness > 0.0 ) Qheat += Qheatpump;
+					} else {
+						Qheat += Qheatpump * node.HPWHWrappedCondenserHeatingFrac;
+					}
+				} else {
+					SourceCoeff = node.SourceMassFlowRate * Tank.SourceEffectiveness * Cp;
+				}
+
+				Real64 const Capacitance( node.Mass * Cp / StepTime );
+				A( NodeNum ) = -CoeffUp;
+				B( NodeNum ) = Capacitance + CoeffUp + CoeffDn + UseCoeff + SourceCoeff + LossCoeff;
+				C( NodeNum ) = -CoeffDn;
+				D( NodeNum ) = Capacitance * NodeTemp + UseCoeff * Tank.UseInletTemp + SourceCoeff * Tank.SourceInletTemp + LossCoeff * Tank.AmbientTemp + Qheat;
+			}
+
+			SolveTridiagonal( Nodes, A, B, C, D, W );
+
+			// Mix any nodes that became inverted during the step and solve again
+			NewInversion = false;
+			for ( int NodeNum = 1; NodeNum < Nodes; ++NodeNum ) {
+				if ( ( ! InvMix( NodeNum ) ) && ( D( NodeNum + 1 ) > D( NodeNum ) ) ) {
+					InvMix( NodeNum ) = true;
+					NewInversion = true;
+				}
+			}
+		} // Iter
+
+		for ( int NodeNum = 1; NodeNum <= Nodes; ++NodeNum ) {
+			Tank.Node( NodeNum ).NewTemp = D( NodeNum );
+		}
+
+	}
+
 	void
 	CalcNodeMassFlows(
 		int const WaterThermalTankNum, // Water Heater being simulated
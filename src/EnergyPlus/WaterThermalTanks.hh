@@ -108,6 +108,9 @@ namespace WaterThermalTanks {
 	extern int const InletModeFixed; // water heater only, inlet water always enters at the user-specified height
 	extern int const InletModeSeeking; // water heater only, inlet water seeks out the node with the closest temperature
 
+	extern int const SolutionAlgorithmExplicit; // stratified tank node temperatures advanced explicitly in one second substeps
+	extern int const SolutionAlgorithmImplicit; // stratified tank node temperatures advanced implicitly between heater control events
+
 	// integer parameter for water heater
 	extern int const MixedWaterHeater; // WaterHeater:Mixed
 	extern int const StratifiedWaterHeater; // WaterHeater:Stratified
@@ -415,6 +418,7 @@ namespace WaterThermalTanks {
 		int SourceInletStratNode; // Source-side inlet node number
 		int SourceOutletStratNode; // Source-side outlet node number
 		int InletMode; // Inlet position mode:  1 = FIXED; 2 = SEEKING
+		int SolutionAlgorithm; // Node temperature solution:  1 = EXPLICIT; 2 = IMPLICIT
 		Real64 InversionMixingRate;
 		Array1D< Real64 > AdditionalLossCoeff; // Loss coefficient added to the skin loss coefficient (W/m2-K)
 		int Nodes; // Number of nodes
@@ -595,6 +599,7 @@ namespace WaterThermalTanks {
 			SourceInletStratNode( 0 ),
 			SourceOutletStratNode( 0 ),
 			InletMode( 1 ),
+			SolutionAlgorithm( 1 ),
 			InversionMixingRate( 0.0 ),
 			Nodes( 0 ),
 			VolFlowRate( 0.0 ),
@@ -1127,6 +1132,15 @@ namespace WaterThermalTanks {
 		int const WaterThermalTankNum // Water Heater being simulated
 	);
 
+	void
+	CalcStratifiedTankImplicitStep(
+		int const WaterThermalTankNum, // Water Heater being simulated
+		Real64 const StepTime, // Length of the implicit step (s)
+		Real64 const Cp, // Specific heat of water (J/kg K)
+		Real64 const Qheatpump, // Heating rate from the heat pump (W)
+		int const HPWHCondenserConfig // Condenser configuration of HPWH
+	);
+
 	void
 	CalcNodeMassFlows(
 		int const WaterThermalTankNum, // Water Heater being simulated
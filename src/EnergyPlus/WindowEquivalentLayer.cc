@@ -4974,13 +4974,15 @@ namespace WindowEquivalentLayer {
 		// FUNCTION LOCAL VARIABLE DECLARATIONS:
 		Real64 ALPHA;
 		Real64 HCOCFout;
-		Array2D< Real64 > A( 3*FS.NL+4, 3*FS.NL+2 );
-		Array1D< Real64 > XSOL( 3*FS.NL+2 );
+		// The work arrays sized by the number of layers are kept between calls and redimensioned
+		// below: they are reused while the number of layers is unchanged and reallocated when it changes
+		static Array2D< Real64 > A;
+		static Array1D< Real64 > XSOL;
 		Real64 MAXERR;
-		Array1D< Real64 > TNEW( FS.NL ); // latest estimate of layer temperatures, K
-		Array1D< Real64 > EB( {0,FS.NL+1} ); // black emissive power by layer, W/m2
+		static Array1D< Real64 > TNEW; // latest estimate of layer temperatures, K
+		static Array1D< Real64 > EB; // black emissive power by layer, W/m2
 		//   EB( 0) = outdoor environment, EB( NL+1) = indoor environment
-		Array1D< Real64 > HHAT( {0,FS.NL} ); // convective heat transfer coefficient (W/m2.K4)
+		static Array1D< Real64 > HHAT; // convective heat transfer coefficient (W/m2.K4)
 		//   based on EB, NOT temperature difference
 		Real64 RHOF_ROOM; // effective longwave room-side properties
 		Real64 TAU_ROOM;
@@ -4988,7 +4990,7 @@ namespace WindowEquivalentLayer {
 		Real64 RHOB_OUT; // effective longwave outdoor environment properties
 		Real64 TAU_OUT;
 		Real64 EPSB_OUT;
-		Array1D< Real64 > QNET( FS.NL ); // checksum - net heat flux to a layer - should be zero - not needed
+		static Array1D< Real64 > QNET; // checksum - net heat flux to a layer - should be zero - not needed
 		int ADIM; // dimension of the A matrix
 		int CONVRG;
 		int NL;
@@ -4997,33 +4999,33 @@ namespace WindowEquivalentLayer {
 		int L;
 		int ITRY;
 		int hin_scheme; // flags different schemes for indoor convection coefficients
-		Array1D_int ISDL( {0,FS.NL+1} ); // Flag to mark diathermanous layers, 0=opaque
+		static Array1D_int ISDL; // Flag to mark diathermanous layers, 0=opaque
 		int NDLIAR; // Number of Diathermanous Layers In A Row (i.e., consecutive)
 		int IB; // Counter begin and end limits
 		int IE;
 		int IDV; // Integer dummy variable, general utility
 		int IM_ON( 1 ); // Turns on calculation of Indices of Merit if IM_ON=1
-		Array1D< Real64 > QOCF_F( FS.NL ); // heat flux to outdoor-facing surface of layer i, from gap i-1,
+		static Array1D< Real64 > QOCF_F; // heat flux to outdoor-facing surface of layer i, from gap i-1,
 		//   due to open channel flow, W/m2
-		Array1D< Real64 > QOCF_B( FS.NL ); // heat flux to indoor-facing surface of layer i, from gap i,
+		static Array1D< Real64 > QOCF_B; // heat flux to indoor-facing surface of layer i, from gap i,
 		//   due to open channel flow, W/m2
 		Real64 Rvalue; // R-value in IP units [hr.ft2.F/BTU]
 		Real64 TAE_IN; // Indoor and outdoor effective ambient temperatures [K]
 		Real64 TAE_OUT;
-		Array1D< Real64 > HR( {0,FS.NL} ); // Radiant heat transfer coefficient [W/m2K]
-		Array1D< Real64 > HJR( FS.NL ); // radiative and convective jump heat transfer coefficients
-		Array1D< Real64 > HJC( FS.NL );
+		static Array1D< Real64 > HR; // Radiant heat transfer coefficient [W/m2K]
+		static Array1D< Real64 > HJR; // radiative and convective jump heat transfer coefficients
+		static Array1D< Real64 > HJC;
 		Real64 FHR_OUT; // hre/(hre+hce) fraction radiant h, outdoor or indoor, used for TAE
 		Real64 FHR_IN;
 		Real64 Q_IN; // net gain to the room [W/m2], including transmitted solar
-		Array1D< Real64 > RHOF( {0,FS.NL+1} ); // longwave reflectance, front    !  these variables help simplify
-		Array1D< Real64 > RHOB( {0,FS.NL+1} ); // longwave reflectance, back     !  the code because it is useful to
-		Array1D< Real64 > EPSF( {0,FS.NL+1} ); // longwave emisivity,   front    !  increase the scope of the arrays
-		Array1D< Real64 > EPSB( {0,FS.NL+1} ); // longwave emisivity,   back     !  to include indoor and outdoor
-		Array1D< Real64 > TAU( {0,FS.NL+1} ); // longwave transmittance         !  nodes - more general
+		static Array1D< Real64 > RHOF; // longwave reflectance, front    !  these variables help simplify
+		static Array1D< Real64 > RHOB; // longwave reflectance, back     !  the code because it is useful to
+		static Array1D< Real64 > EPSF; // longwave emisivity,   front    !  increase the scope of the arrays
+		static Array1D< Real64 > EPSB; // longwave emisivity,   back     !  to include indoor and outdoor
+		static Array1D< Real64 > TAU; // longwave transmittance         !  nodes - more general
 		Real64 RTOT; // total resistance from TAE_OUT to TAE_IN [m2K/W]
-		Array2D< Real64 > HC2D( 6, 6 ); // convective heat transfer coefficients between layers i and j
-		Array2D< Real64 > HR2D( 6, 6 ); // radiant heat transfer coefficients between layers i and j
+		static Array2D< Real64 > HC2D( 6, 6 ); // convective heat transfer coefficients between layers i and j
+		static Array2D< Real64 > HR2D( 6, 6 ); // radiant heat transfer coefficients between layers i and j
 		Array1D< Real64 > HCIout( 6 ); // convective and radiant heat transfer coefficients between
 		Array1D< Real64 > HRIout( 6 );
 		// layer i and outdoor air or mean radiant temperature, resp.
@@ -5058,6 +5060,24 @@ namespace WindowEquivalentLayer {
 		NL = FS.NL; // working copy
 		if ( NL < 1 ) return ASHWAT_Thermal;
 
+		A.dimension( 3 * NL + 4, 3 * NL + 2 );
+		XSOL.dimension( 3 * NL + 2 );
+		TNEW.dimension( NL );
+		EB.dimension( {0,NL+1} );
+		HHAT.dimension( {0,NL} );
+		QNET.dimension( NL );
+		QOCF_F.dimension( NL );
+		QOCF_B.dimension( NL );
+		ISDL.dimension( {0,NL+1} );
+		HR.dimension( {0,NL} );
+		HJR.dimension( NL );
+		HJC.dimension( NL );
+		RHOF.dimension( {0,NL+1} );
+		RHOB.dimension( {0,NL+1} );
+		EPSF.dimension( {0,NL+1} );
+		EPSB.dimension( {0,NL+1} );
+		TAU.dimension( {0,NL+1} );
+
 		HCOCFout = HCOUT; // outdoor side
 
 		HHAT = 0.0;
@@ -262,6 +262,72 @@ namespace WindowManager {
 	Array1D< Real64 > rbvisPhi( 10, 0.0 ); // Glazing system visible back reflectance for each angle of incidence
 	Array1D< Real64 > CosPhiIndepVar( 10, 0.0 ); // Cos of incidence angles at 10-deg increments for curve fits
 
+	namespace {
+		// Temperature-independent factors of the gas mixture equations of ISO 15099 for one gap.
+		// They depend only on the molecular weights of the gases in the gap, so they are rebuilt
+		// when the gap fill changes rather than on every gas property evaluation.
+		struct GapMixtureFactorData
+		{
+			// Members
+			int NMix; // Number of gases the factors were built for (0 if not built)
+			Array1D< Real64 > Wght; // Molecular weights the factors were built for
+			Array1D< Real64 > KPrimeFac; // Factor on viscosity in eq. 67
+			Array2D< Real64 > WghtRatioRoot4; // Fourth root of the ratio of molecular weights of gases i and j
+			Array2D< Real64 > Downer; // Denominator of eq. 61, 64 and 66
+			Array2D< Real64 > PsiTerm; // Bracketed term of eq. 64
+
+			// Default Constructor
+			GapMixtureFactorData() :
+				NMix( 0 ),
+				Wght( 5, 0.0 ),
+				KPrimeFac( 5, 0.0 ),
+				WghtRatioRoot4( 5, 5, 0.0 ),
+				Downer( 5, 5, 0.0 ),
+				PsiTerm( 5, 5, 0.0 )
+			{}
+		};
+
+		Array1D< GapMixtureFactorData > GapMixtureFactors( 5 ); // Mixture factors for each gap
+
+		GapMixtureFactorData const &
+		GetGapMixtureFactors( int const IGap ) // Gap number
+		{
+			// Returns the mixture factors for the gas currently filling gap IGap, rebuilding
+			// them if the number of gases or any molecular weight differs from the last build.
+			// The expressions match those previously evaluated inline in WindowGasConductance.
+
+			Real64 const gaslaw( 8314.51 ); // Molar gas constant (J/kMol-K)
+			static Real64 const two_sqrt_2( 2.0 * std::sqrt( 2.0 ) );
+
+			auto & factors( GapMixtureFactors( IGap ) );
+			int const NMix( gnmix( IGap ) );
+
+			bool current( factors.NMix == NMix );
+			for ( int i = 1; current && i <= NMix; ++i ) {
+				if ( factors.Wght( i ) != gwght( i, IGap ) ) current = false;
+			}
+			if ( current ) return factors;
+
+			factors.NMix = NMix;
+			for ( int i = 1; i <= NMix; ++i ) {
+				factors.Wght( i ) = gwght( i, IGap );
+				if ( i == 1 ) {
+					factors.KPrimeFac( i ) = 3.75 * ( gaslaw / gwght( i, IGap ) ); // eq. 67
+				} else {
+					factors.KPrimeFac( i ) = 3.75 * gaslaw / gwght( i, IGap ); // eq. 67
+				}
+			}
+			for ( int i = 1; i <= NMix; ++i ) {
+				for ( int j = 1; j <= NMix; ++j ) {
+					factors.WghtRatioRoot4( i, j ) = root_4( gwght( i, IGap ) / gwght( j, IGap ) );
+					factors.Downer( i, j ) = two_sqrt_2 * std::sqrt( 1 + ( gwght( i, IGap ) / gwght( j, IGap ) ) );
+					factors.PsiTerm( i, j ) = 1.0 + 2.41 * ( gwght( i, IGap ) - gwght( j, IGap ) ) * ( gwght( i, IGap ) - 0.142 * gwght( j, IGap ) ) / pow_2( gwght( i, IGap ) + gwght( j, IGap ) );
+				}
+			}
+			return factors;
+		}
+	}
+
 	// SUBROUTINE SPECIFICATIONS FOR MODULE WindowManager:
 	//   Optical Calculation Routines
 	//   Heat Balance Routines
@@ -363,6 +429,7 @@ namespace WindowManager {
 		rfvisPhi = Array1D< Real64 >( 10, 0.0 );
 		rbvisPhi = Array1D< Real64 >( 10, 0.0 );
 		CosPhiIndepVar = Array1D< Real64 >( 10, 0.0 );
+		GapMixtureFactors = Array1D< GapMixtureFactorData >( 5 );
 	}
 
 	void
@@ -4572,7 +4639,6 @@ namespace WindowManager {
 		// SUBROUTINE PARAMETER DEFINITIONS:
 		Real64 const pres( 1.0e5 ); // Gap gas pressure (Pa)
 		Real64 const gaslaw( 8314.51 ); // Molar gas constant (J/kMol-K)
-		static Real64 const two_sqrt_2( 2.0 * std::sqrt( 2.0 ) );
 
 		// INTERFACE BLOCK SPECIFICATIONS:
 		// na
@@ -4634,9 +4700,10 @@ namespace WindowManager {
 			cp = fcp( 1 );
 			dens = fdens( 1 );
 		} else if ( NMix > 1 ) { // Multiple gases; calculate mixture properties
+			auto const & mixFactors( GetGapMixtureFactors( IGap ) );
 			molmix = frct( 1 ) * gwght( 1, IGap ); // initialize eq. 56
 			cpmixm = molmix * fcp( 1 ); // initialize eq. 58
-			kprime( 1 ) = 3.75 * ( gaslaw / gwght( 1, IGap ) ) * fvis( 1 ); // eq. 67
+			kprime( 1 ) = mixFactors.KPrimeFac( 1 ) * fvis( 1 ); // eq. 67
 			kdblprm( 1 ) = fcon( 1 ) - kprime( 1 ); // eq. 67
 
 			// Initialize summations for eqns 60-66
@@ -4655,7 +4722,7 @@ namespace WindowManager {
 				fdens( i ) = pres * gwght( i, IGap ) / ( gaslaw * tmean );
 				molmix += frct( i ) * gwght( i, IGap ); // eq. 56
 				cpmixm += frct( i ) * fcp( i ) * gwght( i, IGap ); // eq. 58-59
-				kprime( i ) = 3.75 * gaslaw / gwght( i, IGap ) * fvis( i ); // eq. 67
+				kprime( i ) = mixFactors.KPrimeFac( i ) * fvis( i ); // eq. 67
 				kdblprm( i ) = fcon( i ) - kprime( i ); // eq. 68
 				mukpdwn( i ) = 1.0; // initialize denomonator of eq. 60
 				kpdown( i ) = 1.0; // initialize denomonator of eq. 63
@@ -4665,18 +4732,18 @@ namespace WindowManager {
 			for ( i = 1; i <= NMix; ++i ) {
 				for ( j = 1; j <= NMix; ++j ) {
 					// numerator of equation 61
-					phimup = pow_2( 1.0 + std::sqrt( fvis( i ) / fvis( j ) ) * root_4( gwght( j, IGap ) / gwght( i, IGap ) ) );
+					phimup = pow_2( 1.0 + std::sqrt( fvis( i ) / fvis( j ) ) * mixFactors.WghtRatioRoot4( j, i ) );
 					// denomonator of eq. 61, 64 and 66
-					downer = two_sqrt_2 * std::sqrt( 1 + ( gwght( i, IGap ) / gwght( j, IGap ) ) );
+					downer = mixFactors.Downer( i, j );
 					// calculate the denominator of eq. 60
 					if ( i != j ) mukpdwn( i ) += phimup / downer * frct( j ) / frct( i );
 					// numerator of eq. 64; psiterm is the multiplied term in backets
-					psiup = pow_2( 1.0 + std::sqrt( kprime( i ) / kprime( j ) ) * root_4( gwght( i, IGap ) / gwght( j, IGap ) ) );
-					psiterm = 1.0 + 2.41 * ( gwght( i, IGap ) - gwght( j, IGap ) ) * ( gwght( i, IGap ) - 0.142 * gwght( j, IGap ) ) / pow_2( gwght( i, IGap ) + gwght( j, IGap ) );
+					psiup = pow_2( 1.0 + std::sqrt( kprime( i ) / kprime( j ) ) * mixFactors.WghtRatioRoot4( i, j ) );
+					psiterm = mixFactors.PsiTerm( i, j );
 					// using the common denominator, downer, calculate the denominator for eq. 63
 					if ( i != j ) kpdown( i ) += psiup * ( psiterm / downer ) * ( frct( j ) / frct( i ) );
-					// calculate the numerator of eq. 66
-					phikup = pow_2( 1.0 + std::sqrt( kprime( i ) / kprime( j ) ) * root_4( gwght( i, IGap ) / gwght( j, IGap ) ) );
+					// calculate the numerator of eq. 66 (same expression as the numerator of eq. 64)
+					phikup = psiup;
 					// using the common denominator, downer, calculate the denomonator for eq. 65
 					if ( i != j ) kdpdown( i ) += ( phikup / downer ) * ( frct( j ) / frct( i ) );
 				}
@@ -4741,7 +4808,6 @@ namespace WindowManager {
 		// SUBROUTINE PARAMETER DEFINITIONS:
 		Real64 const pres( 1.0e5 ); // Gap gas pressure (Pa)
 		Real64 const gaslaw( 8314.51 ); // Molar gas constant (J/kMol-K)
-		static Real64 const two_sqrt_2( 2.0 * std::sqrt( 2.0 ) );
 
 		// INTERFACE BLOCK SPECIFICATIONS:
 		// na
@@ -4778,6 +4844,7 @@ namespace WindowManager {
 			visc = fvis( 1 );
 			dens = fdens( 1 );
 		} else { // Multiple gases; calculate mixture properties
+			auto const & mixFactors( GetGapMixtureFactors( IGap ) );
 			molmix = frct( 1 ) * gwght( 1, IGap ); // initialize eq. 56
 
 			// Initialize summations for eqns 60-66
@@ -4795,9 +4862,9 @@ namespace WindowManager {
 			for ( i = 1; i <= NMix; ++i ) {
 				for ( j = 1; j <= NMix; ++j ) {
 					// numerator of equation 61
-					phimup = pow_2( 1.0 + std::sqrt( fvis( i ) / fvis( j ) ) * root_4( gwght( j, IGap ) / gwght( i, IGap ) ) );
+					phimup = pow_2( 1.0 + std::sqrt( fvis( i ) / fvis( j ) ) * mixFactors.WghtRatioRoot4( j, i ) );
 					// denomonator of eq. 61, 64 and 66
-					downer = two_sqrt_2 * std::sqrt( 1 + ( gwght( i, IGap ) / gwght( j, IGap ) ) );
+					downer = mixFactors.Downer( i, j );
 					// calculate the denominator of eq. 60
 					if ( i != j ) mukpdwn( i ) += phimup / downer * frct( j ) / frct( i );
 				}
@@ -4053,6 +4053,103 @@ namespace ZoneTempPredictorCorrector {
 
 	}
 
+	Real64
+	ZoneTempTruncationError(
+		Real64 const ZoneTemp, // zone air temperature at the end of the zone timestep
+		Real64 const ZoneTempM1, // zone air temperature at timestep T-1
+		Real64 const ZoneTempM2, // zone air temperature at timestep T-2
+		Real64 const ZoneTempM3, // zone air temperature at timestep T-3
+		Real64 const ZoneTempM4 // zone air temperature at timestep T-4
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Estimate the local truncation error of the zone air temperature solution over one zone timestep.
+
+		// METHODOLOGY EMPLOYED:
+		// The leading error term of the third order backward difference is 3/22 h^4 d4T/dt4, and of the
+		// Euler method h^2/2 d2T/dt2; h^n times the derivative is replaced by the n-th difference of the
+		// zone timestep history. The analytical solution is treated as first order since its
+		// coefficients are lagged.
+
+		if ( ZoneAirSolutionAlgo == Use3rdOrder ) {
+			return ( 3.0 / 22.0 ) * std::abs( ZoneTemp - 4.0 * ZoneTempM1 + 6.0 * ZoneTempM2 - 4.0 * ZoneTempM3 + ZoneTempM4 );
+		} else {
+			return 0.5 * std::abs( ZoneTemp - 2.0 * ZoneTempM1 + ZoneTempM2 );
+		}
+
+	}
+
+	Real64
+	MaxZoneTempTruncationError()
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Largest estimated zone air temperature truncation error over all zones, used by HVACManager
+		// to choose the system timestep. Only meaningful after the correct step of a full zone timestep,
+		// while the zone timestep history is still in XMAT..XM4T.
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		int ZoneNum;
+		Real64 MaxError( 0.0 );
+
+		for ( ZoneNum = 1; ZoneNum <= NumOfZones; ++ZoneNum ) {
+			if ( ( IsZoneDV( ZoneNum ) && ZoneDVMixedFlag( ZoneNum ) == 0 ) || ( IsZoneUI( ZoneNum ) && ZoneUFMixedFlag( ZoneNum ) == 0 ) ) {
+				MaxError = max( MaxError, ZoneTempTruncationError( ZTOC( ZoneNum ), XMATOC( ZoneNum ), XM2TOC( ZoneNum ), XM3TOC( ZoneNum ), XM4TOC( ZoneNum ) ) );
+				MaxError = max( MaxError, ZoneTempTruncationError( ZTMX( ZoneNum ), XMATMX( ZoneNum ), XM2TMX( ZoneNum ), XM3TMX( ZoneNum ), XM4TMX( ZoneNum ) ) );
+			} else {
+				MaxError = max( MaxError, ZoneTempTruncationError( ZT( ZoneNum ), XMAT( ZoneNum ), XM2T( ZoneNum ), XM3T( ZoneNum ), XM4T( ZoneNum ) ) );
+			}
+		}
+
+		return MaxError;
+
+	}
+
+	int
+	NumSysStepsForTruncationError(
+		Real64 const TruncationError, // estimated zone air temperature error over one zone timestep [C]
+		Real64 const Tolerance // allowed error over one zone timestep [C]
+	)
+	{
+
+		// FUNCTION INFORMATION:
+		//       AUTHOR         na
+		//       DATE WRITTEN   na
+		//       MODIFIED       na
+		//       RE-ENGINEERED  na
+
+		// PURPOSE OF THIS FUNCTION:
+		// Number of system timesteps per zone timestep needed to bring the truncation error within Tolerance.
+
+		// METHODOLOGY EMPLOYED:
+		// For a method of order p the error of one step scales with h^(p+1), so splitting the zone
+		// timestep into N steps scales the accumulated error by N^-p.
+
+		// FUNCTION PARAMETER DEFINITIONS:
+		Real64 const SmallRatio( 1.0e-9 ); // keeps exact powers from rounding up to the next count
+
+		// FUNCTION LOCAL VARIABLE DECLARATIONS:
+		Real64 Order;
+
+		if ( Tolerance <= 0.0 || TruncationError <= Tolerance ) return 1;
+		Order = ( ZoneAirSolutionAlgo == Use3rdOrder ) ? 3.0 : 1.0;
+		return int( std::ceil( std::pow( TruncationError / Tolerance, 1.0 / Order ) - SmallRatio ) );
+
+	}
+
 	void
 	PushZoneTimestepHistories()
 	{
@@ -251,6 +251,24 @@ namespace ZoneTempPredictorCorrector {
 		Real64 const PriorTimeStep // the old value for timestep length is passed for possible use in interpolating
 	);
 
+	Real64
+	ZoneTempTruncationError(
+		Real64 const ZoneTemp, // zone air temperature at the end of the zone timestep
+		Real64 const ZoneTempM1, // zone air temperature at timestep T-1
+		Real64 const ZoneTempM2, // zone air temperature at timestep T-2
+		Real64 const ZoneTempM3, // zone air temperature at timestep T-3
+		Real64 const ZoneTempM4 // zone air temperature at timestep T-4
+	);
+
+	Real64
+	MaxZoneTempTruncationError();
+
+	int
+	NumSysStepsForTruncationError(
+		Real64 const TruncationError, // estimated zone air temperature error over one zone timestep [C]
+		Real64 const Tolerance // allowed error over one zone timestep [C]
+	);
+
 	void
 	PushZoneTimestepHistories();
 
@@ -65,6 +65,9 @@
 
 // EnergyPlus Headers
 #include <ConvectionCoefficients.hh>
+#include <DataHeatBalance.hh>
+#include <DataHeatBalFanSys.hh>
+#include <DataSurfaces.hh>
 #include <EnergyPlus/UtilityRoutines.hh>
 
 #include "Fixtures/EnergyPlusFixture.hh"
@@ -110,4 +113,41 @@ TEST_F( EnergyPlusFixture, ConvectionCoefficientsTest_ConvectionCofficients )
 
 }
 
+TEST_F( EnergyPlusFixture, ConvectionCoefficientsTest_GroupedTARPMatchesSingleSurface )
+{
+
+	int const NumSurfs( 4 );
+	DataSurfaces::TotSurfaces = NumSurfs;
+	DataSurfaces::Surface.allocate( NumSurfs );
+	DataHeatBalance::HConvIn.allocate( NumSurfs );
+	DataHeatBalFanSys::MAT.allocate( 1 );
+	DataHeatBalFanSys::MAT( 1 ) = 20.0;
+
+	Array1D< Real64 > SurfTemps( NumSurfs );
+	Array1D< Real64 > const CosTilts( { 0.0, 1.0, -1.0, 0.5 } );
+	SurfTemps = { 22.0, 18.0, 23.0, 20.0 };
+	for ( int SurfNum = 1; SurfNum <= NumSurfs; ++SurfNum ) {
+		DataSurfaces::Surface( SurfNum ).Zone = 1;
+		DataSurfaces::Surface( SurfNum ).CosTilt = CosTilts( SurfNum );
+	}
+
+	Array1D< Real64 > HcSingle( NumSurfs );
+	for ( int SurfNum = 1; SurfNum <= NumSurfs; ++SurfNum ) {
+		CalcASHRAEDetailedIntConvCoeff( SurfNum, SurfTemps( SurfNum ), DataHeatBalFanSys::MAT( 1 ) );
+		HcSingle( SurfNum ) = DataHeatBalance::HConvIn( SurfNum );
+	}
+
+	DataHeatBalance::HConvIn = 0.0;
+	DataSurfaces::Surface( 4 ).EMSOverrideIntConvCoef = true;
+	DataSurfaces::Surface( 4 ).EMSValueForIntConvCoef = 7.5;
+	TARPIntConvSurfs = { 1, 2, 3, 4 };
+	CalcASHRAEDetailedIntConvCoeffs( SurfTemps );
+
+	for ( int SurfNum = 1; SurfNum <= 3; ++SurfNum ) {
+		EXPECT_DOUBLE_EQ( HcSingle( SurfNum ), DataHeatBalance::HConvIn( SurfNum ) );
+	}
+	EXPECT_DOUBLE_EQ( 7.5, DataHeatBalance::HConvIn( 4 ) );
+
+	TARPIntConvSurfs.clear();
 
+}
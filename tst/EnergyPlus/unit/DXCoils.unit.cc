@@ -69,6 +69,7 @@
 #include <DataAirLoop.hh>
 #include <DataAirSystems.hh>
 #include <DataSizing.hh>
+#include <DataSystemVariables.hh>
 #include <DataEnvironment.hh>
 #include <DataHeatBalance.hh>
 #include <OutputReportPredefined.hh>
@@ -1459,4 +1460,202 @@ namespace EnergyPlus {
 
 	}
 
+	TEST_F( EnergyPlusFixture, DXCoil_PerformanceMemo )
+	{
+		NumDXCoils = 1;
+		DXCoil.allocate( NumDXCoils );
+
+		// nothing remembered yet
+		DXCoilPerfMemoData Memo( 1, 20000.0, 0.1, 26.7, 19.4, 35.0, 1.0, 1.2, 101325.0 );
+		EXPECT_FALSE( FindDXCoilPerfMemo( 1, Memo ) );
+		EXPECT_EQ( 0, DXCoil( 1 ).PerfMemoHits );
+		EXPECT_EQ( 1, DXCoil( 1 ).PerfMemoMisses );
+
+		Memo.TotCap = 19000.0;
+		Memo.SHR = 0.75;
+		SaveDXCoilPerfMemo( 1, Memo );
+
+		// same operating point is found and its results returned
+		DXCoilPerfMemoData Lookup( 1, 20000.0, 0.1, 26.7, 19.4, 35.0, 1.0, 1.2, 101325.0 );
+		EXPECT_TRUE( FindDXCoilPerfMemo( 1, Lookup ) );
+		EXPECT_DOUBLE_EQ( 19000.0, Lookup.TotCap );
+		EXPECT_DOUBLE_EQ( 0.75, Lookup.SHR );
+		EXPECT_DOUBLE_EQ( 19.4, Lookup.DryCoilWetBulb );
+		EXPECT_EQ( 1, DXCoil( 1 ).PerfMemoHits );
+
+		// other mode or slightly different conditions are not matched with the default (exact) tolerance
+		Lookup = DXCoilPerfMemoData( 2, 20000.0, 0.1, 26.7, 19.4, 35.0, 1.0, 1.2, 101325.0 );
+		EXPECT_FALSE( FindDXCoilPerfMemo( 1, Lookup ) );
+		Lookup = DXCoilPerfMemoData( 1, 20000.0, 0.1, 26.7, 19.405, 35.0, 1.0, 1.2, 101325.0 );
+		EXPECT_FALSE( FindDXCoilPerfMemo( 1, Lookup ) );
+
+		// within the tolerance it is matched, and a wet coil uses the actual wet-bulb
+		Real64 const SaveDXCoilMemoTolerance( DataSystemVariables::DXCoilMemoTolerance );
+		DataSystemVariables::DXCoilMemoTolerance = 0.01;
+		EXPECT_TRUE( FindDXCoilPerfMemo( 1, Lookup ) );
+		EXPECT_DOUBLE_EQ( 19000.0, Lookup.TotCap );
+		EXPECT_DOUBLE_EQ( 19.405, Lookup.DryCoilWetBulb );
+		Lookup = DXCoilPerfMemoData( 1, 20000.0, 0.1, 26.7, 19.4, 35.0, 1.0, 1.25, 101325.0 );
+		EXPECT_FALSE( FindDXCoilPerfMemo( 1, Lookup ) );
+		DataSystemVariables::DXCoilMemoTolerance = SaveDXCoilMemoTolerance;
+
+		// the oldest point is replaced once the memo is full
+		for ( int Point = 1; Point <= DXCoilPerfMemoSize; ++Point ) {
+			Memo = DXCoilPerfMemoData( 1, 20000.0, 0.1, 26.7, 19.4, 35.0 + Point, 1.0, 1.2, 101325.0 );
+			SaveDXCoilPerfMemo( 1, Memo );
+		}
+		Lookup = DXCoilPerfMemoData( 1, 20000.0, 0.1, 26.7, 19.4, 35.0, 1.0, 1.2, 101325.0 );
+		EXPECT_FALSE( FindDXCoilPerfMemo( 1, Lookup ) );
+		Lookup = DXCoilPerfMemoData( 1, 20000.0, 0.1, 26.7, 19.4, 35.0 + DXCoilPerfMemoSize, 1.0, 1.2, 101325.0 );
+		EXPECT_TRUE( FindDXCoilPerfMemo( 1, Lookup ) );
+
+		EXPECT_EQ( 3, DXCoil( 1 ).PerfMemoHits );
+		EXPECT_EQ( 5, DXCoil( 1 ).PerfMemoMisses );
+	}
+
+	TEST_F( EnergyPlusFixture, DXCoil_PerformanceMemoCalcDoe2DXCoil )
+	{
+		using Psychrometrics::PsyHFnTdbW;
+		using Psychrometrics::PsyRhoAirFnPbTdbW;
+		using Psychrometrics::PsyTwbFnTdbWPb;
+
+		std::string const idf_objects = delimited_string( {
+			"Version,8.4;",
+			"Curve:Biquadratic,",
+			"	WindACCoolCapFT, !- Name",
+			"	0.942587793,     !- Coefficient1 Constant",
+			"	0.009543347,     !- Coefficient2 x",
+			"	0.000683770,     !- Coefficient3 x**2",
+			"	-0.011042676,    !- Coefficient4 y",
+			"	0.000005249,     !- Coefficient5 y**2",
+			"	-0.000009720,    !- Coefficient6 x*y",
+			"	12.77778,        !- Minimum Value of x",
+			"	23.88889,        !- Maximum Value of x",
+			"	18.0,            !- Minimum Value of y",
+			"	46.11111,        !- Maximum Value of y",
+			"	,                !- Minimum Curve Output",
+			"	,                !- Maximum Curve Output",
+			"	Temperature,     !- Input Unit Type for X",
+			"	Temperature,     !- Input Unit Type for Y",
+			"	Dimensionless;   !- Output Unit Type",
+			"Curve:Biquadratic,",
+			"	WindACEIRFT,   !- Name",
+			"	0.342414409,   !- Coefficient1 Constant",
+			"	0.034885008,   !- Coefficient2 x",
+			"	-0.000623700,  !- Coefficient3 x**2",
+			"	0.004977216,   !- Coefficient4 y",
+			"	0.000437951,   !- Coefficient5 y**2",
+			"	-0.000728028,  !- Coefficient6 x*y",
+			"	12.77778,      !- Minimum Value of x",
+			"	23.88889,      !- Maximum Value of x",
+			"	18.0,          !- Minimum Value of y",
+			"	46.11111,      !- Maximum Value of y",
+			"	,              !- Minimum Curve Output",
+			"	,              !- Maximum Curve Output",
+			"	Temperature,   !- Input Unit Type for X",
+			"	Temperature,   !- Input Unit Type for Y",
+			"	Dimensionless; !- Output Unit Type",
+			"Curve:Quadratic,",
+			"	WindACCoolCapFFF, !- Name",
+			"	0.8,              !- Coefficient1 Constant",
+			"	0.2,              !- Coefficient2 x",
+			"	0.0,              !- Coefficient3 x**2",
+			"	0.5,              !- Minimum Value of x",
+			"	1.5;              !- Maximum Value of x",
+			"Curve:Quadratic,",
+			"	WindACEIRFFF, !- Name",
+			"	1.1552,       !- Coefficient1 Constant",
+			"  -0.1808,       !- Coefficient2 x",
+			"	0.0256,       !- Coefficient3 x**2",
+			"	0.5,          !- Minimum Value of x",
+			"	1.5;          !- Maximum Value of x",
+			"Curve:Quadratic,",
+			"	WindACPLFFPLR, !- Name",
+			"	0.85,          !- Coefficient1 Constant",
+			"	0.15,          !- Coefficient2 x",
+			"	0.0,           !- Coefficient3 x**2",
+			"	0.0,           !- Minimum Value of x",
+			"	1.0;           !- Maximum Value of x",
+			"Coil:Cooling:DX:SingleSpeed,",
+			"	Furnace ACDXCoil 1,   !- Name",
+			"	,                     !- Availability Schedule Name",
+			"	25000.0,              !- Gross Rated Total Cooling Capacity { W }",
+			"	0.75,                 !- Gross Rated Sensible Heat Ratio",
+			"	4.40,                 !- Gross Rated Cooling COP { W / W }",
+			"	1.30,                 !- Rated Air Flow Rate { m3 / s }",
+			"	,                     !- Rated Evaporator Fan Power Per Volume Flow Rate { W / ( m3 / s ) }",
+			"	DX Cooling Coil Air Inlet Node, !- Air Inlet Node Name",
+			"	Heating Coil Air Inlet Node,    !- Air Outlet Node Name",
+			"	WindACCoolCapFT,      !- Total Cooling Capacity Function of Temperature Curve Name",
+			"	WindACCoolCapFFF,     !- Total Cooling Capacity Function of Flow Fraction Curve Name",
+			"	WindACEIRFT,          !- Energy Input Ratio Function of Temperature Curve Name",
+			"	WindACEIRFFF,         !- Energy Input Ratio Function of Flow Fraction Curve Name",
+			"	WindACPLFFPLR;        !- Part Load Fraction Correlation Curve Name",
+		} );
+
+		ASSERT_FALSE( process_idf( idf_objects ) );
+
+		GetCurveInput();
+		GetDXCoils();
+		ASSERT_EQ( 1, NumDXCoils );
+
+		auto & Coil( DXCoil( 1 ) );
+		Coil.SchedPtr = DataGlobals::ScheduleAlwaysOn;
+		Coil.RatedAirMassFlowRate( 1 ) = Coil.RatedAirVolFlowRate( 1 ) * PsyRhoAirFnPbTdbW( StdBaroPress, RatedInletAirTemp, RatedInletAirHumRat );
+		Coil.RatedCBF( 1 ) = CalcCBF( Coil.DXCoilType, Coil.Name, RatedInletAirTemp, RatedInletAirHumRat, Coil.RatedTotCap( 1 ), Coil.RatedAirMassFlowRate( 1 ), Coil.RatedSHR( 1 ) );
+
+		OutBaroPress = 101325.0;
+		OutDryBulbTemp = 35.0;
+		OutHumRat = 0.0120;
+		OutWetBulbTemp = PsyTwbFnTdbWPb( OutDryBulbTemp, OutHumRat, OutBaroPress );
+
+		auto SetInletConditions = [ &Coil ]() {
+			Coil.InletAirMassFlowRate = Coil.RatedAirMassFlowRate( 1 );
+			Coil.InletAirTemp = 26.0;
+			Coil.InletAirHumRat = 0.0110;
+			Coil.InletAirEnthalpy = PsyHFnTdbW( Coil.InletAirTemp, Coil.InletAirHumRat );
+		};
+
+		bool const SaveMemoizeDXCoilPerformance( DataSystemVariables::MemoizeDXCoilPerformance );
+		DataSystemVariables::MemoizeDXCoilPerformance = true;
+
+		// first call calculates the full load performance
+		SetInletConditions();
+		CalcDoe2DXCoil( 1, On, false, 0.8, CycFanCycCoil );
+		EXPECT_EQ( 0, Coil.PerfMemoHits );
+		EXPECT_EQ( 1, Coil.PerfMemoMisses );
+		Real64 const OutletAirTemp( Coil.OutletAirTemp );
+		Real64 const OutletAirHumRat( Coil.OutletAirHumRat );
+		Real64 const OutletAirEnthalpy( Coil.OutletAirEnthalpy );
+		Real64 const TotalCoolingEnergyRate( Coil.TotalCoolingEnergyRate );
+		Real64 const SensCoolingEnergyRate( Coil.SensCoolingEnergyRate );
+		Real64 const ElecCoolingPower( Coil.ElecCoolingPower );
+		EXPECT_LT( OutletAirTemp, Coil.InletAirTemp );
+		EXPECT_LT( OutletAirHumRat, Coil.InletAirHumRat );
+
+		// second call at the same inlet conditions takes it from the memo, with identical results
+		SetInletConditions();
+		CalcDoe2DXCoil( 1, On, false, 0.8, CycFanCycCoil );
+		EXPECT_EQ( 1, Coil.PerfMemoHits );
+		EXPECT_EQ( 1, Coil.PerfMemoMisses );
+		EXPECT_EQ( OutletAirTemp, Coil.OutletAirTemp );
+		EXPECT_EQ( OutletAirHumRat, Coil.OutletAirHumRat );
+		EXPECT_EQ( OutletAirEnthalpy, Coil.OutletAirEnthalpy );
+		EXPECT_EQ( TotalCoolingEnergyRate, Coil.TotalCoolingEnergyRate );
+		EXPECT_EQ( SensCoolingEnergyRate, Coil.SensCoolingEnergyRate );
+		EXPECT_EQ( ElecCoolingPower, Coil.ElecCoolingPower );
+
+		// and the same as without the memo
+		DataSystemVariables::MemoizeDXCoilPerformance = false;
+		SetInletConditions();
+		CalcDoe2DXCoil( 1, On, false, 0.8, CycFanCycCoil );
+		EXPECT_EQ( 1, Coil.PerfMemoHits );
+		EXPECT_EQ( 1, Coil.PerfMemoMisses );
+		EXPECT_EQ( OutletAirTemp, Coil.OutletAirTemp );
+		EXPECT_EQ( OutletAirHumRat, Coil.OutletAirHumRat );
+		EXPECT_EQ( TotalCoolingEnergyRate, Coil.TotalCoolingEnergyRate );
+
+		DataSystemVariables::MemoizeDXCoilPerformance = SaveMemoizeDXCoilPerformance;
+	}
+
 }
@@ -245,3 +245,119 @@ TEST_F( EnergyPlusFixture, General_CreateTimeIntervalString )
 		EXPECT_EQ( "00:00:59.0 - 00:00:59.9", General::CreateTimeIntervalString( 59, 59.9 ) );
 	}
 }
+
+TEST_F( EnergyPlusFixture, General_SolveRootMethods )
+{
+	using General::RootFinderMethod;
+
+	// typed parameters bound through the lambda rather than an Array1D Par
+	struct CubicPar {
+		Real64 A;
+		Real64 B;
+	} const par { 2.0, -5.0 };
+	auto const cubic = [&]( Real64 const X ) { return X * X * X - par.A * X + par.B; };
+	Real64 const Eps( 1.0e-8 );
+	int const MaxIte( 500 );
+	int SolFla( 0 );
+	Real64 XRes( 0.0 );
+
+	// the default method is the original regula falsi: 23 iterations and this root with the
+	// SolveRegulaFalsi implementation that SolveRoot replaced
+	General::SolveRoot( Eps, MaxIte, SolFla, XRes, cubic, 0.0, 3.0 );
+	EXPECT_EQ( 23, SolFla );
+	EXPECT_NEAR( 2.0945514806994492, XRes, 1.0e-14 );
+	General::SolveRegulaFalsi( Eps, MaxIte, SolFla, XRes, cubic, 0.0, 3.0 );
+	EXPECT_EQ( 23, SolFla );
+	EXPECT_NEAR( 2.0945514806994492, XRes, 1.0e-14 );
+
+	// iterations to converge on the cubic for each method
+	struct MethodCase {
+		RootFinderMethod Method;
+		int NIte;
+		Real64 Root;
+	};
+	MethodCase const cases[] = {
+		{ RootFinderMethod::RegulaFalsi, 23, 2.0945514806994492 },
+		{ RootFinderMethod::Illinois, 9, 2.094551481534618 },
+		{ RootFinderMethod::Brent, 8, 2.0945514815423278 },
+		{ RootFinderMethod::ITP, 7, 2.0945514815228394 }
+	};
+
+	for ( auto const & c : cases ) {
+		auto const Method = c.Method;
+		General::SolveRoot( Eps, MaxIte, SolFla, XRes, cubic, 0.0, 3.0, Method );
+		EXPECT_EQ( c.NIte, SolFla );
+		EXPECT_NEAR( c.Root, XRes, 1.0e-12 );
+		EXPECT_LT( std::abs( cubic( XRes ) ), Eps );
+
+		// reversed bracket
+		General::SolveRoot( Eps, MaxIte, SolFla, XRes, cubic, 3.0, 0.0, Method );
+		EXPECT_EQ( c.NIte, SolFla );
+		EXPECT_NEAR( c.Root, XRes, 1.0e-12 );
+
+		// decreasing residual, every iterate stays inside the bracket
+		Real64 XMin( 3.0 );
+		Real64 XMax( 0.0 );
+		auto const negCubic = [&]( Real64 const X ) {
+			XMin = std::min( XMin, X );
+			XMax = std::max( XMax, X );
+			return -cubic( X );
+		};
+		General::SolveRoot( Eps, MaxIte, SolFla, XRes, negCubic, 0.0, 3.0, Method );
+		EXPECT_EQ( c.NIte, SolFla );
+		EXPECT_NEAR( c.Root, XRes, 1.0e-12 );
+		EXPECT_GE( XMin, 0.0 );
+		EXPECT_LE( XMax, 3.0 );
+
+		// no sign change
+		General::SolveRoot( Eps, MaxIte, SolFla, XRes, cubic, 3.0, 4.0, Method );
+		EXPECT_EQ( -2, SolFla );
+		EXPECT_EQ( 3.0, XRes );
+
+		// iteration limit
+		General::SolveRoot( 1.0e-30, 2, SolFla, XRes, cubic, 0.0, 3.0, Method );
+		EXPECT_EQ( -1, SolFla );
+	}
+
+	// plain regula falsi stalls on one end of a strongly convex residual (the original
+	// SolveRegulaFalsi also gave up here at this last iterate); the other updates do not
+	auto const steep = []( Real64 const X ) { return std::exp( 10.0 * X ) - 2.0; };
+	General::SolveRoot( Eps, MaxIte, SolFla, XRes, steep, 0.0, 1.0, RootFinderMethod::RegulaFalsi );
+	EXPECT_EQ( -1, SolFla );
+	EXPECT_NEAR( 0.020001407270797831, XRes, 1.0e-14 );
+	General::SolveRoot( Eps, MaxIte, SolFla, XRes, steep, 0.0, 1.0, RootFinderMethod::Illinois );
+	EXPECT_EQ( 17, SolFla );
+	EXPECT_NEAR( std::log( 2.0 ) / 10.0, XRes, 1.0e-8 );
+	General::SolveRoot( Eps, MaxIte, SolFla, XRes, steep, 0.0, 1.0, RootFinderMethod::Brent );
+	EXPECT_EQ( 7, SolFla );
+	EXPECT_NEAR( std::log( 2.0 ) / 10.0, XRes, 1.0e-8 );
+	General::SolveRoot( Eps, MaxIte, SolFla, XRes, steep, 0.0, 1.0, RootFinderMethod::ITP );
+	EXPECT_EQ( 10, SolFla );
+	EXPECT_NEAR( std::log( 2.0 ) / 10.0, XRes, 1.0e-8 );
+}
+
+TEST_F( EnergyPlusFixture, General_SolveTridiagonal )
+{
+	// 4 x 4 diagonally dominant system with known solution X = { 1, -2, 3, 0.5 }
+	Array1D< Real64 > const A( 4, { 0.0, -1.0, -2.0, -0.5 } );
+	Array1D< Real64 > const B( 4, { 4.0, 5.0, 6.0, 3.0 } );
+	Array1D< Real64 > const C( 4, { -1.0, -1.5, -2.5, 0.0 } );
+	Array1D< Real64 > const X( 4, { 1.0, -2.0, 3.0, 0.5 } );
+	Array1D< Real64 > D( 4 );
+	Array1D< Real64 > W( 4 );
+	for ( int i = 1; i <= 4; ++i ) {
+		D( i ) = B( i ) * X( i );
+		if ( i > 1 ) D( i ) += A( i ) * X( i - 1 );
+		if ( i < 4 ) D( i ) += C( i ) * X( i + 1 );
+	}
+
+	General::SolveTridiagonal( 4, A, B, C, D, W );
+	for ( int i = 1; i <= 4; ++i ) {
+		EXPECT_NEAR( X( i ), D( i ), 1.0e-12 );
+	}
+
+	// single equation
+	Array1D< Real64 > D1( 1, 6.0 );
+	General::SolveTridiagonal( 1, A, B, C, D1, W );
+	EXPECT_DOUBLE_EQ( 1.5, D1( 1 ) );
+}
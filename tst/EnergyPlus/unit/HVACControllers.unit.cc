@@ -65,6 +65,9 @@
 #include <ObjexxFCL/Array1D.hh>
 
 // EnergyPlus Headers
+#include <EnergyPlus/DataHVACControllers.hh>
+#include <EnergyPlus/DataLoopNode.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
 #include <EnergyPlus/HVACControllers.hh>
 #include <EnergyPlus/MixedAir.hh>
 #include <EnergyPlus/ScheduleManager.hh>
@@ -219,4 +222,60 @@ namespace EnergyPlus {
 
 	}
 
+
+	TEST_F( EnergyPlusFixture, HVACControllers_WarmStartFromPreviousSolution ) {
+		using DataHVACControllers::iModeActive;
+		using DataHVACControllers::iModeMinActive;
+
+		DataLoopNode::Node.allocate( 2 );
+		DataLoopNode::Node( 1 ).MassFlowRate = 1.0;
+		ControllerProps.allocate( 1 );
+		RootFinders.allocate( 1 );
+		NumControllers = 1;
+		ControllerProps( 1 ).ControlVar = iTemperature;
+		ControllerProps( 1 ).SensedNode = 1;
+		ControllerProps( 1 ).ActuatedNode = 2;
+		ControllerProps( 1 ).MinAvailActuated = 0.0;
+		ControllerProps( 1 ).MaxAvailActuated = 1.0;
+
+		bool IsConvergedFlag = false;
+		bool IsUpToDateFlag = false;
+
+		// by default the controller starts at the min point even with an active previous solution
+		ControllerProps( 1 ).NumCalcCalls = 0;
+		ControllerProps( 1 ).ReusePreviousSolutionFlag = true;
+		ControllerProps( 1 ).SolutionTrackers( 2 ).DefinedFlag = true;
+		ControllerProps( 1 ).SolutionTrackers( 2 ).Mode = iModeActive;
+		ControllerProps( 1 ).SolutionTrackers( 2 ).ActuatedValue = 0.4;
+		CalcSimpleController( 1, false, IsConvergedFlag, IsUpToDateFlag, "CONTROLLER" );
+		EXPECT_EQ( 0.0, ControllerProps( 1 ).NextActuatedValue );
+		EXPECT_TRUE( ControllerProps( 1 ).ReusePreviousSolutionFlag );
+
+		DataSystemVariables::WarmStartControllers = true;
+
+		// active solution at the previous call is used as the first iterate
+		ControllerProps( 1 ).NumCalcCalls = 0;
+		CalcSimpleController( 1, false, IsConvergedFlag, IsUpToDateFlag, "CONTROLLER" );
+		EXPECT_EQ( 0.4, ControllerProps( 1 ).NextActuatedValue );
+		EXPECT_FALSE( ControllerProps( 1 ).ReusePreviousSolutionFlag );
+
+		// constrained solution at the previous call falls back to the min point
+		ControllerProps( 1 ).NumCalcCalls = 0;
+		ControllerProps( 1 ).ReusePreviousSolutionFlag = true;
+		ControllerProps( 1 ).SolutionTrackers( 2 ).Mode = iModeMinActive;
+		CalcSimpleController( 1, false, IsConvergedFlag, IsUpToDateFlag, "CONTROLLER" );
+		EXPECT_EQ( 0.0, ControllerProps( 1 ).NextActuatedValue );
+		EXPECT_TRUE( ControllerProps( 1 ).ReusePreviousSolutionFlag );
+
+		// out of range solution is not reused
+		ControllerProps( 1 ).NumCalcCalls = 0;
+		ControllerProps( 1 ).SolutionTrackers( 2 ).Mode = iModeActive;
+		ControllerProps( 1 ).SolutionTrackers( 2 ).ActuatedValue = 1.5;
+		CalcSimpleController( 1, false, IsConvergedFlag, IsUpToDateFlag, "CONTROLLER" );
+		EXPECT_EQ( 0.0, ControllerProps( 1 ).NextActuatedValue );
+		EXPECT_TRUE( ControllerProps( 1 ).ReusePreviousSolutionFlag );
+
+		DataSystemVariables::WarmStartControllers = false;
+	}
+
 }
@@ -0,0 +1,197 @@
+// EnergyPlus, Copyright (c) 1996-2016, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// If you have questions about your rights to use or distribute this software, please contact
+// Berkeley Lab's Innovation & Partnerships Office at IPO@lbl.gov.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without Lawrence Berkeley National Laboratory's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// You are under no obligation whatsoever to provide any bug fixes, patches, or upgrades to the
+// features, functionality or performance of the source code ("Enhancements") to anyone; however,
+// if you choose to make your Enhancements available either publicly, or directly to Lawrence
+// Berkeley National Laboratory, without imposing a separate written license agreement for such
+// Enhancements, then you hereby grant the following license: a non-exclusive, royalty-free
+// perpetual license to install, use, modify, prepare derivative works, incorporate into other
+// computer software, distribute, and sublicense such enhancements or derivative works thereof,
+// in binary and source code form.
+
+// EnergyPlus::HVACFan Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+#include "Fixtures/EnergyPlusFixture.hh"
+#include <EnergyPlus/CurveManager.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
+#include <EnergyPlus/HVACFan.hh>
+
+using namespace EnergyPlus;
+
+TEST_F( EnergyPlusFixture, HVACFan_FanObjectVectorIndex )
+{
+	std::string const idf_objects = delimited_string( {
+		"Version,8.6;",
+		"Fan:SystemModel,",
+		"	Test Fan 1,              !- Name",
+		"	,                        !- Availability Schedule Name",
+		"	Fan 1 Inlet Node,        !- Air Inlet Node Name",
+		"	Fan 1 Outlet Node,       !- Air Outlet Node Name",
+		"	1.0,                     !- Design Maximum Air Flow Rate {m3/s}",
+		"	Continuous,              !- Speed Control Method",
+		"	0.0,                     !- Electric Power Minimum Flow Rate Fraction",
+		"	100.0,                   !- Design Pressure Rise {Pa}",
+		"	0.9,                     !- Motor Efficiency",
+		"	1.0,                     !- Motor In Air Stream Fraction",
+		"	AUTOSIZE,                !- Design Electric Power Consumption {W}",
+		"	TotalEfficiencyAndPressure, !- Design Power Sizing Method",
+		"	,                        !- Electric Power Per Unit Flow Rate {W/(m3/s)}",
+		"	,                        !- Electric Power Per Unit Flow Rate Per Unit Pressure {W/((m3/s)-Pa)}",
+		"	0.50;                    !- Fan Total Efficiency",
+		"Fan:SystemModel,",
+		"	Test Fan 2,              !- Name",
+		"	,                        !- Availability Schedule Name",
+		"	Fan 2 Inlet Node,        !- Air Inlet Node Name",
+		"	Fan 2 Outlet Node,       !- Air Outlet Node Name",
+		"	0.5,                     !- Design Maximum Air Flow Rate {m3/s}",
+		"	Continuous,              !- Speed Control Method",
+		"	0.0,                     !- Electric Power Minimum Flow Rate Fraction",
+		"	100.0,                   !- Design Pressure Rise {Pa}",
+		"	0.9,                     !- Motor Efficiency",
+		"	1.0,                     !- Motor In Air Stream Fraction",
+		"	AUTOSIZE,                !- Design Electric Power Consumption {W}",
+		"	TotalEfficiencyAndPressure, !- Design Power Sizing Method",
+		"	,                        !- Electric Power Per Unit Flow Rate {W/(m3/s)}",
+		"	,                        !- Electric Power Per Unit Flow Rate Per Unit Pressure {W/((m3/s)-Pa)}",
+		"	0.50;                    !- Fan Total Efficiency",
+	} );
+
+	ASSERT_FALSE( process_idf( idf_objects ) );
+
+	EXPECT_TRUE( HVACFan::checkIfFanNameIsAFanSystem( "TEST FAN 1" ) );
+	EXPECT_FALSE( HVACFan::checkIfFanNameIsAFanSystem( "NO SUCH FAN" ) );
+
+	// objects are registered as parents construct them
+	HVACFan::fanObjs.emplace_back( new HVACFan::FanSystem( "TEST FAN 1" ) );
+	EXPECT_EQ( 0, HVACFan::getFanObjectVectorIndex( "TEST FAN 1" ) );
+	EXPECT_EQ( -1, HVACFan::getFanObjectVectorIndex( "TEST FAN 2" ) );
+
+	HVACFan::fanObjs.emplace_back( new HVACFan::FanSystem( "TEST FAN 2" ) );
+	EXPECT_EQ( 1, HVACFan::getFanObjectVectorIndex( "TEST FAN 2" ) );
+	EXPECT_EQ( 0, HVACFan::getFanObjectVectorIndex( "TEST FAN 1" ) );
+	EXPECT_EQ( -1, HVACFan::getFanObjectVectorIndex( "NO SUCH FAN" ) );
+	EXPECT_DOUBLE_EQ( 0.5, HVACFan::fanObjs[ HVACFan::getFanObjectVectorIndex( "TEST FAN 2" ) ]->designAirVolFlowRate() );
+
+	// clear_state empties the registry with the objects
+	HVACFan::clear_state();
+	EXPECT_EQ( -1, HVACFan::getFanObjectVectorIndex( "TEST FAN 1" ) );
+}
+
+TEST_F( EnergyPlusFixture, HVACFan_PowerCurveTable )
+{
+	std::string const idf_objects = delimited_string( {
+		"Version,8.6;",
+		"Fan:SystemModel,",
+		"	Test Fan,                !- Name",
+		"	,                        !- Availability Schedule Name",
+		"	Fan Inlet Node,          !- Air Inlet Node Name",
+		"	Fan Outlet Node,         !- Air Outlet Node Name",
+		"	1.0,                     !- Design Maximum Air Flow Rate {m3/s}",
+		"	Continuous,              !- Speed Control Method",
+		"	0.0,                     !- Electric Power Minimum Flow Rate Fraction",
+		"	100.0,                   !- Design Pressure Rise {Pa}",
+		"	0.9,                     !- Motor Efficiency",
+		"	1.0,                     !- Motor In Air Stream Fraction",
+		"	AUTOSIZE,                !- Design Electric Power Consumption {W}",
+		"	TotalEfficiencyAndPressure, !- Design Power Sizing Method",
+		"	,                        !- Electric Power Per Unit Flow Rate {W/(m3/s)}",
+		"	,                        !- Electric Power Per Unit Flow Rate Per Unit Pressure {W/((m3/s)-Pa)}",
+		"	0.50,                    !- Fan Total Efficiency",
+		"	Fan Power Curve;         !- Electric Power Function of Flow Fraction Curve Name",
+		"Curve:Cubic,",
+		"	Fan Power Curve,         !- Name",
+		"	0.0013,                  !- Coefficient1 Constant",
+		"	0.1470,                  !- Coefficient2 x",
+		"	0.9506,                  !- Coefficient3 x**2",
+		"	-0.0998,                 !- Coefficient4 x**3",
+		"	0.0,                     !- Minimum Value of x",
+		"	1.0;                     !- Maximum Value of x",
+	} );
+
+	ASSERT_FALSE( process_idf( idf_objects ) );
+
+	// without the environment variable the curve is evaluated directly
+	HVACFan::fanObjs.emplace_back( new HVACFan::FanSystem( "TEST FAN" ) );
+	int const curveIndex = HVACFan::fanObjs[ 0 ]->getFanPowerCurveIndex();
+	EXPECT_DOUBLE_EQ( CurveManager::CurveValue( curveIndex, 0.37 ), HVACFan::fanObjs[ 0 ]->calcPowerFraction( 0.37 ) );
+
+	// with it the power fraction is interpolated within the table tolerance, exact at the table points
+	DataSystemVariables::TabulateFanPowerCurves = true;
+	HVACFan::fanObjs.emplace_back( new HVACFan::FanSystem( "TEST FAN" ) );
+	for ( Real64 flowFraction = 0.0; flowFraction <= 1.0; flowFraction += 0.0137 ) {
+		EXPECT_NEAR( CurveManager::CurveValue( curveIndex, flowFraction ), HVACFan::fanObjs[ 1 ]->calcPowerFraction( flowFraction ), 1.0e-4 );
+	}
+	EXPECT_NEAR( CurveManager::CurveValue( curveIndex, 0.5 ), HVACFan::fanObjs[ 1 ]->calcPowerFraction( 0.5 ), 1.0e-12 );
+	EXPECT_NEAR( CurveManager::CurveValue( curveIndex, 1.0 ), HVACFan::fanObjs[ 1 ]->calcPowerFraction( 1.0 ), 1.0e-12 );
+
+	// away from the interval midpoints where the table was checked: quarter points of every interval
+	// of the 64 interval table, and points close to the ends of the range
+	for ( int interval = 0; interval < 64; ++interval ) {
+		for ( Real64 const offset : { 0.25, 0.75 } ) {
+			Real64 const flowFraction = ( interval + offset ) / 64.0;
+			EXPECT_NEAR( CurveManager::CurveValue( curveIndex, flowFraction ), HVACFan::fanObjs[ 1 ]->calcPowerFraction( flowFraction ), 1.0e-4 );
+		}
+	}
+	for ( Real64 const flowFraction : { 1.0e-6, 0.123456789, 0.999999 } ) {
+		EXPECT_NEAR( CurveManager::CurveValue( curveIndex, flowFraction ), HVACFan::fanObjs[ 1 ]->calcPowerFraction( flowFraction ), 1.0e-4 );
+	}
+
+	// the curve report variables follow the table
+	Real64 const powerFraction = HVACFan::fanObjs[ 1 ]->calcPowerFraction( 0.4321 );
+	EXPECT_DOUBLE_EQ( powerFraction, CurveManager::PerfCurve( curveIndex ).CurveOutput );
+	EXPECT_DOUBLE_EQ( 0.4321, CurveManager::PerfCurve( curveIndex ).CurveInput1 );
+
+	// outside the table range the curve is used
+	EXPECT_DOUBLE_EQ( CurveManager::CurveValue( curveIndex, 1.2 ), HVACFan::fanObjs[ 1 ]->calcPowerFraction( 1.2 ) );
+	DataSystemVariables::TabulateFanPowerCurves = false;
+}
@@ -0,0 +1,228 @@
+// EnergyPlus, Copyright (c) 1996-2016, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// If you have questions about your rights to use or distribute this software, please contact
+// Berkeley Lab's Innovation & Partnerships Office at IPO@lbl.gov.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without Lawrence Berkeley National Laboratory's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// You are under no obligation whatsoever to provide any bug fixes, patches, or upgrades to the
+// features, functionality or performance of the source code ("Enhancements") to anyone; however,
+// if you choose to make your Enhancements available either publicly, or directly to Lawrence
+// Berkeley National Laboratory, without imposing a separate written license agreement for such
+// Enhancements, then you hereby grant the following license: a non-exclusive, royalty-free
+// perpetual license to install, use, modify, prepare derivative works, incorporate into other
+// computer software, distribute, and sublicense such enhancements or derivative works thereof,
+// in binary and source code form.
+
+// EnergyPlus::HVACManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataConvergParams.hh>
+#include <EnergyPlus/DataEnvironment.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalFanSys.hh>
+#include <EnergyPlus/DataHVACGlobals.hh>
+#include <EnergyPlus/DataLoopNode.hh>
+#include <EnergyPlus/DataRoomAirModel.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
+#include <EnergyPlus/DataZoneEnergyDemands.hh>
+#include <EnergyPlus/ElectricPowerServiceManager.hh>
+#include <EnergyPlus/HVACManager.hh>
+#include <EnergyPlus/OutputProcessor.hh>
+#include <EnergyPlus/ScheduleManager.hh>
+
+#include "Fixtures/EnergyPlusFixture.hh"
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::HVACManager;
+
+TEST_F( EnergyPlusFixture, HVACManager_QuiescentHVACStep )
+{
+	std::string const idf_objects = delimited_string( {
+		"Version,8.4;",
+	} );
+	ASSERT_FALSE( process_idf( idf_objects ) );
+
+	DataSystemVariables::SkipQuiescentHVAC = true;
+	createFacilityElectricPowerServiceObject();
+
+	// one idle zone, one node without flow and one schedule
+	DataGlobals::NumOfZones = 1;
+	DataGlobals::HourOfDay = 10;
+	DataEnvironment::OutDryBulbTemp = 20.0;
+	DataEnvironment::OutHumRat = 0.008;
+	DataHVACGlobals::TimeStepSys = 0.25;
+	DataLoopNode::NumOfNodes = 1;
+	DataLoopNode::Node.allocate( 1 );
+	DataHeatBalFanSys::NonAirSystemResponse.dimension( 1, 0.0 );
+	DataHeatBalFanSys::SysDepZoneLoads.dimension( 1, 0.0 );
+	DataZoneEnergyDemands::ZoneSysEnergyDemand.allocate( 1 );
+	DataZoneEnergyDemands::ZoneSysMoistureDemand.allocate( 1 );
+	ScheduleManager::NumSchedules = 1;
+	ScheduleManager::Schedule.allocate( 1 );
+	ScheduleManager::Schedule( 1 ).CurrentValue = 1.0;
+
+	// no full simulation has left the system idle yet
+	EXPECT_FALSE( QuiescentHVACStep() );
+
+	// a full simulation that leaves flow on a node does not allow the next step to be skipped
+	DataLoopNode::Node( 1 ).MassFlowRate = 0.1;
+	UpdateQuiescentHVACState();
+	EXPECT_FALSE( QuiescentHVACStep() );
+
+	// idle system and nothing has changed: skip
+	DataLoopNode::Node( 1 ).MassFlowRate = 0.0;
+	UpdateQuiescentHVACState();
+	EXPECT_TRUE( QuiescentHVACStep() );
+
+	// small drift in outdoor conditions is tolerated
+	DataEnvironment::OutDryBulbTemp = 20.3;
+	EXPECT_TRUE( QuiescentHVACStep() );
+
+	// a zone load, a schedule change, a new hour or larger outdoor drift all force a full simulation
+	DataZoneEnergyDemands::ZoneSysEnergyDemand( 1 ).TotalOutputRequired = 100.0;
+	EXPECT_FALSE( QuiescentHVACStep() );
+	DataZoneEnergyDemands::ZoneSysEnergyDemand( 1 ).TotalOutputRequired = 0.0;
+	DataZoneEnergyDemands::ZoneSysMoistureDemand( 1 ).TotalOutputRequired = 1.0e-6;
+	EXPECT_FALSE( QuiescentHVACStep() );
+	DataZoneEnergyDemands::ZoneSysMoistureDemand( 1 ).TotalOutputRequired = 0.0;
+	ScheduleManager::Schedule( 1 ).CurrentValue = 0.0;
+	EXPECT_FALSE( QuiescentHVACStep() );
+	ScheduleManager::Schedule( 1 ).CurrentValue = 1.0;
+	DataGlobals::HourOfDay = 11;
+	EXPECT_FALSE( QuiescentHVACStep() );
+	DataGlobals::HourOfDay = 10;
+	DataEnvironment::OutDryBulbTemp = 21.0;
+	EXPECT_FALSE( QuiescentHVACStep() );
+	DataEnvironment::OutDryBulbTemp = 20.0;
+	EXPECT_TRUE( QuiescentHVACStep() );
+
+	// not without the environment variable
+	DataSystemVariables::SkipQuiescentHVAC = false;
+	EXPECT_FALSE( QuiescentHVACStep() );
+	DataSystemVariables::SkipQuiescentHVAC = true;
+
+	// not during a new environment
+	DataGlobals::BeginEnvrnFlag = true;
+	EXPECT_FALSE( QuiescentHVACStep() );
+	DataGlobals::BeginEnvrnFlag = false;
+
+	DataSystemVariables::SkipQuiescentHVAC = false;
+}
+
+TEST_F( EnergyPlusFixture, HVACManager_CarryQuiescentHVACOutputs )
+{
+	std::string const idf_objects = delimited_string( {
+		"Version,8.4;",
+	} );
+	ASSERT_FALSE( process_idf( idf_objects ) );
+
+	DataSystemVariables::SkipQuiescentHVAC = true;
+	createFacilityElectricPowerServiceObject();
+	DataGlobals::NumOfZones = 0;
+	DataLoopNode::NumOfNodes = 0;
+
+	// standby power of an idle component, reported as a rate and as energy over the system timestep
+	Real64 StandbyPower( 50.0 );
+	Real64 StandbyEnergy( 0.0 );
+	Real64 ZoneEnergy( 0.0 );
+	SetupOutputVariable( "Standby Electric Power [W]", StandbyPower, "System", "Average", "UNIT 1" );
+	SetupOutputVariable( "Standby Electric Energy [J]", StandbyEnergy, "System", "Sum", "UNIT 1" );
+	SetupOutputVariable( "Zone Standby Energy [J]", ZoneEnergy, "Zone", "Sum", "ZONE 1" );
+
+	// last full simulation on a 5 minute system timestep
+	DataHVACGlobals::TimeStepSys = 5.0 / 60.0;
+	StandbyEnergy = StandbyPower * DataHVACGlobals::TimeStepSys * DataGlobals::SecInHour;
+	ZoneEnergy = 1000.0;
+	UpdateQuiescentHVACState();
+
+	// skipped step on the same timestep: nothing changes
+	CarryQuiescentHVACOutputs();
+	EXPECT_DOUBLE_EQ( 15000.0, StandbyEnergy );
+
+	// skipped step on a 15 minute timestep: the energy covers the new timestep at the same rate
+	DataHVACGlobals::TimeStepSys = 0.25;
+	CarryQuiescentHVACOutputs();
+	EXPECT_DOUBLE_EQ( StandbyPower * DataHVACGlobals::TimeStepSys * DataGlobals::SecInHour, StandbyEnergy );
+	EXPECT_DOUBLE_EQ( 50.0, StandbyPower );
+	EXPECT_DOUBLE_EQ( 1000.0, ZoneEnergy );
+
+	// and back
+	DataHVACGlobals::TimeStepSys = 0.1;
+	CarryQuiescentHVACOutputs();
+	EXPECT_DOUBLE_EQ( StandbyPower * DataHVACGlobals::TimeStepSys * DataGlobals::SecInHour, StandbyEnergy );
+
+	DataSystemVariables::SkipQuiescentHVAC = false;
+}
+
+TEST_F( EnergyPlusFixture, HVACManager_NumSysStepsForZoneTempChange )
+{
+	// one well-mixed zone warming by 1 C per zone timestep along a straight line
+	DataGlobals::NumOfZones = 1;
+	DataRoomAirModel::IsZoneDV.dimension( 1, false );
+	DataRoomAirModel::IsZoneUI.dimension( 1, false );
+	DataHeatBalFanSys::ZT.dimension( 1, 24.0 );
+	DataHeatBalFanSys::XMAT.dimension( 1, 23.0 );
+	DataHeatBalFanSys::XM2T.dimension( 1, 22.0 );
+	DataHeatBalFanSys::XM3T.dimension( 1, 21.0 );
+	DataHeatBalFanSys::XM4T.dimension( 1, 20.0 );
+
+	// the 0.3 C rule alone splits the zone timestep into four
+	DataConvergParams::ZoneTempErrorTol = 0.0;
+	EXPECT_EQ( 4, NumSysStepsForZoneTempChange( 1.0 ) );
+
+	// the smooth history has no truncation error, so error control keeps a single system timestep
+	DataConvergParams::ZoneTempErrorTol = 0.05;
+	EXPECT_EQ( 1, NumSysStepsForZoneTempChange( 1.0 ) );
+
+	// a sudden 4 C jump needs 3 system timesteps for the error estimate, and 4 under the 1.2 C safety limit
+	DataHeatBalFanSys::ZT( 1 ) = 27.0;
+	EXPECT_EQ( 4, NumSysStepsForZoneTempChange( 4.0 ) );
+	DataConvergParams::ZoneTempErrorTol = 0.0;
+	EXPECT_EQ( 14, NumSysStepsForZoneTempChange( 4.0 ) );
+}
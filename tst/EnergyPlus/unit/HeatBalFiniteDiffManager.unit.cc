@@ -64,7 +64,9 @@
 // EnergyPlus Headers
 #include "Fixtures/EnergyPlusFixture.hh"
 #include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
 #include <EnergyPlus/DataHeatBalSurface.hh>
+#include <EnergyPlus/DataSurfaces.hh>
 #include <EnergyPlus/HeatBalFiniteDiffManager.hh>
 
 using namespace EnergyPlus::HeatBalFiniteDiffManager;
@@ -193,4 +195,55 @@ namespace EnergyPlus {
 
 	}
 
+	TEST_F( EnergyPlusFixture, HeatBalFiniteDiffManager_InteriorLayerEqnsTest )
+	{
+		// one layer with five interior nodes between two fixed boundary nodes
+		int const numNodes( 6 );
+		int const SurfNum( 1 );
+		int const Delt( 60 );
+
+		DataSurfaces::Surface.allocate( 1 );
+		DataSurfaces::Surface( SurfNum ).Construction = 1;
+		DataHeatBalance::Construct.allocate( 1 );
+		DataHeatBalance::Construct( 1 ).LayerPoint( 1 ) = 1;
+		DataHeatBalance::Material.allocate( 1 );
+		DataHeatBalance::Material( 1 ).Conductivity = 1.0;
+		DataHeatBalance::Material( 1 ).SpecHeat = 1000.0;
+		DataHeatBalance::Material( 1 ).Density = 2000.0;
+		MaterialFD.allocate( 1 );
+		MaterialFD( 1 ).TempEnth.dimension( 2, 3, -100.0 );
+		MaterialFD( 1 ).TempCond.dimension( 2, 3, -100.0 );
+		ConstructFD.allocate( 1 );
+		ConstructFD( 1 ).DelX.allocate( 1 );
+		ConstructFD( 1 ).DelX( 1 ) = 0.02;
+		SurfaceFD.allocate( 1 );
+		SurfaceFD( SurfNum ).CpDelXRhoS1.allocate( numNodes + 1 );
+		SurfaceFD( SurfNum ).CpDelXRhoS2.allocate( numNodes + 1 );
+
+		Array1D< Real64 > TD( numNodes + 1, 20.0 );
+		Array1D< Real64 > TDT( numNodes + 1, 20.0 );
+		Array1D< Real64 > EnthOld( numNodes + 1, 0.0 );
+		Array1D< Real64 > EnthNew( numNodes + 1, 0.0 );
+		Array1D< Real64 > Unused( numNodes + 1, 0.0 );
+		TDT( 1 ) = 30.0;
+		TDT( numNodes + 1 ) = 10.0;
+
+		// node by node sweeps until converged
+		Array1D< Real64 > TDTSweep( TDT );
+		for ( int iter = 1; iter <= 2000; ++iter ) {
+			for ( int i = 2; i <= numNodes; ++i ) {
+				InteriorNodeEqns( Delt, i, 1, SurfNum, Unused, Unused, Unused, Unused, Unused, TD, TDTSweep, EnthOld, EnthNew );
+			}
+		}
+
+		// the layer solve reaches the same temperatures at once
+		InteriorLayerEqns( Delt, 2, numNodes, 1, SurfNum, TD, TDT, EnthOld, EnthNew );
+		for ( int i = 1; i <= numNodes + 1; ++i ) {
+			EXPECT_NEAR( TDTSweep( i ), TDT( i ), 1.0e-8 );
+		}
+		EXPECT_DOUBLE_EQ( 30.0, TDT( 1 ) );
+		EXPECT_DOUBLE_EQ( 10.0, TDT( numNodes + 1 ) );
+		EXPECT_DOUBLE_EQ( 1000.0 * 0.02 * 2000.0 / 2.0, SurfaceFD( SurfNum ).CpDelXRhoS1( 3 ) );
+	}
+
 }
@@ -0,0 +1,216 @@
+// EnergyPlus, Copyright (c) 1996-2016, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// If you have questions about your rights to use or distribute this software, please contact
+// Berkeley Lab's Innovation & Partnerships Office at IPO@lbl.gov.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without Lawrence Berkeley National Laboratory's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// You are under no obligation whatsoever to provide any bug fixes, patches, or upgrades to the
+// features, functionality or performance of the source code ("Enhancements") to anyone; however,
+// if you choose to make your Enhancements available either publicly, or directly to Lawrence
+// Berkeley National Laboratory, without imposing a separate written license agreement for such
+// Enhancements, then you hereby grant the following license: a non-exclusive, royalty-free
+// perpetual license to install, use, modify, prepare derivative works, incorporate into other
+// computer software, distribute, and sublicense such enhancements or derivative works thereof,
+// in binary and source code form.
+
+// EnergyPlus::HeatBalanceHAMTManager Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include "Fixtures/EnergyPlusFixture.hh"
+#include <EnergyPlus/DataEnvironment.hh>
+#include <EnergyPlus/DataGlobals.hh>
+#include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataHeatBalFanSys.hh>
+#include <EnergyPlus/DataHeatBalSurface.hh>
+#include <EnergyPlus/DataMoistureBalance.hh>
+#include <EnergyPlus/DataSurfaces.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
+#include <EnergyPlus/HeatBalanceHAMTManager.hh>
+#include <EnergyPlus/HeatBalanceManager.hh>
+
+using namespace EnergyPlus::HeatBalanceHAMTManager;
+
+namespace EnergyPlus {
+
+	TEST_F( EnergyPlusFixture, HeatBalanceHAMTManager_DirectSolve )
+	{
+		std::string const idf_objects = delimited_string( {
+			"Version,8.6;",
+			"Material, Concrete, Rough, 0.1, 1.6, 2300, 850, 0.9, 0.7, 0.7;",
+			"Material, Spruce, Rough, 0.012, 0.09, 455, 1500, 0.9, 0.7, 0.7;",
+			"Construction, Exterior wall, Spruce, Concrete, Spruce;",
+			"MaterialProperty:HeatAndMoistureTransfer:Settings, Concrete, 0.76, 0.01;",
+			"MaterialProperty:HeatAndMoistureTransfer:Settings, Spruce, 0.73, 0.05;",
+			"MaterialProperty:HeatAndMoistureTransfer:SorptionIsotherm, Concrete, 10,",
+			"  0.202, 19.665, 0.2205, 22.31, 0.449, 38.4675, 0.454, 38.4675, 0.6506, 54.165,",
+			"  0.655, 54.165, 0.824, 72.565, 0.8725, 85.1, 0.924, 91.08, 0.964, 100.28;",
+			"MaterialProperty:HeatAndMoistureTransfer:SorptionIsotherm, Spruce, 7,",
+			"  0.205, 25.935, 0.4465, 44.3625, 0.6515, 61.99375, 0.6545, 61.99375, 0.83, 87.1325,",
+			"  0.9525, 119.665, 0.956, 120.12;",
+			"MaterialProperty:HeatAndMoistureTransfer:Suction, Concrete, 5,",
+			"  0, 0, 72, 0.0000000000741, 85, 0.000000000253, 100, 0.00000000101, 118, 0.00000000128;",
+			"MaterialProperty:HeatAndMoistureTransfer:Suction, Spruce, 3,",
+			"  0, 0, 20, 0.00000000000032, 600, 0.0000000000092;",
+			"MaterialProperty:HeatAndMoistureTransfer:Redistribution, Concrete, 5,",
+			"  0, 0, 72, 0.00000000000741, 85, 0.0000000000253, 100, 0.000000000101, 118, 0.000000000128;",
+			"MaterialProperty:HeatAndMoistureTransfer:Redistribution, Spruce, 3,",
+			"  0, 0, 20, 0.00000000000032, 600, 0.0000000000092;",
+			"MaterialProperty:HeatAndMoistureTransfer:Diffusion, Concrete, 1, 0, 180;",
+			"MaterialProperty:HeatAndMoistureTransfer:Diffusion, Spruce, 1, 0, 130;",
+			"MaterialProperty:HeatAndMoistureTransfer:ThermalConductivity, Concrete, 2, 0, 1.6, 180, 2.602;",
+			"MaterialProperty:HeatAndMoistureTransfer:ThermalConductivity, Spruce, 2, 0, 0.09, 730, 0.278;",
+		} );
+		ASSERT_FALSE( process_idf( idf_objects ) );
+
+		bool ErrorsFound( false );
+		HeatBalanceManager::GetMaterialData( ErrorsFound );
+		EXPECT_FALSE( ErrorsFound );
+		HeatBalanceManager::GetConstructData( ErrorsFound );
+		EXPECT_FALSE( ErrorsFound );
+
+		// one exterior wall of the three layer construction
+		int const SurfNum( 1 );
+		DataSurfaces::TotSurfaces = 1;
+		DataSurfaces::Surface.allocate( 1 );
+		DataSurfaces::Surface( SurfNum ).Name = "WALL";
+		DataSurfaces::Surface( SurfNum ).Class = DataSurfaces::SurfaceClass_Wall;
+		DataSurfaces::Surface( SurfNum ).HeatTransSurf = true;
+		DataSurfaces::Surface( SurfNum ).HeatTransferAlgorithm = DataSurfaces::HeatTransferModel_HAMT;
+		DataSurfaces::Surface( SurfNum ).Construction = 1;
+		DataSurfaces::Surface( SurfNum ).Area = 10.0;
+		DataSurfaces::Surface( SurfNum ).Zone = 1;
+		DataSurfaces::Surface( SurfNum ).ExtBoundCond = DataSurfaces::ExternalEnvironment;
+		DataGlobals::TimeStepZone = 1.0 / 6.0;
+
+		bool const SaveHAMTDirectSolve( DataSystemVariables::HAMTDirectSolve );
+		DataSystemVariables::HAMTDirectSolve = false;
+		GetHeatBalHAMTInput();
+		InitHeatBalHAMT();
+		EXPECT_TRUE( cellchain( SurfNum ) );
+		EXPECT_GT( Intcell( SurfNum ) - Extcell( SurfNum ), 3 * 3 );
+
+		// cold outside, warm and humid inside
+		DataMoistureBalance::TempOutsideAirFD.dimension( 1, 0.0 );
+		DataMoistureBalance::RhoVaporAirOut.dimension( 1, 0.004 );
+		DataMoistureBalance::RhoVaporAirIn.dimension( 1, 0.010 );
+		DataMoistureBalance::HConvExtFD.dimension( 1, 10.0 );
+		DataMoistureBalance::HMassConvExtFD.dimension( 1, 0.008 );
+		DataMoistureBalance::HConvInFD.dimension( 1, 3.0 );
+		DataMoistureBalance::HMassConvInFD.dimension( 1, 0.003 );
+		DataMoistureBalance::HSkyFD.dimension( 1, 1.0 );
+		DataMoistureBalance::HGrndFD.dimension( 1, 1.0 );
+		DataMoistureBalance::HAirFD.dimension( 1, 1.0 );
+		DataMoistureBalance::RhoVaporSurfIn.dimension( 1, 0.0 );
+		DataHeatBalSurface::QRadSWOutAbs.dimension( 1, 0.0 );
+		DataHeatBalSurface::QRadSWInAbs.dimension( 1, 0.0 );
+		DataHeatBalSurface::NetLWRadToSurf.dimension( 1, 0.0 );
+		DataHeatBalance::QRadThermInAbs.dimension( 1, 0.0 );
+		DataHeatBalFanSys::MAT.dimension( 1, 20.0 );
+		DataHeatBalFanSys::QHTRadSysSurf.dimension( 1, 0.0 );
+		DataHeatBalFanSys::QHWBaseboardSurf.dimension( 1, 0.0 );
+		DataHeatBalFanSys::QSteamBaseboardSurf.dimension( 1, 0.0 );
+		DataHeatBalFanSys::QElecBaseboardSurf.dimension( 1, 0.0 );
+		DataEnvironment::SkyTemp = -5.0;
+		DataEnvironment::OutBaroPress = 101325.0;
+
+		Array1D< subcell > const InitCells( cells );
+		int const NumSteps( 6 );
+
+		// cell by cell iteration
+		Real64 TempSurfInIter( 0.0 );
+		Real64 TempSurfOutIter( 0.0 );
+		for ( int step = 1; step <= NumSteps; ++step ) {
+			CalcHeatBalHAMT( SurfNum, TempSurfInIter, TempSurfOutIter );
+			UpdateHeatBalHAMT( SurfNum );
+		}
+		Array1D< subcell > const IterCells( cells );
+
+		// the chain of cells solved together reaches the same state
+		cells = InitCells;
+		DataSystemVariables::HAMTDirectSolve = true;
+		Real64 TempSurfInDirect( 0.0 );
+		Real64 TempSurfOutDirect( 0.0 );
+		for ( int step = 1; step <= NumSteps; ++step ) {
+			CalcHeatBalHAMT( SurfNum, TempSurfInDirect, TempSurfOutDirect );
+			UpdateHeatBalHAMT( SurfNum );
+		}
+		EXPECT_NEAR( TempSurfInIter, TempSurfInDirect, 0.1 );
+		EXPECT_NEAR( TempSurfOutIter, TempSurfOutDirect, 0.1 );
+		for ( int cid = Extcell( SurfNum ); cid <= Intcell( SurfNum ); ++cid ) {
+			EXPECT_NEAR( IterCells( cid ).temp, cells( cid ).temp, 0.1 );
+			EXPECT_NEAR( IterCells( cid ).rh, cells( cid ).rh, 0.01 );
+		}
+		EXPECT_LT( TempSurfOutDirect, TempSurfInDirect );
+		EXPECT_LT( cells( Extcell( SurfNum ) + 1 ).temp, InitCells( Extcell( SurfNum ) + 1 ).temp );
+
+		// a cell linked past its neighbour breaks the chain, and the cells are then updated one at a time
+		int const cidExt( Extcell( SurfNum ) );
+		int adjFree( 1 );
+		while ( InitCells( cidExt ).adjs( adjFree ) != -1 ) ++adjFree;
+		cells = InitCells;
+		cells( cidExt ).adjs( adjFree ) = cidExt + 2;
+		cells( cidExt ).adjsl( adjFree ) = 1;
+		cells( cidExt ).overlap( adjFree ) = DataSurfaces::Surface( SurfNum ).Area;
+		cells( cidExt ).dist( adjFree ) = cells( cidExt ).dist( 1 );
+		EXPECT_FALSE( CellsFormChain( SurfNum ) );
+		cellchain( SurfNum ) = CellsFormChain( SurfNum );
+		Array1D< subcell > const BridgedCells( cells );
+
+		DataSystemVariables::HAMTDirectSolve = false;
+		CalcHeatBalHAMT( SurfNum, TempSurfInIter, TempSurfOutIter );
+		cells = BridgedCells;
+		DataSystemVariables::HAMTDirectSolve = true;
+		CalcHeatBalHAMT( SurfNum, TempSurfInDirect, TempSurfOutDirect );
+		EXPECT_DOUBLE_EQ( TempSurfInIter, TempSurfInDirect );
+		EXPECT_DOUBLE_EQ( TempSurfOutIter, TempSurfOutDirect );
+
+		DataSystemVariables::HAMTDirectSolve = SaveHAMTDirectSolve;
+	}
+
+}
@@ -0,0 +1,221 @@
+// EnergyPlus, Copyright (c) 1996-2016, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// If you have questions about your rights to use or distribute this software, please contact
+// Berkeley Lab's Innovation & Partnerships Office at IPO@lbl.gov.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without Lawrence Berkeley National Laboratory's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// You are under no obligation whatsoever to provide any bug fixes, patches, or upgrades to the
+// features, functionality or performance of the source code ("Enhancements") to anyone; however,
+// if you choose to make your Enhancements available either publicly, or directly to Lawrence
+// Berkeley National Laboratory, without imposing a separate written license agreement for such
+// Enhancements, then you hereby grant the following license: a non-exclusive, royalty-free
+// perpetual license to install, use, modify, prepare derivative works, incorporate into other
+// computer software, distribute, and sublicense such enhancements or derivative works thereof,
+// in binary and source code form.
+
+// EnergyPlus::PlantLoopSolver Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// EnergyPlus Headers
+#include "Fixtures/EnergyPlusFixture.hh"
+#include <EnergyPlus/DataLoopNode.hh>
+#include <EnergyPlus/DataPlant.hh>
+#include <EnergyPlus/DataSystemVariables.hh>
+#include <EnergyPlus/PlantComponent.hh>
+#include <EnergyPlus/PlantLocation.hh>
+#include <EnergyPlus/PlantLoopSolver.hh>
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataPlant;
+using namespace EnergyPlus::PlantLoopSolver;
+using DataLoopNode::Node;
+
+namespace {
+
+	// pass-through pipe that counts how often it is simulated
+	class CountingPipe : public PlantComponent
+	{
+	public:
+		int NumSims = 0;
+
+		void
+		simulate( PlantLocation const & calledFromLocation, bool const EP_UNUSED( FirstHVACIteration ), Real64 & EP_UNUSED( CurLoad ), bool const EP_UNUSED( RunFlag ) ) override
+		{
+			auto const & comp( PlantLoop( calledFromLocation.loopNum ).LoopSide( calledFromLocation.loopSideNum ).Branch( calledFromLocation.branchNum ).Comp( calledFromLocation.compNum ) );
+			Node( comp.NodeNumOut ).Temp = Node( comp.NodeNumIn ).Temp;
+			Node( comp.NodeNumOut ).MassFlowRate = Node( comp.NodeNumIn ).MassFlowRate;
+			++NumSims;
+		}
+	};
+
+}
+
+TEST_F( EnergyPlusFixture, PlantLoopSolver_BranchCanSkipWhenIdle )
+{
+	TotNumLoops = 1;
+	PlantLoop.allocate( TotNumLoops );
+	PlantLoop( 1 ).LoopSide.allocate( 2 );
+	auto & loopSide( PlantLoop( 1 ).LoopSide( SupplySide ) );
+	loopSide.TotalBranches = 4;
+	loopSide.Branch.allocate( 4 );
+	for ( int BranchNum = 1; BranchNum <= 4; ++BranchNum ) {
+		loopSide.Branch( BranchNum ).TotalComponents = 2;
+		loopSide.Branch( BranchNum ).Comp.allocate( 2 );
+		loopSide.Branch( BranchNum ).Comp( 1 ).TypeOf_Num = TypeOf_Pipe;
+	}
+	loopSide.Branch( 1 ).Comp( 2 ).TypeOf_Num = TypeOf_Chiller_ElectricEIR;
+	loopSide.Branch( 2 ).Comp( 2 ).TypeOf_Num = TypeOf_CoolingTower_VarSpd;
+	loopSide.Branch( 3 ).Comp( 2 ).TypeOf_Num = TypeOf_PumpVariableSpeed;
+	loopSide.Branch( 4 ).Comp( 2 ).TypeOf_Num = TypeOf_Boiler_Simple;
+	loopSide.Branch( 4 ).IsBypass = true;
+
+	// chillers and towers shut off without flow
+	EXPECT_TRUE( BranchCanSkipWhenIdle( 1, SupplySide, 1 ) );
+	EXPECT_TRUE( BranchCanSkipWhenIdle( 1, SupplySide, 2 ) );
+
+	// branch pumps and bypass branches are always simulated
+	EXPECT_FALSE( BranchCanSkipWhenIdle( 1, SupplySide, 3 ) );
+	EXPECT_FALSE( BranchCanSkipWhenIdle( 1, SupplySide, 4 ) );
+}
+
+TEST_F( EnergyPlusFixture, PlantLoopSolver_SkipIdleParallelBranch )
+{
+	std::string const idf_objects = delimited_string( {
+		"Version,8.4;",
+	} );
+	ASSERT_FALSE( process_idf( idf_objects ) );
+
+	// inlet branch (nodes 1-2), two parallel branches (3-4, 5-6) and outlet branch (7-8)
+	Array1D< CountingPipe > Pipe( 4 );
+	DataLoopNode::Node.allocate( 8 );
+	TotNumLoops = 1;
+	PlantLoop.allocate( TotNumLoops );
+	PlantLoop( 1 ).FluidName = "WATER";
+	PlantLoop( 1 ).FluidIndex = 1;
+	PlantLoop( 1 ).LoopSide.allocate( 2 );
+	auto & loopSide( PlantLoop( 1 ).LoopSide( SupplySide ) );
+	loopSide.TotalBranches = 4;
+	loopSide.Branch.allocate( 4 );
+	for ( int BranchNum = 1; BranchNum <= 4; ++BranchNum ) {
+		auto & branch( loopSide.Branch( BranchNum ) );
+		branch.NodeNumIn = 2 * BranchNum - 1;
+		branch.NodeNumOut = 2 * BranchNum;
+		branch.TotalComponents = 1;
+		branch.Comp.allocate( 1 );
+		branch.Comp( 1 ).TypeOf_Num = TypeOf_Pipe;
+		branch.Comp( 1 ).GeneralEquipType = GenEquipTypes_Pipe;
+		branch.Comp( 1 ).CurOpSchemeType = NoControlOpSchemeType;
+		branch.Comp( 1 ).NodeNumIn = branch.NodeNumIn;
+		branch.Comp( 1 ).NodeNumOut = branch.NodeNumOut;
+		branch.Comp( 1 ).compPtr = &Pipe( BranchNum );
+	}
+	loopSide.SplitterExists = true;
+	loopSide.Splitter.allocate( 1 );
+	loopSide.Splitter( 1 ).NodeNumIn = 2;
+	loopSide.Splitter( 1 ).TotalOutletNodes = 2;
+	loopSide.Splitter( 1 ).NodeNumOut = { 3, 5 };
+	loopSide.MixerExists = true;
+	loopSide.Mixer.allocate( 1 );
+	loopSide.Mixer( 1 ).NodeNumOut = 7;
+	loopSide.Mixer( 1 ).TotalInletNodes = 2;
+	loopSide.Mixer( 1 ).NodeNumIn = { 4, 6 };
+
+	bool LoopShutDownFlag( false );
+	DataSystemVariables::SkipIdlePlantBranches = true;
+
+	// flow on the first parallel branch only
+	Node( 1 ).Temp = 10.0;
+	Node( 1 ).MassFlowRate = 1.0;
+	Node( 3 ).MassFlowRate = 1.0;
+	Node( 5 ).MassFlowRate = 0.0;
+	Node( 6 ).Temp = 12.0;
+
+	loopSide.FlowLock = FlowUnlocked;
+	SimulateAllLoopSideBranches( 1, SupplySide, 1.0, false, LoopShutDownFlag );
+	EXPECT_EQ( 1, Pipe( 2 ).NumSims );
+	EXPECT_EQ( 1, Pipe( 3 ).NumSims );
+	EXPECT_FALSE( loopSide.Branch( 2 ).IdleInUnlockedPass );
+	EXPECT_TRUE( loopSide.Branch( 3 ).IdleInUnlockedPass );
+	EXPECT_DOUBLE_EQ( 10.0, Node( 6 ).Temp );
+
+	// the locked pass leaves the idle branch and its outlet node alone
+	Node( 6 ).Temp = 12.0;
+	loopSide.FlowLock = FlowLocked;
+	SimulateAllLoopSideBranches( 1, SupplySide, 1.0, false, LoopShutDownFlag );
+	EXPECT_EQ( 2, Pipe( 1 ).NumSims );
+	EXPECT_EQ( 2, Pipe( 2 ).NumSims );
+	EXPECT_EQ( 1, Pipe( 3 ).NumSims );
+	EXPECT_EQ( 2, Pipe( 4 ).NumSims );
+	EXPECT_DOUBLE_EQ( 12.0, Node( 6 ).Temp );
+	EXPECT_DOUBLE_EQ( 0.0, Node( 6 ).MassFlowRate );
+	EXPECT_DOUBLE_EQ( 1.0, Node( 7 ).MassFlowRate );
+	EXPECT_DOUBLE_EQ( 10.0, Node( 7 ).Temp );
+	EXPECT_FALSE( loopSide.Branch( 3 ).IdleInUnlockedPass );
+
+	// still idle in the next unlocked pass, but flow is given to it once flow is locked
+	loopSide.FlowLock = FlowUnlocked;
+	SimulateAllLoopSideBranches( 1, SupplySide, 1.0, false, LoopShutDownFlag );
+	EXPECT_EQ( 2, Pipe( 3 ).NumSims );
+	EXPECT_TRUE( loopSide.Branch( 3 ).IdleInUnlockedPass );
+	Node( 5 ).MassFlowRate = 0.5;
+	loopSide.FlowLock = FlowLocked;
+	SimulateAllLoopSideBranches( 1, SupplySide, 1.0, false, LoopShutDownFlag );
+	EXPECT_EQ( 3, Pipe( 3 ).NumSims );
+	EXPECT_DOUBLE_EQ( 0.5, Node( 6 ).MassFlowRate );
+	EXPECT_DOUBLE_EQ( 1.5, Node( 7 ).MassFlowRate );
+
+	// the branch is simulated in both passes while it has flow
+	loopSide.FlowLock = FlowUnlocked;
+	SimulateAllLoopSideBranches( 1, SupplySide, 1.0, false, LoopShutDownFlag );
+	EXPECT_FALSE( loopSide.Branch( 3 ).IdleInUnlockedPass );
+	loopSide.FlowLock = FlowLocked;
+	SimulateAllLoopSideBranches( 1, SupplySide, 1.0, false, LoopShutDownFlag );
+	EXPECT_EQ( 5, Pipe( 3 ).NumSims );
+
+	DataSystemVariables::SkipIdlePlantBranches = false;
+}
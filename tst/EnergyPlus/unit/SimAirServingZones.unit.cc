@@ -72,10 +72,18 @@
 #include <ObjexxFCL/gio.hh>
 
 // EnergyPlus Headers
+#include "Fixtures/EnergyPlusFixture.hh"
+#include <DataAirLoop.hh>
 #include <DataAirSystems.hh>
+#include <DataBranchNodeConnections.hh>
+#include <DataConvergParams.hh>
+#include <DataHVACGlobals.hh>
+#include <DataLoopNode.hh>
 #include <DataSizing.hh>
+#include <DataSystemVariables.hh>
 #include <SimAirServingZones.hh>
 #include <MixedAir.hh>
+#include <OutAirNodeManager.hh>
 #include <UtilityRoutines.hh>
 
 using namespace EnergyPlus;
@@ -169,4 +177,114 @@ namespace EnergyPlus {
 
 	}
 
+
+	TEST_F( EnergyPlusFixture, SimAirServingZones_AirLoopPartitions )
+	{
+		// loops 1 and 2 supply the same zone, loop 3 has a chilled water coil;
+		// loops 1 and 3 only share an outdoor air node and a setpoint manager
+		auto AddConnection = []( int const NodeNum, std::string const & ObjectType, std::string const & ObjectName, std::string const & ConnectionType ) {
+			++DataBranchNodeConnections::NumOfNodeConnections;
+			DataBranchNodeConnections::NodeConnections.redimension( DataBranchNodeConnections::NumOfNodeConnections );
+			auto & thisConn( DataBranchNodeConnections::NodeConnections( DataBranchNodeConnections::NumOfNodeConnections ) );
+			thisConn.NodeNumber = NodeNum;
+			thisConn.ObjectType = ObjectType;
+			thisConn.ObjectName = ObjectName;
+			thisConn.ConnectionType = ConnectionType;
+		};
+
+		DataLoopNode::NumOfNodes = 10;
+		DataLoopNode::Node.allocate( 10 );
+		DataLoopNode::Node( 9 ).FluidType = DataLoopNode::NodeType_Water;
+		OutAirNodeManager::GetOutAirNodesInputFlag = false;
+		OutAirNodeManager::OutsideAirNodeList.allocate( 1 );
+		OutAirNodeManager::OutsideAirNodeList( 1 ) = 10;
+
+		AddConnection( 1, "AirLoopHVAC", "LOOP 1", "Outlet" );
+		AddConnection( 2, "AirLoopHVAC", "LOOP 1", "Inlet" );
+		AddConnection( 2, "OutdoorAir:Mixer", "MIXER 1", "Outlet" );
+		AddConnection( 10, "OutdoorAir:Mixer", "MIXER 1", "Inlet" );
+		AddConnection( 1, "AirLoopHVAC:ZoneSplitter", "SPLITTER 1", "Inlet" );
+		AddConnection( 3, "AirLoopHVAC:ZoneSplitter", "SPLITTER 1", "Outlet" );
+		AddConnection( 4, "ZoneHVAC:EquipmentConnections", "ZONE 1", "ZoneNode" );
+		AddConnection( 3, "ZoneHVAC:EquipmentConnections", "ZONE 1", "ZoneInlet" );
+		AddConnection( 7, "ZoneHVAC:EquipmentConnections", "ZONE 1", "ZoneInlet" );
+		AddConnection( 5, "AirLoopHVAC", "LOOP 2", "Outlet" );
+		AddConnection( 6, "AirLoopHVAC", "LOOP 2", "Inlet" );
+		AddConnection( 5, "AirTerminal:SingleDuct:Uncontrolled", "TERMINAL 2", "Inlet" );
+		AddConnection( 7, "AirTerminal:SingleDuct:Uncontrolled", "TERMINAL 2", "Outlet" );
+		AddConnection( 8, "Coil:Cooling:Water", "COIL 3", "Outlet" );
+		AddConnection( 9, "Coil:Cooling:Water", "COIL 3", "Inlet" );
+		AddConnection( 8, "OutdoorAir:Mixer", "MIXER 3", "Outlet" );
+		AddConnection( 10, "OutdoorAir:Mixer", "MIXER 3", "Inlet" );
+		AddConnection( 2, "SetpointManager:Scheduled", "SPM", "Setpoint" );
+		AddConnection( 8, "SetpointManager:Scheduled", "SPM", "Setpoint" );
+
+		DataHVACGlobals::NumPrimaryAirSys = 3;
+		DataAirLoop::AirToZoneNodeInfo.allocate( 3 );
+		DataAirLoop::AirToZoneNodeInfo( 1 ).AirLoopSupplyNodeNum.allocate( 1 );
+		DataAirLoop::AirToZoneNodeInfo( 1 ).AirLoopSupplyNodeNum( 1 ) = 1;
+		DataAirLoop::AirToZoneNodeInfo( 2 ).AirLoopSupplyNodeNum.allocate( 1 );
+		DataAirLoop::AirToZoneNodeInfo( 2 ).AirLoopSupplyNodeNum( 1 ) = 5;
+		DataAirLoop::AirToZoneNodeInfo( 3 ).AirLoopSupplyNodeNum.allocate( 1 );
+		DataAirLoop::AirToZoneNodeInfo( 3 ).AirLoopSupplyNodeNum( 1 ) = 8;
+
+		SetupAirLoopPartitions();
+
+		EXPECT_EQ( 2, NumAirLoopPartitions );
+		EXPECT_EQ( 1, AirLoopPartition( 1 ) );
+		EXPECT_EQ( 1, AirLoopPartition( 2 ) );
+		EXPECT_EQ( 2, AirLoopPartition( 3 ) );
+		EXPECT_TRUE( AirLoopPartitionIsolated( 1 ) );
+		EXPECT_FALSE( AirLoopPartitionIsolated( 2 ) ); // plant coupled through the water coil
+
+		// nothing is skipped on the first HVAC iteration
+		SetAirLoopPartitionSkipFlags( true );
+		EXPECT_FALSE( AirLoopPartitionSkip( 1 ) );
+		EXPECT_FALSE( AirLoopPartitionSkip( 2 ) );
+
+		// every loop simulated twice and converged: only the isolated partition is skipped
+		DataSystemVariables::SkipConvergedAirLoops = true;
+		DataConvergParams::AirLoopConvergence.allocate( 3 );
+		DataAirLoop::AirLoopControlInfo.allocate( 3 );
+		AirLoopSimCount = 2;
+		SetAirLoopPartitionSkipFlags( false );
+		EXPECT_TRUE( AirLoopPartitionSkip( 1 ) );
+		EXPECT_FALSE( AirLoopPartitionSkip( 2 ) );
+
+		// a loop simulated only once keeps its partition simulated
+		AirLoopSimCount( 2 ) = 1;
+		SetAirLoopPartitionSkipFlags( false );
+		EXPECT_FALSE( AirLoopPartitionSkip( 1 ) );
+		AirLoopSimCount( 2 ) = 2;
+
+		// one return interface not converged
+		DataConvergParams::AirLoopConvergence( 2 ).HVACTempNotConverged( 1 ) = true;
+		SetAirLoopPartitionSkipFlags( false );
+		EXPECT_FALSE( AirLoopPartitionSkip( 1 ) );
+		DataConvergParams::AirLoopConvergence( 2 ).HVACTempNotConverged( 1 ) = false;
+		SetAirLoopPartitionSkipFlags( false );
+		EXPECT_TRUE( AirLoopPartitionSkip( 1 ) );
+
+		// resimulation requested by the air loop
+		DataAirLoop::AirLoopControlInfo( 1 ).ResimAirLoopFlag = true;
+		SetAirLoopPartitionSkipFlags( false );
+		EXPECT_FALSE( AirLoopPartitionSkip( 1 ) );
+		DataAirLoop::AirLoopControlInfo( 1 ).ResimAirLoopFlag = false;
+
+		// economizer lockout changed since the air loop was last simulated
+		DataAirLoop::AirLoopControlInfo( 1 ).EconoLockout = true;
+		SetAirLoopPartitionSkipFlags( false );
+		EXPECT_FALSE( AirLoopPartitionSkip( 1 ) );
+		AirLoopEconoLockoutLast( 1 ) = true;
+		SetAirLoopPartitionSkipFlags( false );
+		EXPECT_TRUE( AirLoopPartitionSkip( 1 ) );
+
+		// the first HVAC iteration of the next system timestep starts the count again
+		SetAirLoopPartitionSkipFlags( true );
+		EXPECT_FALSE( AirLoopPartitionSkip( 1 ) );
+		EXPECT_EQ( 0, AirLoopSimCount( 1 ) );
+
+		DataSystemVariables::SkipConvergedAirLoops = false;
+	}
+
 }
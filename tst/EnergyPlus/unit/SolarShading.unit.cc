@@ -61,11 +61,16 @@
 // Google Test Headers
 #include <gtest/gtest.h>
 
+// ObjexxFCL Headers
+#include <ObjexxFCL/member.functions.hh>
+
 // EnergyPlus Headers
 #include <EnergyPlus/SolarShading.hh>
 #include <EnergyPlus/DataBSDFWindow.hh>
+#include <EnergyPlus/DataEnvironment.hh>
 #include <EnergyPlus/DataGlobals.hh>
 #include <EnergyPlus/DataHeatBalance.hh>
+#include <EnergyPlus/DataShadowingCombinations.hh>
 #include <EnergyPlus/DataSurfaces.hh>
 #include <EnergyPlus/DataSystemVariables.hh>
 #include <EnergyPlus/UtilityRoutines.hh>
@@ -298,3 +303,150 @@ TEST_F( EnergyPlusFixture, SolarShadingTest_polygon_contains_point )
 	EXPECT_FALSE( polygon_contains_point( numSides, Rectangle3d, PointOutside, true, false, false ) );
 
 }
+
+TEST_F( EnergyPlusFixture, SolarShadingTest_DetermineShadowingCombinations )
+{
+	// Casting surface lists must match a check of every surface pair with CHKGSS
+
+	using DataEnvironment::IgnoreSolarRadiation;
+	using DataShadowingCombinations::ShadowComb;
+
+	int const NumSurf( 240 );
+	unsigned int Seed( 12345u );
+	auto const random = [&Seed]() -> Real64 { Seed = 1103515245u * Seed + 12345u; return ( ( Seed >> 8 ) & 0xFFFFu ) / 65535.0; };
+
+	TotSurfaces = NumSurf;
+	Surface.allocate( TotSurfaces );
+	for ( int SurfNum = 1; SurfNum <= TotSurfaces; ++SurfNum ) {
+		auto & surface( Surface( SurfNum ) );
+		Real64 const Angle( 2.0 * Pi * random() );
+		Vector const Center( 100.0 * random(), 100.0 * random(), 20.0 * random() );
+		Vector const Right( 4.0 * -std::sin( Angle ), 4.0 * std::cos( Angle ), 0.0 );
+		Vector Up( 0.0, 0.0, 3.0 );
+		if ( SurfNum % 7 == 0 ) { // Horizontal facing down (overhang)
+			Up = Vector( 3.0 * std::cos( Angle ), 3.0 * std::sin( Angle ), 0.0 );
+		} else if ( SurfNum % 11 == 0 ) { // Horizontal facing up (roof)
+			Up = Vector( -3.0 * std::cos( Angle ), -3.0 * std::sin( Angle ), 0.0 );
+		} else if ( SurfNum % 5 == 0 ) { // Tilted
+			Up = Vector( 1.5 * std::cos( Angle ), 1.5 * std::sin( Angle ), 2.5 );
+		}
+		surface.Name = "SURFACE " + std::to_string( SurfNum );
+		surface.Sides = 4;
+		surface.Vertex.dimension( 4 );
+		surface.Vertex( 1 ) = Center - 0.5 * Right + 0.5 * Up;
+		surface.Vertex( 2 ) = Center - 0.5 * Right - 0.5 * Up;
+		surface.Vertex( 3 ) = Center + 0.5 * Right - 0.5 * Up;
+		surface.Vertex( 4 ) = Center + 0.5 * Right + 0.5 * Up;
+		Vector const Normal( cross( Right, Up ).normalize() );
+		surface.OutNormVec( 1 ) = Normal.x;
+		surface.OutNormVec( 2 ) = Normal.y;
+		surface.OutNormVec( 3 ) = Normal.z;
+		if ( SurfNum % 3 == 0 ) { // Exterior wall
+			surface.HeatTransSurf = true;
+			surface.ExtSolar = true;
+			surface.BaseSurf = SurfNum;
+			surface.ExtBoundCond = ExternalEnvironment;
+			surface.Zone = 1;
+			surface.Class = SurfaceClass_Wall;
+		} else { // Detached shading
+			surface.ShadowingSurf = true;
+			surface.BaseSurf = 0;
+			surface.Class = SurfaceClass_Detached_B;
+		}
+	}
+	// Attached shading of a wall and a mirrored pair of detached shading surfaces
+	Surface( 2 ).ShadowingSurf = false;
+	Surface( 2 ).BaseSurf = 3;
+	Surface( 2 ).Class = SurfaceClass_Shading;
+	Surface( 5 ).MirroredSurf = true;
+
+	SolarDistribution = FullExterior;
+	IgnoreSolarRadiation = false;
+	DetermineShadowingCombinations();
+
+	int NumWithCasters( 0 );
+	for ( int GRSNR = 1; GRSNR <= TotSurfaces; ++GRSNR ) {
+		bool const ShadowingSurf( Surface( GRSNR ).ShadowingSurf );
+		if ( ! ShadowingSurf && ( ! Surface( GRSNR ).HeatTransSurf || ! Surface( GRSNR ).ExtSolar || Surface( GRSNR ).BaseSurf != GRSNR ) ) {
+			EXPECT_FALSE( ShadowComb( GRSNR ).UseThisSurf );
+			continue;
+		}
+		Real64 const ZMIN( minval( Surface( GRSNR ).Vertex, &Vector::z ) );
+		std::vector< int > Expected;
+		for ( int GSSNR = 1; GSSNR <= TotSurfaces; ++GSSNR ) {
+			if ( GSSNR == GRSNR ) continue;
+			if ( Surface( GSSNR ).HeatTransSurf && ( Surface( GSSNR ).BaseSurf == GRSNR ) ) continue;
+			if ( ShadowingSurf && ( ( ( GSSNR == GRSNR + 1 ) && Surface( GSSNR ).MirroredSurf ) || ( ( GSSNR == GRSNR - 1 ) && Surface( GRSNR ).MirroredSurf ) ) ) continue;
+			if ( Surface( GSSNR ).BaseSurf == GRSNR ) {
+				Expected.push_back( GSSNR );
+			} else if ( ( Surface( GSSNR ).BaseSurf == 0 ) || ( ( Surface( GSSNR ).BaseSurf == GSSNR ) && ( ( Surface( GSSNR ).ExtBoundCond == ExternalEnvironment ) || ( Surface( GSSNR ).ExtBoundCond == OtherSideCondModeledExt ) ) ) ) {
+				bool CannotShade( true );
+				CHKGSS( GRSNR, GSSNR, ZMIN, CannotShade );
+				if ( ! CannotShade ) Expected.push_back( GSSNR );
+			}
+		}
+		EXPECT_TRUE( ShadowComb( GRSNR ).UseThisSurf );
+		ASSERT_EQ( int( Expected.size() ), ShadowComb( GRSNR ).NumGenSurf );
+		for ( int i = 1; i <= ShadowComb( GRSNR ).NumGenSurf; ++i ) {
+			EXPECT_EQ( Expected[ i - 1 ], ShadowComb( GRSNR ).GenSurf( i ) );
+		}
+		if ( ! Expected.empty() ) ++NumWithCasters;
+	}
+	EXPECT_GT( NumWithCasters, 0 );
+
+	ShadowComb.deallocate();
+	Surface.deallocate();
+}
+
+TEST_F( EnergyPlusFixture, SolarShadingTest_DeterminePolygonOverlap )
+{
+	// Overlap of unit squares in homogeneous coordinates, including figures whose bounding boxes are separated
+
+	SutherlandHodgman = true;
+	HCA.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
+	HCB.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
+	HCC.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
+	HCX.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
+	HCY.dimension( 2 * MaxHCS, MaxHCV + 1, 0 );
+	HCAREA.dimension( 2 * MaxHCS, 0.0 );
+	HCNV.dimension( 2 * MaxHCS, 0 );
+	HCT.dimension( 2 * MaxHCS, 0.0 );
+	MAXHCArrayBounds = 2 * ( MaxVerticesPerSurface + 1 );
+	MAXHCArrayIncrement = MaxVerticesPerSurface + 1;
+	XTEMP.dimension( MAXHCArrayBounds, 0.0 );
+	YTEMP.dimension( MAXHCArrayBounds, 0.0 );
+	ATEMP.dimension( MAXHCArrayBounds, 0.0 );
+	BTEMP.dimension( MAXHCArrayBounds, 0.0 );
+	CTEMP.dimension( MAXHCArrayBounds, 0.0 );
+	XTEMP1.dimension( MAXHCArrayBounds, 0.0 );
+	YTEMP1.dimension( MAXHCArrayBounds, 0.0 );
+	XVS.dimension( MaxVerticesPerSurface + 1, 0.0 );
+	YVS.dimension( MaxVerticesPerSurface + 1, 0.0 );
+
+	// Clockwise unit square with its lower left corner at ( X0, Y0 )
+	auto const setSquare = []( int const NS, Real64 const X0, Real64 const Y0 ) {
+		XVS( 1 ) = X0;
+		YVS( 1 ) = Y0;
+		XVS( 2 ) = X0;
+		YVS( 2 ) = Y0 + 1.0;
+		XVS( 3 ) = X0 + 1.0;
+		YVS( 3 ) = Y0 + 1.0;
+		XVS( 4 ) = X0 + 1.0;
+		YVS( 4 ) = Y0;
+		HTRANS1( NS, 4 );
+	};
+
+	setSquare( 1, 0.0, 0.0 );
+	setSquare( 2, 0.5, 0.5 );
+	DeterminePolygonOverlap( 1, 2, 3 );
+	EXPECT_EQ( PartialOverlap, OverlapStatus );
+	EXPECT_NEAR( 0.25, std::abs( HCAREA( 3 ) ), 1.0e-6 );
+
+	setSquare( 2, 2.0, 0.5 );
+	DeterminePolygonOverlap( 1, 2, 3 );
+	EXPECT_EQ( NoOverlap, OverlapStatus );
+
+	setSquare( 2, 0.5, -1.5 );
+	DeterminePolygonOverlap( 1, 2, 3 );
+	EXPECT_EQ( NoOverlap, OverlapStatus );
+}
@@ -757,5 +757,225 @@ TEST_F( EnergyPlusFixture, SurfaceGeometry_MakeMirrorSurface )
 
 }
 
+TEST_F( EnergyPlusFixture, SurfaceGeometry_GetSurfaceDataMatchesNames )
+{
+
+	// Base surfaces, interzone partners and added "iz-" surfaces are all resolved by name in GetSurfaceData
+
+	bool ErrorsFound( false );
+
+	std::string const idf_objects = delimited_string({
+		"Version,",
+		"    8.4;                     !- Version Identifier",
+
+		" FenestrationSurface:Detailed,",
+		"    WIN-B,                   !- Name",
+		"    Window,                  !- Surface Type",
+		"    SINGLE PANE HW WINDOW,   !- Construction Name",
+		"    WALL-B,                  !- Building Surface Name",
+		"    ,                        !- Outside Boundary Condition Object",
+		"    0.5,                     !- View Factor to Ground",
+		"    ,                        !- Shading Control Name",
+		"    ,                        !- Frame and Divider Name",
+		"    1.0,                     !- Multiplier",
+		"    4,                       !- Number of Vertices",
+		"    6.0, 1.0, 2.0,           !- X,Y,Z ==> Vertex 1 {m}",
+		"    6.0, 1.0, 1.0,           !- X,Y,Z ==> Vertex 2 {m}",
+		"    6.0, 2.0, 1.0,           !- X,Y,Z ==> Vertex 3 {m}",
+		"    6.0, 2.0, 2.0;           !- X,Y,Z ==> Vertex 4 {m}",
+
+		" BuildingSurface:Detailed,",
+		"    WALL-AB,                 !- Name",
+		"    Wall,                    !- Surface Type",
+		"    INT-WALL-1,              !- Construction Name",
+		"    ZONE A,                  !- Zone Name",
+		"    Surface,                 !- Outside Boundary Condition",
+		"    WALL-BA,                 !- Outside Boundary Condition Object",
+		"    NoSun,                   !- Sun Exposure",
+		"    NoWind,                  !- Wind Exposure",
+		"    0.0,                     !- View Factor to Ground",
+		"    4,                       !- Number of Vertices",
+		"    3.0, 0.0, 3.0,           !- X,Y,Z ==> Vertex 1 {m}",
+		"    3.0, 0.0, 0.0,           !- X,Y,Z ==> Vertex 2 {m}",
+		"    3.0, 3.0, 0.0,           !- X,Y,Z ==> Vertex 3 {m}",
+		"    3.0, 3.0, 3.0;           !- X,Y,Z ==> Vertex 4 {m}",
+
+		" BuildingSurface:Detailed,",
+		"    WALL-BA,                 !- Name",
+		"    Wall,                    !- Surface Type",
+		"    INT-WALL-1,              !- Construction Name",
+		"    ZONE B,                  !- Zone Name",
+		"    Surface,                 !- Outside Boundary Condition",
+		"    WALL-AB,                 !- Outside Boundary Condition Object",
+		"    NoSun,                   !- Sun Exposure",
+		"    NoWind,                  !- Wind Exposure",
+		"    0.0,                     !- View Factor to Ground",
+		"    4,                       !- Number of Vertices",
+		"    3.0, 3.0, 3.0,           !- X,Y,Z ==> Vertex 1 {m}",
+		"    3.0, 3.0, 0.0,           !- X,Y,Z ==> Vertex 2 {m}",
+		"    3.0, 0.0, 0.0,           !- X,Y,Z ==> Vertex 3 {m}",
+		"    3.0, 0.0, 3.0;           !- X,Y,Z ==> Vertex 4 {m}",
 
+		" BuildingSurface:Detailed,",
+		"    WALL-AC,                 !- Name",
+		"    Wall,                    !- Surface Type",
+		"    INT-WALL-1,              !- Construction Name",
+		"    ZONE A,                  !- Zone Name",
+		"    Zone,                    !- Outside Boundary Condition",
+		"    ZONE C,                  !- Outside Boundary Condition Object",
+		"    NoSun,                   !- Sun Exposure",
+		"    NoWind,                  !- Wind Exposure",
+		"    0.0,                     !- View Factor to Ground",
+		"    4,                       !- Number of Vertices",
+		"    0.0, 0.0, 3.0,           !- X,Y,Z ==> Vertex 1 {m}",
+		"    0.0, 0.0, 0.0,           !- X,Y,Z ==> Vertex 2 {m}",
+		"    3.0, 0.0, 0.0,           !- X,Y,Z ==> Vertex 3 {m}",
+		"    3.0, 0.0, 3.0;           !- X,Y,Z ==> Vertex 4 {m}",
+
+		" BuildingSurface:Detailed,",
+		"    WALL-B,                  !- Name",
+		"    Wall,                    !- Surface Type",
+		"    INT-WALL-1,              !- Construction Name",
+		"    ZONE B,                  !- Zone Name",
+		"    Outdoors,                !- Outside Boundary Condition",
+		"    ,                        !- Outside Boundary Condition Object",
+		"    SunExposed,              !- Sun Exposure",
+		"    WindExposed,             !- Wind Exposure",
+		"    0.5,                     !- View Factor to Ground",
+		"    4,                       !- Number of Vertices",
+		"    6.0, 0.0, 3.0,           !- X,Y,Z ==> Vertex 1 {m}",
+		"    6.0, 0.0, 0.0,           !- X,Y,Z ==> Vertex 2 {m}",
+		"    6.0, 3.0, 0.0,           !- X,Y,Z ==> Vertex 3 {m}",
+		"    6.0, 3.0, 3.0;           !- X,Y,Z ==> Vertex 4 {m}",
+
+		" FenestrationSurface:Detailed,",
+		"    WIN-AC,                  !- Name",
+		"    Window,                  !- Surface Type",
+		"    SINGLE PANE HW WINDOW,   !- Construction Name",
+		"    WALL-AC,                 !- Building Surface Name",
+		"    ,                        !- Outside Boundary Condition Object",
+		"    0.0,                     !- View Factor to Ground",
+		"    ,                        !- Shading Control Name",
+		"    ,                        !- Frame and Divider Name",
+		"    1.0,                     !- Multiplier",
+		"    4,                       !- Number of Vertices",
+		"    1.0, 0.0, 2.0,           !- X,Y,Z ==> Vertex 1 {m}",
+		"    1.0, 0.0, 1.0,           !- X,Y,Z ==> Vertex 2 {m}",
+		"    2.0, 0.0, 1.0,           !- X,Y,Z ==> Vertex 3 {m}",
+		"    2.0, 0.0, 2.0;           !- X,Y,Z ==> Vertex 4 {m}",
+
+		" Zone,",
+		"    ZONE A;                  !- Name",
+
+		" Zone,",
+		"    ZONE B;                  !- Name",
+
+		" Zone,",
+		"    ZONE C;                  !- Name",
+
+		" Construction,",
+		"    INT-WALL-1,              !- Name",
+		"    GP02;                    !- Outside Layer",
 
+		" Material,",
+		"    GP02,                    !- Name",
+		"    MediumSmooth,            !- Roughness",
+		"    1.5900001E-02,           !- Thickness {m}",
+		"    0.1600000,               !- Conductivity {W/m-K}",
+		"    801.0000,                !- Density {kg/m3}",
+		"    837.0000,                !- Specific Heat {J/kg-K}",
+		"    0.9000000,               !- Thermal Absorptance",
+		"    0.7500000,               !- Solar Absorptance",
+		"    0.7500000;               !- Visible Absorptance",
+
+		" Construction,",
+		"    SINGLE PANE HW WINDOW,   !- Name",
+		"    GLASS - CLEAR PLATE 1 / 4 IN;  !- Outside Layer",
+
+		" WindowMaterial:Glazing,",
+		"    GLASS - CLEAR PLATE 1 / 4 IN,  !- Name",
+		"    SpectralAverage,         !- Optical Data Type",
+		"    ,                        !- Window Glass Spectral Data Set Name",
+		"    6.0000001E-03,           !- Thickness {m}",
+		"    0.7750000,               !- Solar Transmittance at Normal Incidence",
+		"    7.1000002E-02,           !- Front Side Solar Reflectance at Normal Incidence",
+		"    7.1000002E-02,           !- Back Side Solar Reflectance at Normal Incidence",
+		"    0.8810000,               !- Visible Transmittance at Normal Incidence",
+		"    7.9999998E-02,           !- Front Side Visible Reflectance at Normal Incidence",
+		"    7.9999998E-02,           !- Back Side Visible Reflectance at Normal Incidence",
+		"    0,                       !- Infrared Transmittance at Normal Incidence",
+		"    0.8400000,               !- Front Side Infrared Hemispherical Emissivity",
+		"    0.8400000,               !- Back Side Infrared Hemispherical Emissivity",
+		"    0.9000000;               !- Conductivity {W/m-K}",
+
+		"SurfaceConvectionAlgorithm:Inside,TARP;",
+
+		"SurfaceConvectionAlgorithm:Outside,DOE-2;",
+
+		"HeatBalanceAlgorithm,ConductionTransferFunction;",
+
+		"ZoneAirHeatBalanceAlgorithm,",
+		"    AnalyticalSolution;      !- Algorithm",
+
+		});
+
+	ASSERT_FALSE( process_idf( idf_objects ) );
+
+	GetProjectControlData( ErrorsFound ); // read project control data
+	EXPECT_FALSE( ErrorsFound ); // expect no errors
+
+	GetMaterialData( ErrorsFound ); // read material data
+	EXPECT_FALSE( ErrorsFound ); // expect no errors
+
+	GetConstructData( ErrorsFound ); // read construction data
+	EXPECT_FALSE( ErrorsFound ); // expect no errors
+
+	GetZoneData( ErrorsFound ); // read zone data
+	EXPECT_FALSE( ErrorsFound ); // expect no errors
+	ASSERT_EQ( 3, DataGlobals::NumOfZones );
+
+	CosZoneRelNorth.allocate( DataGlobals::NumOfZones );
+	SinZoneRelNorth.allocate( DataGlobals::NumOfZones );
+	for ( int ZoneNum = 1; ZoneNum <= DataGlobals::NumOfZones; ++ZoneNum ) {
+		CosZoneRelNorth( ZoneNum ) = std::cos( -Zone( ZoneNum ).RelNorth * DataGlobals::DegToRadians );
+		SinZoneRelNorth( ZoneNum ) = std::sin( -Zone( ZoneNum ).RelNorth * DataGlobals::DegToRadians );
+	}
+	CosBldgRelNorth = 1.0;
+	SinBldgRelNorth = 0.0;
+
+	GetSurfaceData( ErrorsFound ); // setup zone geometry and get zone data
+	EXPECT_FALSE( ErrorsFound ); // expect no errors
+
+	// Surfaces are reordered by zone with each subsurface after its base surface, and the
+	// "iz-" surfaces added for the unentered adjacent zone surface and its window go in ZONE C
+	ASSERT_EQ( 8, TotSurfaces );
+	EXPECT_EQ( "WALL-AB", Surface( 1 ).Name );
+	EXPECT_EQ( "WALL-AC", Surface( 2 ).Name );
+	EXPECT_EQ( "WIN-AC", Surface( 3 ).Name );
+	EXPECT_EQ( "WALL-BA", Surface( 4 ).Name );
+	EXPECT_EQ( "WALL-B", Surface( 5 ).Name );
+	EXPECT_EQ( "WIN-B", Surface( 6 ).Name );
+	EXPECT_EQ( "iz-WALL-AC", Surface( 7 ).Name );
+	EXPECT_EQ( "iz-WIN-AC", Surface( 8 ).Name );
+
+	// Interzone pair
+	EXPECT_EQ( 4, Surface( 1 ).ExtBoundCond );
+	EXPECT_EQ( 1, Surface( 4 ).ExtBoundCond );
+
+	// Unentered adjacent zone surface and its window are matched with their added "iz-" surfaces
+	EXPECT_EQ( 7, Surface( 2 ).ExtBoundCond );
+	EXPECT_EQ( 2, Surface( 7 ).ExtBoundCond );
+	EXPECT_EQ( 8, Surface( 3 ).ExtBoundCond );
+	EXPECT_EQ( 3, Surface( 8 ).ExtBoundCond );
+	EXPECT_EQ( 2, Surface( 3 ).BaseSurf );
+	EXPECT_EQ( 7, Surface( 7 ).BaseSurf );
+	EXPECT_EQ( 7, Surface( 8 ).BaseSurf );
+	EXPECT_EQ( 3, Surface( 7 ).Zone );
+	EXPECT_EQ( 3, Surface( 8 ).Zone );
+
+	// Window entered before its base surface
+	EXPECT_EQ( 5, Surface( 6 ).BaseSurf );
+	EXPECT_EQ( 2, Surface( 6 ).Zone );
+	EXPECT_EQ( ExternalEnvironment, Surface( 6 ).ExtBoundCond );
+
+}
@@ -443,3 +443,58 @@ TEST( SurfaceOctreeTest, Composite )
 	Surface.deallocate();
 	TotSurfaces = 0;
 }
+
+TEST( SurfaceOctreeTest, Nearest )
+{
+	// Surfaces: Row of small squares normal to the x axis at x = 0, 1, ..., 39 plus one off the row
+	TotSurfaces = 41;
+	SurfaceData surface;
+	surface.Area = 0.04;
+	surface.Sides = 4;
+	surface.Vertex.dimension( 4 );
+	Surface.dimension( TotSurfaces, surface );
+	for ( int i = 1; i <= 40; ++i ) {
+		Real64 const x( i - 1 );
+		Surface( i ).Vertex = { Vertex(x,0.1,0.1), Vertex(x,0.3,0.1), Vertex(x,0.3,0.3), Vertex(x,0.1,0.3) };
+	}
+	Surface( 41 ).Vertex = { Vertex(39,2.0,2.0), Vertex(39,2.2,2.0), Vertex(39,2.2,2.2), Vertex(39,2.0,2.2) };
+
+	// Surface octree of the squares at odd x and the one off the row
+	Surfaces selected;
+	for ( int i = 2; i <= 40; i += 2 ) selected.push_back( &Surface( i ) );
+	selected.push_back( &Surface( 41 ) );
+	SurfaceOctreeCube cube;
+	cube.init( selected );
+	EXPECT_LT( 0u, cube.nSubCube() );
+
+	{ // Entry distance
+		Vertex const a( -2.0, 0.2, 0.2 ), dir( 1.0, 0.0, 0.0 ), dir_inv( SurfaceOctreeCube::safe_inverse( dir ) );
+		Real64 t( -1.0 );
+		EXPECT_TRUE( cube.rayIntersectsCube( a, dir, dir_inv, t ) );
+		EXPECT_DOUBLE_EQ( 3.0, t ); // Cube spans x = [1,39]
+	}
+
+	{ // Nearest hit along +x from x = -2
+		Vertex const a( -2.0, 0.2, 0.2 ), dir( 1.0, 0.0, 0.0 ), dir_inv( SurfaceOctreeCube::safe_inverse( dir ) );
+		SurfaceData const * nearest( nullptr );
+		Real64 nearestDistance( std::numeric_limits< Real64 >::max() );
+		std::size_t nVisited( 0u );
+		auto surfaceHit = [&]( SurfaceData const & surface ) {
+			++nVisited;
+			if ( ( a.y < surface.Vertex( 1 ).y ) || ( surface.Vertex( 3 ).y < a.y ) ) return; // Missed
+			Real64 const distance( surface.Vertex( 1 ).x - a.x );
+			if ( distance < nearestDistance ) {
+				nearestDistance = distance;
+				nearest = &surface;
+			}
+		};
+		cube.processSurfaceRayIntersectsCubeNearest( a, dir, dir_inv, nearestDistance, surfaceHit );
+		EXPECT_EQ( &Surface( 2 ), nearest );
+		EXPECT_DOUBLE_EQ( 3.0, nearestDistance );
+		EXPECT_LT( nVisited, selected.size() ); // Cubes beyond the nearest hit were skipped
+	}
+
+	// Clean up
+	Surface.deallocate();
+	TotSurfaces = 0;
+}
@@ -0,0 +1,256 @@
+// EnergyPlus, Copyright (c) 1996-2016, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// If you have questions about your rights to use or distribute this software, please contact
+// Berkeley Lab's Innovation & Partnerships Office at IPO@lbl.gov.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without Lawrence Berkeley National Laboratory's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// You are under no obligation whatsoever to provide any bug fixes, patches, or upgrades to the
+// features, functionality or performance of the source code ("Enhancements") to anyone; however,
+// if you choose to make your Enhancements available either publicly, or directly to Lawrence
+// Berkeley National Laboratory, without imposing a separate written license agreement for such
+// Enhancements, then you hereby grant the following license: a non-exclusive, royalty-free
+// perpetual license to install, use, modify, prepare derivative works, incorporate into other
+// computer software, distribute, and sublicense such enhancements or derivative works thereof,
+// in binary and source code form.
+
+// EnergyPlus::TARCOGMain Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// C++ Headers
+#include <string>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array1D.hh>
+#include <ObjexxFCL/Array2D.hh>
+
+// EnergyPlus Headers
+#include "Fixtures/EnergyPlusFixture.hh"
+#include <EnergyPlus/TARCOGGassesParams.hh>
+#include <EnergyPlus/TARCOGMain.hh>
+#include <EnergyPlus/TARCOGParams.hh>
+
+using namespace EnergyPlus::TARCOGMain;
+using namespace EnergyPlus::TARCOGParams;
+using namespace EnergyPlus::TARCOGGassesParams;
+using namespace ObjexxFCL;
+
+namespace EnergyPlus {
+
+	TEST_F( EnergyPlusFixture, TARCOGMain_DoubleGlazingArgonWinter )
+	{
+		// Regression values for double glazing, 3 mm clear glass with a low-e coating on surface 3 and a 12.7 mm
+		// gap of 10% air and 90% argon, at ISO 15099 winter conditions.  The values are the same before and after
+		// the TARCOG work arrays and gas mixture terms were reused; a second call checks that nothing carries over.
+		int const nlayer( 2 );
+		int iwd( 0 );
+		Real64 tout( 255.15 );
+		Real64 tind( 294.15 );
+		Real64 trmin( 294.15 );
+		Real64 wso( 5.5 );
+		Real64 wsi( 0.0 );
+		Real64 dir( 0.0 );
+		Real64 outir( 0.0 );
+		int isky( 0 );
+		Real64 tsky( 255.15 );
+		Real64 esky( 1.0 );
+		Real64 fclr( 1.0 );
+		Real64 VacuumPressure( 13.238 );
+		Real64 VacuumMaxGapThickness( 0.0 );
+		int CalcDeflection( 0 );
+		Real64 Pa( 101325.0 );
+		Real64 Pini( 101325.0 );
+		Real64 Tini( 293.15 );
+		Array1D< Real64 > gap( maxlay, 0.0 );
+		Array1D< Real64 > GapDefMax( MaxGap, 0.0 );
+		Array1D< Real64 > thick( maxlay, 0.0 );
+		Array1D< Real64 > scon( maxlay, 0.0 );
+		Array1D< Real64 > YoungsMod( maxlay, 0.0 );
+		Array1D< Real64 > PoissonsRat( maxlay, 0.0 );
+		Array1D< Real64 > tir( maxlay2, 0.0 );
+		Array1D< Real64 > emis( maxlay2, 0.0 );
+		Real64 totsol( 0.0 );
+		Real64 tilt( 90.0 );
+		Array1D< Real64 > asol( maxlay, 0.0 );
+		Real64 height( 1.0 );
+		Real64 heightt( 1.0 );
+		Real64 width( 1.0 );
+		Array1D< Real64 > presure( maxlay1, 101325.0 );
+		Array2D_int iprop( maxgas, maxlay1, 1 );
+		Array2D< Real64 > frct( maxgas, maxlay1, 0.0 );
+		Array2D< Real64 > gcon( 3, maxgas, 0.0 );
+		Array2D< Real64 > gvis( 3, maxgas, 0.0 );
+		Array2D< Real64 > gcp( 3, maxgas, 0.0 );
+		Array1D< Real64 > wght( maxgas, 0.0 );
+		Array1D< Real64 > gama( maxgas, 0.0 );
+		Array1D_int nmix( maxlay1, 0 );
+		Array1D_int SupportPlr( maxlay, 0 );
+		Array1D< Real64 > PillarSpacing( maxlay, 0.0 );
+		Array1D< Real64 > PillarRadius( maxlay, 0.0 );
+		Array1D< Real64 > theta( maxlay2, 273.15 );
+		Array1D< Real64 > LayerDef( maxlay, 0.0 );
+		Array1D< Real64 > q( maxlay3, 0.0 );
+		Array1D< Real64 > qv( maxlay1, 0.0 );
+		Real64 ufactor( 0.0 );
+		Real64 sc( 0.0 );
+		Real64 hflux( 0.0 );
+		Real64 hcin( 0.0 );
+		Real64 hcout( 26.0 );
+		Real64 hrin( 0.0 );
+		Real64 hrout( 0.0 );
+		Real64 hin( 0.0 );
+		Real64 hout( 0.0 );
+		Array1D< Real64 > hcgap( maxlay1, 0.0 );
+		Array1D< Real64 > hrgap( maxlay1, 0.0 );
+		Real64 shgc( 0.0 );
+		int nperr( 0 );
+		std::string ErrorMessage;
+		Real64 shgct( 0.0 );
+		Real64 tamb( 0.0 );
+		Real64 troom( 0.0 );
+		Array1D_int ibc( 2, 0 );
+		Array1D< Real64 > Atop( maxlay, 0.0 );
+		Array1D< Real64 > Abot( maxlay, 0.0 );
+		Array1D< Real64 > Al( maxlay, 0.0 );
+		Array1D< Real64 > Ar( maxlay, 0.0 );
+		Array1D< Real64 > Ah( maxlay, 0.0 );
+		Array1D< Real64 > SlatThick( maxlay, 0.0 );
+		Array1D< Real64 > SlatWidth( maxlay, 0.0 );
+		Array1D< Real64 > SlatAngle( maxlay, 0.0 );
+		Array1D< Real64 > SlatCond( maxlay, 0.0 );
+		Array1D< Real64 > SlatSpacing( maxlay, 0.0 );
+		Array1D< Real64 > SlatCurve( maxlay, 0.0 );
+		Array1D< Real64 > vvent( maxlay1, 0.0 );
+		Array1D< Real64 > tvent( maxlay1, 0.0 );
+		Array1D_int LayerType( maxlay, SPECULAR );
+		Array1D_int nslice( maxlay, 0 );
+		Array1D< Real64 > LaminateA( maxlay, 0.0 );
+		Array1D< Real64 > LaminateB( maxlay, 0.0 );
+		Array1D< Real64 > sumsol( maxlay, 0.0 );
+		Array1D< Real64 > hg( maxlay, 0.0 );
+		Array1D< Real64 > hr( maxlay, 0.0 );
+		Array1D< Real64 > hs( maxlay, 0.0 );
+		Real64 he( 0.0 );
+		Real64 hi( 0.0 );
+		Array1D< Real64 > Ra( maxlay1, 0.0 );
+		Array1D< Real64 > Nu( maxlay1, 0.0 );
+		Real64 ShadeEmisRatioOut( 0.0 );
+		Real64 ShadeEmisRatioIn( 0.0 );
+		Real64 ShadeHcRatioOut( 0.0 );
+		Real64 ShadeHcRatioIn( 0.0 );
+		Real64 HcUnshadedOut( 0.0 );
+		Real64 HcUnshadedIn( 0.0 );
+		Array1D< Real64 > Keff( maxlay, 0.0 );
+		Array1D< Real64 > ShadeGapKeffConv( MaxGap, 0.0 );
+		int NumOfIterations( 0 );
+
+		thick( 1 ) = 0.003;
+		thick( 2 ) = 0.003;
+		scon( 1 ) = 1.0;
+		scon( 2 ) = 1.0;
+		emis( 1 ) = 0.84;
+		emis( 2 ) = 0.84;
+		emis( 3 ) = 0.1;
+		emis( 4 ) = 0.84;
+		gap( 1 ) = 0.0127;
+
+		// air (1) outdoors and indoors, 10% air and 90% argon (2) in the gap
+		nmix( 1 ) = 1;
+		frct( 1, 1 ) = 1.0;
+		nmix( 2 ) = 2;
+		iprop( 2, 2 ) = 2;
+		frct( 1, 2 ) = 0.1;
+		frct( 2, 2 ) = 0.9;
+		nmix( 3 ) = 1;
+		frct( 1, 3 ) = 1.0;
+		gcon( 1, 1 ) = 2.873e-3;
+		gcon( 2, 1 ) = 7.760e-5;
+		gvis( 1, 1 ) = 3.723e-6;
+		gvis( 2, 1 ) = 4.940e-8;
+		gcp( 1, 1 ) = 1002.737;
+		gcp( 2, 1 ) = 1.2324e-2;
+		wght( 1 ) = 28.97;
+		gama( 1 ) = 1.4;
+		gcon( 1, 2 ) = 2.285e-3;
+		gcon( 2, 2 ) = 5.149e-5;
+		gvis( 1, 2 ) = 3.379e-6;
+		gvis( 2, 2 ) = 6.451e-8;
+		gcp( 1, 2 ) = 521.929;
+		wght( 2 ) = 39.948;
+		gama( 2 ) = 1.67;
+
+		TARCOG90( nlayer, iwd, tout, tind, trmin, wso, wsi, dir, outir, isky, tsky, esky, fclr, VacuumPressure, VacuumMaxGapThickness, CalcDeflection, Pa, Pini, Tini, gap, GapDefMax, thick, scon, YoungsMod, PoissonsRat, tir, emis, totsol, tilt, asol, height, heightt, width, presure, iprop, frct, gcon, gvis, gcp, wght, gama, nmix, SupportPlr, PillarSpacing, PillarRadius, theta, LayerDef, q, qv, ufactor, sc, hflux, hcin, hcout, hrin, hrout, hin, hout, hcgap, hrgap, shgc, nperr, ErrorMessage, shgct, tamb, troom, ibc, Atop, Abot, Al, Ar, Ah, SlatThick, SlatWidth, SlatAngle, SlatCond, SlatSpacing, SlatCurve, vvent, tvent, LayerType, nslice, LaminateA, LaminateB, sumsol, hg, hr, hs, he, hi, Ra, Nu, ISO15099, THERM_MOD_ISO15099, noDebug, "", "Test", -1, -1, ShadeEmisRatioOut, ShadeEmisRatioIn, ShadeHcRatioOut, ShadeHcRatioIn, HcUnshadedOut, HcUnshadedIn, Keff, ShadeGapKeffConv, 0.0, 0, NumOfIterations );
+
+		EXPECT_EQ( 0, nperr );
+		EXPECT_EQ( 8, NumOfIterations );
+		EXPECT_NEAR( 1.55054177476, ufactor, 1.0e-9 );
+		EXPECT_NEAR( 60.4711292157, hflux, 1.0e-8 );
+		EXPECT_NEAR( 2.4790936585, hcin, 1.0e-9 );
+		EXPECT_NEAR( 4.65452472233, hrin, 1.0e-9 );
+		EXPECT_NEAR( 3.20558108538, hrout, 1.0e-9 );
+		EXPECT_NEAR( 257.218172218, theta( 1 ), 1.0e-8 );
+		EXPECT_NEAR( 257.399199656, theta( 2 ), 1.0e-8 );
+		EXPECT_NEAR( 285.492050194, theta( 3 ), 1.0e-8 );
+		EXPECT_NEAR( 285.673077632, theta( 4 ), 1.0e-8 );
+		EXPECT_NEAR( 1.70270946546, hcgap( 2 ), 1.0e-9 );
+		EXPECT_NEAR( 0.445930458828, hrgap( 2 ), 1.0e-9 );
+		EXPECT_NEAR( 10117.6771791, Ra( 1 ), 1.0e-5 );
+		EXPECT_NEAR( 1.27420855504, Nu( 1 ), 1.0e-9 );
+		EXPECT_NEAR( 0.0272877270385, Keff( 1 ), 1.0e-11 );
+
+		Real64 const ufactor1( ufactor );
+		Array1D< Real64 > const theta1( theta );
+		theta = 273.15;
+		TARCOG90( nlayer, iwd, tout, tind, trmin, wso, wsi, dir, outir, isky, tsky, esky, fclr, VacuumPressure, VacuumMaxGapThickness, CalcDeflection, Pa, Pini, Tini, gap, GapDefMax, thick, scon, YoungsMod, PoissonsRat, tir, emis, totsol, tilt, asol, height, heightt, width, presure, iprop, frct, gcon, gvis, gcp, wght, gama, nmix, SupportPlr, PillarSpacing, PillarRadius, theta, LayerDef, q, qv, ufactor, sc, hflux, hcin, hcout, hrin, hrout, hin, hout, hcgap, hrgap, shgc, nperr, ErrorMessage, shgct, tamb, troom, ibc, Atop, Abot, Al, Ar, Ah, SlatThick, SlatWidth, SlatAngle, SlatCond, SlatSpacing, SlatCurve, vvent, tvent, LayerType, nslice, LaminateA, LaminateB, sumsol, hg, hr, hs, he, hi, Ra, Nu, ISO15099, THERM_MOD_ISO15099, noDebug, "", "Test", -1, -1, ShadeEmisRatioOut, ShadeEmisRatioIn, ShadeHcRatioOut, ShadeHcRatioIn, HcUnshadedOut, HcUnshadedIn, Keff, ShadeGapKeffConv, 0.0, 0, NumOfIterations );
+		EXPECT_EQ( 0, nperr );
+		EXPECT_DOUBLE_EQ( ufactor1, ufactor );
+		for ( int i = 1; i <= 2 * nlayer; ++i ) {
+			EXPECT_DOUBLE_EQ( theta1( i ), theta( i ) );
+		}
+	}
+
+}
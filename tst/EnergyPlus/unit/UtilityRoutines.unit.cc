@@ -0,0 +1,173 @@
+// EnergyPlus, Copyright (c) 1996-2016, The Board of Trustees of the University of Illinois and
+// The Regents of the University of California, through Lawrence Berkeley National Laboratory
+// (subject to receipt of any required approvals from the U.S. Dept. of Energy). All rights
+// reserved.
+//
+// If you have questions about your rights to use or distribute this software, please contact
+// Berkeley Lab's Innovation & Partnerships Office at IPO@lbl.gov.
+//
+// NOTICE: This Software was developed under funding from the U.S. Department of Energy and the
+// U.S. Government consequently retains certain rights. As such, the U.S. Government has been
+// granted for itself and others acting on its behalf a paid-up, nonexclusive, irrevocable,
+// worldwide license in the Software to reproduce, distribute copies to the public, prepare
+// derivative works, and perform publicly and display publicly, and to permit others to do so.
+//
+// Redistribution and use in source and binary forms, with or without modification, are permitted
+// provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice, this list of
+//     conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//
+// (3) Neither the name of the University of California, Lawrence Berkeley National Laboratory,
+//     the University of Illinois, U.S. Dept. of Energy nor the names of its contributors may be
+//     used to endorse or promote products derived from this software without specific prior
+//     written permission.
+//
+// (4) Use of EnergyPlus(TM) Name. If Licensee (i) distributes the software in stand-alone form
+//     without changes from the version obtained under this License, or (ii) Licensee makes a
+//     reference solely to the software portion of its product, Licensee must refer to the
+//     software as "EnergyPlus version X" software, where "X" is the version number Licensee
+//     obtained under this License and may not use a different name for the software. Except as
+//     specifically required in this Section (4), Licensee shall not use in a company name, a
+//     product name, in advertising, publicity, or other promotional activities any name, trade
+//     name, trademark, logo, or other designation of "EnergyPlus", "E+", "e+" or confusingly
+//     similar designation, without Lawrence Berkeley National Laboratory's prior written consent.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR
+// IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY
+// AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// You are under no obligation whatsoever to provide any bug fixes, patches, or upgrades to the
+// features, functionality or performance of the source code ("Enhancements") to anyone; however,
+// if you choose to make your Enhancements available either publicly, or directly to Lawrence
+// Berkeley National Laboratory, without imposing a separate written license agreement for such
+// Enhancements, then you hereby grant the following license: a non-exclusive, royalty-free
+// perpetual license to install, use, modify, prepare derivative works, incorporate into other
+// computer software, distribute, and sublicense such enhancements or derivative works thereof,
+// in binary and source code form.
+
+// EnergyPlus::UtilityRoutines Unit Tests
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// C++ Headers
+#include <string>
+
+// ObjexxFCL Headers
+#include <ObjexxFCL/Array.functions.hh>
+#include <ObjexxFCL/Array1D.hh>
+
+// EnergyPlus Headers
+#include <EnergyPlus/DataErrorTracking.hh>
+#include <EnergyPlus/UtilityRoutines.hh>
+
+#include "Fixtures/EnergyPlusFixture.hh"
+
+using namespace EnergyPlus;
+using namespace EnergyPlus::DataErrorTracking;
+using namespace ObjexxFCL;
+
+TEST_F( EnergyPlusFixture, UtilityRoutines_RecurringMessageSearchMatches )
+{
+	// The fixture does not reset the error tracking data
+	Array1D< RecurringErrorData > const SaveRecurringErrors( RecurringErrors );
+	int const SaveNumRecurringErrors = NumRecurringErrors;
+	Array1D_int const SaveMatchCounts( MatchCounts );
+	int const SaveTotalWarningErrors = TotalWarningErrors;
+
+	int ZoneHBSearch = 0;
+	for ( int Loop = 1; Loop <= SearchCounts; ++Loop ) {
+		if ( MessageSearch( Loop ) == "Zone Air Heat Balance" ) ZoneHBSearch = Loop;
+	}
+	ASSERT_GT( ZoneHBSearch, 0 );
+	MatchCounts = 0;
+
+	// The matches are found when the message is first stored and counted again on each repeat
+	int MsgIndex = 0;
+	std::string const Message( "Zone Air Heat Balance deviation warning continues..." );
+	ShowRecurringWarningErrorAtEnd( Message, MsgIndex );
+	ASSERT_GT( MsgIndex, 0 );
+	EXPECT_EQ( 1u, RecurringErrors( MsgIndex ).SearchMatches.size() );
+	EXPECT_EQ( ZoneHBSearch, RecurringErrors( MsgIndex ).SearchMatches.front() );
+	EXPECT_EQ( 1, MatchCounts( ZoneHBSearch ) );
+	EXPECT_EQ( 1, sum( MatchCounts ) );
+
+	ShowRecurringWarningErrorAtEnd( Message, MsgIndex );
+	ShowRecurringWarningErrorAtEnd( Message, MsgIndex );
+	EXPECT_EQ( 3, RecurringErrors( MsgIndex ).Count );
+	EXPECT_EQ( 3, MatchCounts( ZoneHBSearch ) );
+	EXPECT_EQ( 3, sum( MatchCounts ) );
+
+	// A message with no search strings counts nothing on any call
+	int OtherIndex = 0;
+	ShowRecurringWarningErrorAtEnd( "Coil outlet temperature warning continues...", OtherIndex );
+	ShowRecurringWarningErrorAtEnd( "Coil outlet temperature warning continues...", OtherIndex );
+	EXPECT_TRUE( RecurringErrors( OtherIndex ).SearchMatches.empty() );
+	EXPECT_EQ( 3, sum( MatchCounts ) );
+
+	RecurringErrors = SaveRecurringErrors;
+	NumRecurringErrors = SaveNumRecurringErrors;
+	MatchCounts = SaveMatchCounts;
+	TotalWarningErrors = SaveTotalWarningErrors;
+}
+
+TEST_F( EnergyPlusFixture, UtilityRoutines_RecurringMessageBuiltOnce )
+{
+	Array1D< RecurringErrorData > const SaveRecurringErrors( RecurringErrors );
+	int const SaveNumRecurringErrors = NumRecurringErrors;
+	Array1D_int const SaveMatchCounts( MatchCounts );
+	int const SaveTotalWarningErrors = TotalWarningErrors;
+	int const SaveTotalSevereErrors = TotalSevereErrors;
+
+	int ZoneHBSearch = 0;
+	for ( int Loop = 1; Loop <= SearchCounts; ++Loop ) {
+		if ( MessageSearch( Loop ) == "Zone Air Heat Balance" ) ZoneHBSearch = Loop;
+	}
+	ASSERT_GT( ZoneHBSearch, 0 );
+	MatchCounts = 0;
+
+	std::string const ZoneName( "SPACE1-1" );
+	int NumBuilds = 0;
+	int MsgIndex = 0;
+	for ( int Call = 1; Call <= 5; ++Call ) {
+		Real64 const Value = Real64( Call );
+		ShowRecurringWarningErrorAtEnd( [&]() { ++NumBuilds; return "Zone Air Heat Balance for " + ZoneName + " warning continues..."; }, MsgIndex, Value, Value );
+	}
+	ASSERT_GT( MsgIndex, 0 );
+	EXPECT_EQ( 1, NumBuilds );
+	EXPECT_EQ( 5, RecurringErrors( MsgIndex ).Count );
+	EXPECT_EQ( " ** Warning ** Zone Air Heat Balance for SPACE1-1 warning continues...", RecurringErrors( MsgIndex ).Message );
+	EXPECT_DOUBLE_EQ( 5.0, RecurringErrors( MsgIndex ).MaxValue );
+	EXPECT_DOUBLE_EQ( 1.0, RecurringErrors( MsgIndex ).MinValue );
+	EXPECT_EQ( 5, MatchCounts( ZoneHBSearch ) );
+
+	// Each recurring message builds its own text once
+	NumBuilds = 0;
+	int SevereIndex = 0;
+	int ContinueIndex = 0;
+	for ( int Call = 1; Call <= 3; ++Call ) {
+		ShowRecurringSevereErrorAtEnd( [&]() { ++NumBuilds; return "Severe for " + ZoneName; }, SevereIndex );
+		ShowRecurringContinueErrorAtEnd( [&]() { ++NumBuilds; return "Continue for " + ZoneName; }, ContinueIndex );
+	}
+	EXPECT_EQ( 2, NumBuilds );
+	EXPECT_NE( SevereIndex, ContinueIndex );
+	EXPECT_EQ( 3, RecurringErrors( SevereIndex ).Count );
+	EXPECT_EQ( 3, RecurringErrors( ContinueIndex ).Count );
+
+	RecurringErrors = SaveRecurringErrors;
+	NumRecurringErrors = SaveNumRecurringErrors;
+	MatchCounts = SaveMatchCounts;
+	TotalWarningErrors = SaveTotalWarningErrors;
+	TotalSevereErrors = SaveTotalSevereErrors;
+}
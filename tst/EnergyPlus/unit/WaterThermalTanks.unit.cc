@@ -1037,3 +1037,151 @@ TEST_F( EnergyPlusFixture, HPWHSizing )
 	EXPECT_EQ( Fans::Fan( 1 ).MaxAirFlowRate, DXCoils::DXCoil( 1 ).RatedAirVolFlowRate( 1 ) );
 
 }
+
+TEST_F( EnergyPlusFixture, StratifiedTankImplicitSolution )
+{
+	using WaterThermalTanks::WaterThermalTank;
+	using WaterThermalTanks::CalcWaterThermalTankStratified;
+	using DataGlobals::HourOfDay;
+	using DataGlobals::TimeStep;
+	using DataGlobals::TimeStepZone;
+	using DataHVACGlobals::SysTimeElapsed;
+	using DataHVACGlobals::TimeStepSys;
+	using FluidProperties::Water;
+
+	std::string const idf_objects = delimited_string({
+		"Version, 8.6;",
+		"Schedule:Constant, Heater1SP,, 55.0;",
+		"Schedule:Constant, Heater2SP,, 40.0;",
+		"Schedule:Constant, AmbientSch,, 23.0;",
+		"Schedule:Constant, ZeroSch,, 0.0;",
+		"Schedule:Constant, UseInSch,, 15.0;",
+		"WaterHeater:Stratified,",
+		"    Water Heater,            !- Name",
+		"    Domestic Hot Water,      !- End-Use Subcategory",
+		"    0.170343531,             !- Tank Volume {m3}",
+		"    1.0335,                  !- Tank Height {m}",
+		"    VerticalCylinder,        !- Tank Shape",
+		"    ,                        !- Tank Perimeter {m}",
+		"    ,                        !- Maximum Temperature Limit {C}",
+		"    MasterSlave,             !- Heater Priority Control",
+		"    Heater1SP,               !- Heater 1 Setpoint Temperature Schedule Name",
+		"    2,                       !- Heater 1 Deadband Temperature Difference {deltaC}",
+		"    4500,                    !- Heater 1 Capacity {W}",
+		"    0.7320625,               !- Heater 1 Height {m}",
+		"    Heater2SP,               !- Heater 2 Setpoint Temperature Schedule Name",
+		"    5,                       !- Heater 2 Deadband Temperature Difference {deltaC}",
+		"    4500,                    !- Heater 2 Capacity {W}",
+		"    0.1291875,               !- Heater 2 Height {m}",
+		"    Electricity,             !- Heater Fuel Type",
+		"    1,                       !- Heater Thermal Efficiency",
+		"    0,                       !- Off Cycle Parasitic Fuel Consumption Rate {W}",
+		"    Electricity,             !- Off Cycle Parasitic Fuel Type",
+		"    0,                       !- Off Cycle Parasitic Heat Fraction to Tank",
+		"    0,                       !- Off Cycle Parasitic Height {m}",
+		"    0,                       !- On Cycle Parasitic Fuel Consumption Rate {W}",
+		"    Electricity,             !- On Cycle Parasitic Fuel Type",
+		"    0,                       !- On Cycle Parasitic Heat Fraction to Tank",
+		"    0,                       !- On Cycle Parasitic Height {m}",
+		"    Schedule,                !- Ambient Temperature Indicator",
+		"    AmbientSch,              !- Ambient Temperature Schedule Name",
+		"    ,                        !- Ambient Temperature Zone Name",
+		"    ,                        !- Ambient Temperature Outdoor Air Node Name",
+		"    1.132213669226055,       !- Uniform Skin Loss Coefficient per Unit Area to Ambient Temperature {W/m2-K}",
+		"    1,                       !- Skin Loss Fraction to Zone",
+		"    0,                       !- Off Cycle Flue Loss Coefficient to Ambient Temperature {W/K}",
+		"    1,                       !- Off Cycle Flue Loss Fraction to Zone",
+		"    0.00038754,              !- Peak Use Flow Rate {m3/s}",
+		"    ZeroSch,                 !- Use Flow Rate Fraction Schedule Name",
+		"    UseInSch,                !- Cold Water Supply Temperature Schedule Name",
+		"    ,                        !- Use Side Inlet Node Name",
+		"    ,                        !- Use Side Outlet Node Name",
+		"    1,                       !- Use Side Effectiveness",
+		"    0,                       !- Use Side Inlet Height {m}",
+		"    autocalculate,           !- Use Side Outlet Height {m}",
+		"    ,                        !- Source Side Inlet Node Name",
+		"    ,                        !- Source Side Outlet Node Name",
+		"    1,                       !- Source Side Effectiveness",
+		"    0.1,                     !- Source Side Inlet Height {m}",
+		"    0,                       !- Source Side Outlet Height {m}",
+		"    Fixed,                   !- Inlet Mode",
+		"    autosize,                !- Use Side Design Flow Rate {m3/s}",
+		"    autosize,                !- Source Side Design Flow Rate {m3/s}",
+		"    ,                        !- Indirect Water Heating Recovery Time {hr}",
+		"    12,                      !- Number of Nodes",
+		"    0,                       !- Additional Destratification Conductivity {W/m-K}",
+		"    0,                       !- Node 1 Additional Loss Coefficient {W/K}",
+		"    0,                       !- Node 2 Additional Loss Coefficient {W/K}",
+		"    0,                       !- Node 3 Additional Loss Coefficient {W/K}",
+		"    0,                       !- Node 4 Additional Loss Coefficient {W/K}",
+		"    0,                       !- Node 5 Additional Loss Coefficient {W/K}",
+		"    0,                       !- Node 6 Additional Loss Coefficient {W/K}",
+		"    0,                       !- Node 7 Additional Loss Coefficient {W/K}",
+		"    0,                       !- Node 8 Additional Loss Coefficient {W/K}",
+		"    0,                       !- Node 9 Additional Loss Coefficient {W/K}",
+		"    0,                       !- Node 10 Additional Loss Coefficient {W/K}",
+		"    0,                       !- Node 11 Additional Loss Coefficient {W/K}",
+		"    0,                       !- Node 12 Additional Loss Coefficient {W/K}",
+		"    ,                        !- Source Side Flow Control Mode",
+		"    ,                        !- Indirect Alternate Setpoint Temperature Schedule Name",
+		"    Implicit;                !- Node Temperature Solution Algorithm",
+	});
+
+	ASSERT_FALSE( process_idf( idf_objects ) );
+
+	ASSERT_FALSE( WaterThermalTanks::GetWaterThermalTankInput() );
+
+	WaterThermalTanks::WaterThermalTankData & Tank = WaterThermalTank( 1 );
+	EXPECT_EQ( WaterThermalTanks::SolutionAlgorithmImplicit, Tank.SolutionAlgorithm );
+
+	// Stratified tank below the heater 1 cut-in temperature with a steady draw, simulated over one hour
+	for ( int i = 1; i <= Tank.Nodes; ++i ) {
+		Tank.Node( i ).SavedTemp = 54.5 - 9.5 * ( i - 1 ) / ( Tank.Nodes - 1 );
+	}
+	Tank.SavedHeaterOn1 = false;
+	Tank.SavedHeaterOn2 = false;
+	Tank.SetPointTemp = 55.0;
+	Tank.SetPointTemp2 = 40.0;
+	Tank.UseInletTemp = 15.0;
+	Tank.UseMassFlowRate = 0.02;
+	Tank.AmbientTemp = 23.0;
+
+	HourOfDay = 0;
+	TimeStep = 1;
+	TimeStepZone = 1.0;
+	TimeStepSys = TimeStepZone;
+	SysTimeElapsed = 0.0;
+	Tank.TimeElapsed = HourOfDay + TimeStep * TimeStepZone + SysTimeElapsed;
+
+	int GlycolIndex = 0;
+	Real64 const Cp = FluidProperties::GetSpecificHeatGlycol( Water, 50.0, GlycolIndex, "StratifiedTankImplicitSolution" );
+
+	// Reference solution with one second explicit substeps
+	Tank.SolutionAlgorithm = WaterThermalTanks::SolutionAlgorithmExplicit;
+	Tank.TankTemp = 50.0;
+	CalcWaterThermalTankStratified( 1 );
+	Real64 const ExplicitTankTemp = Tank.TankTemp;
+	Real64 const ExplicitRuntimeFraction = Tank.RuntimeFraction;
+	Real64 const ExplicitUseRate = Tank.UseRate;
+
+	Tank.SolutionAlgorithm = WaterThermalTanks::SolutionAlgorithmImplicit;
+	Tank.TankTemp = 50.0;
+	CalcWaterThermalTankStratified( 1 );
+
+	// the heaters cycle during the hour
+	EXPECT_GT( Tank.CycleOnCount, 1 );
+	EXPECT_GT( Tank.RuntimeFraction, 0.0 );
+	EXPECT_LT( Tank.RuntimeFraction, 1.0 );
+
+	EXPECT_NEAR( ExplicitTankTemp, Tank.TankTemp, 0.2 );
+	EXPECT_NEAR( ExplicitRuntimeFraction, Tank.RuntimeFraction, 0.05 );
+	EXPECT_NEAR( ExplicitUseRate, Tank.UseRate, 0.02 * std::abs( ExplicitUseRate ) );
+
+	// the implicit solution closes the tank energy balance
+	Real64 TankEnergyChange = 0.0;
+	for ( int i = 1; i <= Tank.Nodes; ++i ) {
+		TankEnergyChange += Tank.Node( i ).Mass * Cp * ( Tank.Node( i ).Temp - Tank.Node( i ).SavedTemp );
+	}
+	Real64 const NetHeatTransfer = Tank.NetHeatTransferRate * TimeStepSys * 3600.0;
+	EXPECT_NEAR( TankEnergyChange, NetHeatTransfer, 1.0e-6 * std::abs( TankEnergyChange ) + 1.0 );
+}
@@ -253,3 +253,66 @@ TEST_F(EnergyPlusFixture, WindowFrameTest )
 	EXPECT_GT(DataSurfaces::WinHeatLossRep( winNum ), DataSurfaces::WinHeatTransfer( winNum ));
 
 }
+
+TEST_F(EnergyPlusFixture, WindowManager_GasMixtureConductanceTest )
+{
+	// Gap 1 holds air, gap 2 an even "mixture" of air with itself, which must reduce to the pure gas properties
+	for ( int IGap = 1; IGap <= 2; ++IGap ) {
+		WindowManager::gap( IGap ) = 0.0127;
+		WindowManager::gnmix( IGap ) = IGap;
+		for ( int IMix = 1; IMix <= IGap; ++IMix ) {
+			WindowManager::gwght( IMix, IGap ) = DataHeatBalance::GasWght( 1 );
+			WindowManager::gfract( IMix, IGap ) = 1.0 / IGap;
+			for ( int ICoeff = 1; ICoeff <= 3; ++ICoeff ) {
+				WindowManager::gcon( ICoeff, IMix, IGap ) = DataHeatBalance::GasCoeffsCon( ICoeff, 1 );
+				WindowManager::gvis( ICoeff, IMix, IGap ) = DataHeatBalance::GasCoeffsVis( ICoeff, 1 );
+				WindowManager::gcp( ICoeff, IMix, IGap ) = DataHeatBalance::GasCoeffsCp( ICoeff, 1 );
+			}
+		}
+	}
+
+	Real64 const tleft( 280.0 );
+	Real64 const tright( 290.0 );
+	Real64 con1, pr1, gr1;
+	Real64 con2, pr2, gr2;
+	WindowManager::WindowGasConductance( tleft, tright, 1, con1, pr1, gr1 );
+	WindowManager::WindowGasConductance( tleft, tright, 2, con2, pr2, gr2 );
+	EXPECT_NEAR( con1, con2, 1.0e-10 );
+	EXPECT_NEAR( pr1, pr2, 1.0e-10 );
+	EXPECT_NEAR( gr1, gr2, 1.0e-6 * gr1 );
+
+	Real64 dens1, visc1, dens2, visc2;
+	WindowManager::WindowGasPropertiesAtTemp( tleft, 1, dens1, visc1 );
+	WindowManager::WindowGasPropertiesAtTemp( tleft, 2, dens2, visc2 );
+	EXPECT_NEAR( dens1, dens2, 1.0e-10 );
+	EXPECT_NEAR( visc1, visc2, 1.0e-12 );
+
+	// Refill gap 2 with an air/argon mixture; the mixture factors must follow the new fill
+	WindowManager::gwght( 2, 2 ) = DataHeatBalance::GasWght( 2 );
+	WindowManager::gfract( 1, 2 ) = 0.1;
+	WindowManager::gfract( 2, 2 ) = 0.9;
+	for ( int ICoeff = 1; ICoeff <= 3; ++ICoeff ) {
+		WindowManager::gcon( ICoeff, 2, 2 ) = DataHeatBalance::GasCoeffsCon( ICoeff, 2 );
+		WindowManager::gvis( ICoeff, 2, 2 ) = DataHeatBalance::GasCoeffsVis( ICoeff, 2 );
+		WindowManager::gcp( ICoeff, 2, 2 ) = DataHeatBalance::GasCoeffsCp( ICoeff, 2 );
+	}
+	Real64 conAr, prAr, grAr;
+	WindowManager::WindowGasConductance( tleft, tright, 2, conAr, prAr, grAr );
+	EXPECT_LT( conAr, con1 ); // argon conducts less than air
+	EXPECT_GT( grAr, gr1 ); // and is denser
+
+	// Restoring the original fill gives back the original result exactly
+	WindowManager::gwght( 2, 2 ) = DataHeatBalance::GasWght( 1 );
+	WindowManager::gfract( 1, 2 ) = 0.5;
+	WindowManager::gfract( 2, 2 ) = 0.5;
+	for ( int ICoeff = 1; ICoeff <= 3; ++ICoeff ) {
+		WindowManager::gcon( ICoeff, 2, 2 ) = DataHeatBalance::GasCoeffsCon( ICoeff, 1 );
+		WindowManager::gvis( ICoeff, 2, 2 ) = DataHeatBalance::GasCoeffsVis( ICoeff, 1 );
+		WindowManager::gcp( ICoeff, 2, 2 ) = DataHeatBalance::GasCoeffsCp( ICoeff, 1 );
+	}
+	Real64 con3, pr3, gr3;
+	WindowManager::WindowGasConductance( tleft, tright, 2, con3, pr3, gr3 );
+	EXPECT_EQ( con2, con3 );
+	EXPECT_EQ( pr2, pr3 );
+	EXPECT_EQ( gr2, gr3 );
+}
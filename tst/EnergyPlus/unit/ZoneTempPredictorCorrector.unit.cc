@@ -641,3 +641,23 @@ TEST_F( EnergyPlusFixture, ZoneTempPredictorCorrector_CorrectZoneHumRatTest )
 		OccRoomTSetPointCool.deallocate();
 
 	}
+
+TEST_F( EnergyPlusFixture, ZoneTempPredictorCorrector_TruncationErrorSysSteps )
+{
+	// third order backward difference: a cubic history is integrated exactly, a quartic is not
+	ZoneAirSolutionAlgo = Use3rdOrder;
+	EXPECT_NEAR( 0.0, ZoneTempTruncationError( 64.0, 27.0, 8.0, 1.0, 0.0 ), 1.0e-12 );
+	EXPECT_NEAR( 24.0 * 3.0 / 22.0, ZoneTempTruncationError( 256.0, 81.0, 16.0, 1.0, 0.0 ), 1.0e-12 );
+
+	// error falls with the cube of the number of system timesteps
+	EXPECT_EQ( 1, NumSysStepsForTruncationError( 0.05, 0.1 ) );
+	EXPECT_EQ( 2, NumSysStepsForTruncationError( 0.8, 0.1 ) );
+	EXPECT_EQ( 3, NumSysStepsForTruncationError( 0.81, 0.1 ) );
+	EXPECT_EQ( 1, NumSysStepsForTruncationError( 0.8, 0.0 ) );
+
+	// first order methods: a ramp is integrated exactly and error falls linearly with the step count
+	ZoneAirSolutionAlgo = UseEulerMethod;
+	EXPECT_NEAR( 0.0, ZoneTempTruncationError( 24.0, 23.0, 22.0, 21.0, 20.0 ), 1.0e-12 );
+	EXPECT_NEAR( 1.0, ZoneTempTruncationError( 16.0, 9.0, 4.0, 1.0, 0.0 ), 1.0e-12 );
+	EXPECT_EQ( 4, NumSysStepsForTruncationError( 0.35, 0.1 ) );
+}